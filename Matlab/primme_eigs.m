@@ -59,7 +59,15 @@ function [varargout] = primme_eigs(varargin)
 %     OPTS.SkewX: use the preconditioned approx. eigenvector in the right projector
 %     OPTS.relTolBase: a legacy from classical JDQR (not recommended)
 %     OPTS.convTest: how to stop the inner QMR Method
+%     OPTS.storagePrecision: storage of the inner QMR update vector
+%        {'primme_storage_full'}
+%     OPTS.innerPipeline: one reduction for the inner products of each
+%        QMR step {0}
 %     OPTS.iseed: random seed
+%     OPTS.reuseBuffers: pass the same array as input to AFUN and PFUN in
+%          every call instead of a new one; AFUN and PFUN must not keep a
+%          reference to their input (e.g., in a persistent variable or a
+%          returned value), because the next call overwrites it {false}
 %
 %   For detailed descriptions of the above options, visit:
 %   http://www.cs.wm.edu/~andreas/software/doc/primmec.html#parameters-guide
@@ -81,6 +89,7 @@ function [varargout] = primme_eigs(varargin)
 %     'STEEPEST_DESCENT',         equiv. to GD(block,2*block)
 %     'LOBPCG_OrthoBasis',        equiv. to GD(nev,3*nev)+nev
 %     'LOBPCG_OrthoBasis_Window'  equiv. to GD(block,3*block)+block nev>block
+%     'GD_plusK_Pipelined'        GD+k with one reduction per basis expansion
 %
 %   For further description of the method visit:
 %   http://www.cs.wm.edu/~andreas/software/doc/appendix.html#preset-methods
@@ -182,12 +191,14 @@ function [varargout] = primme_eigs(varargin)
       end
       opts.n = n;
       opts.matrixMatvec = @(x)A*x;
+      Asparse = issparse(A);
 
       % Get type and complexity
       Acomplex = ~isreal(A);
       Adouble = strcmp(class(A), 'double');
    else
       opts.matrixMatvec = fcnchk_gen(A); % get the function handle of user's function
+      Asparse = 0;
       n = round(varargin{nextArg});
       if ~isscalar(n) || ~isreal(n) || (n<0) || ~isfinite(n)
          error(message('The size of input matrix A must be an positive integer'));
@@ -309,6 +320,14 @@ function [varargout] = primme_eigs(varargin)
       opts = rmfield(opts, 'isdouble');
    end
 
+   % Process 'reuseBuffers' in opts
+   if isfield(opts, 'reuseBuffers')
+      reuseBuffers = opts.reuseBuffers;
+      opts = rmfield(opts, 'reuseBuffers');
+   else
+      reuseBuffers = 0;
+   end
+
    % Process 'disp' in opts
    if isfield(opts, 'disp')
       dispLevel = opts.disp;
@@ -338,7 +357,9 @@ function [varargout] = primme_eigs(varargin)
               {'SkewQ',              'correction_projectors_SkewQ'}, ...
               {'SkewX',              'correction_projectors_SkewX'}, ...
               {'convTest',           'correction_convTest'}, ...
-              {'relTolBase',         'correction_relTolBase'}};
+              {'relTolBase',         'correction_relTolBase'}, ...
+              {'storagePrecision',   'correction_storagePrecision'}, ...
+              {'innerPipeline',      'correction_pipeline'}};
 
    for i=1:numel(changes)
       if isfield(opts, changes{i}{1})
@@ -384,6 +405,11 @@ function [varargout] = primme_eigs(varargin)
    % Set other options in primme_params
    primme_set_members(opts, primme);
 
+   % Sparse matrices are multiplied by primme_mex without calling MATLAB
+   if Asparse
+      primme_mex('primme_set_member', primme, 'matrixMatvec', A);
+   end
+
    % Set method
    primme_mex('primme_set_method', method, primme);
 
@@ -424,7 +450,7 @@ function [varargout] = primme_eigs(varargin)
    xprimme = [type 'primme'];
 
    % Call xprimme
-   [ierr, evals, norms, evecs] = primme_mex(xprimme, init, primme); 
+   [ierr, evals, norms, evecs] = primme_mex(xprimme, init, primme, reuseBuffers); 
 
    % Process error code and return the required arguments
    if ierr ~= 0
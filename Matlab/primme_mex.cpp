@@ -228,6 +228,36 @@ static void copy_mxArray(const mxArray *x, TY *y, I m, I n, I ldy) {
    }      
 }
 
+// Copy the content of a C array into a mxArray with proper dimensions,
+// class and complexity
+// Arguments:
+// - y: C type array from to get the values
+// - m: number of rows of matrix y and x
+// - n: number of columns of matrix y and x
+// - ldy: leading dimension of y
+// - x: MATLAB array to copy the values
+
+template <typename T, typename I>
+static void copy_to_mxArray(const T *y, I m, I n, I ldy, mxArray *x) {
+   T *px = (T*)mxGetData(x);
+   if (m == ldy) {
+      memcpy(px, y, sizeof(T)*m*n);
+   }
+   else {
+      for (I i=0; i<n; i++) memcpy(&px[m*i], &y[ldy*i], sizeof(T)*m);
+   }
+}
+
+template <typename T, typename I>
+static void copy_to_mxArray(const std::complex<T> *y, I m, I n, I ldy,
+      mxArray *x) {
+   T *pxr = (T*)mxGetData(x), *pxi = (T*)mxGetImagData(x);
+   for (I i=0; i<n; i++) for (I j=0; j<m; j++) {
+      pxr[m*i+j] = std::real(y[ldy*i+j]);
+      pxi[m*i+j] = std::imag(y[ldy*i+j]);
+   }
+}
+
 // Creates a mxArray with the content of a C array
 // Arguments:
 // - y: C type array from to get the values
@@ -267,8 +297,7 @@ static mxArray* create_mxArray(T *y, I m, I n, I ldy, bool avoidCopy=false) {
 
       // Copy the content of y into the mxArray
 
-      T *px = (T*)mxGetData(x);
-      for (I i=0; i<n; i++) for (I j=0; j<m; j++) px[m*i+j] = y[ldy*i+j];
+      copy_to_mxArray(y, m, n, ldy, x);
 
       return x;
    }
@@ -288,15 +317,149 @@ static mxArray* create_mxArray(std::complex<T> *y, I m, I n, I ldy,
 
    // Copy the content of y into the mxArray
 
-   T *pxr = (T*)mxGetData(x), *pxi = (T*)mxGetImagData(x);
-   for (I i=0; i<n; i++) for (I j=0; j<m; j++) {
-      pxr[m*i+j] = std::real(y[ldy*i+j]);
-      pxi[m*i+j] = std::imag(y[ldy*i+j]);
-   }
+   copy_to_mxArray(y, m, n, ldy, x);
 
    return x;
 }
 
+// Input vectors of the callbacks are copied into a single mxArray during a
+// call to xprimme or xprimme_svds if the user asks for it, instead of
+// creating a new mxArray in every call. The array is allocated for the
+// largest block seen so far and reshaped in every call. It is owned by the
+// current call to xprimme, so it is freed by MATLAB even if a callback fails.
+// The callbacks must not keep a reference to their input, because the next
+// call overwrites it and the array is freed when xprimme returns.
+
+struct MatvecBuffer {
+   bool enabled;        // whether to reuse the array
+   mxArray *x;          // array passed as input vector to the callbacks
+   size_t capacity;     // number of elements allocated in x
+};
+
+static MatvecBuffer matvecBuffer = {false, NULL, 0};
+
+// Return a mxArray with the content of the input vector x of a callback.
+// The array is either the shared buffer or a new array that should be freed
+// with destroy_input_mxArray.
+// Arguments:
+// - x: C type array from to get the values
+// - m: number of rows of matrix x and output mxArray
+// - n: number of columns of matrix x and output mxArray
+// - ldx: leading dimension of x
+
+template <typename T, typename I>
+static mxArray* create_input_mxArray(T *x, I m, I n, I ldx) {
+
+   if (!matvecBuffer.enabled) {
+      return create_mxArray<typename Real<T>::type,I>(x, m, n, ldx, true);
+   }
+
+   // Grow the buffer if it is too small to hold x
+
+   if (matvecBuffer.capacity < (size_t)m*n) {
+      if (matvecBuffer.x) mxDestroyArray(matvecBuffer.x);
+      matvecBuffer.x = mxCreateNumericMatrix((mwSize)m, (mwSize)n,
+            toClassID<T>(), isComplex<T>() ? mxCOMPLEX : mxREAL);
+      matvecBuffer.capacity = (size_t)m*n;
+   }
+
+   // Reshape the buffer as m x n and copy x into it
+
+   mxSetM(matvecBuffer.x, (mwSize)m);
+   mxSetN(matvecBuffer.x, (mwSize)n);
+   copy_to_mxArray(x, m, n, ldx, matvecBuffer.x);
+
+   return matvecBuffer.x;
+}
+
+// Free a mxArray returned by create_input_mxArray for the input vector x
+
+static void destroy_input_mxArray(mxArray *a, void *x) {
+   if (a == matvecBuffer.x) return;
+   if (mxGetData(a) == x) mxSetData(a, NULL);
+   mxDestroyArray(a); 
+}
+
+// Return the k-th nonzero of a MATLAB sparse matrix with real part ar and
+// imaginary part ai (NULL if the matrix is real) as type T, conjugated if
+// conj is true
+
+template <typename T>
+static inline T sparse_value(const double *ar, const double *ai, mwIndex k,
+      bool conj) {
+   (void)ai; (void)conj;
+   return (T)ar[k];
+}
+template <>
+inline std::complex<float> sparse_value(const double *ar, const double *ai,
+      mwIndex k, bool conj) {
+   return std::complex<float>((float)ar[k],
+         ai ? (float)(conj ? -ai[k] : ai[k]) : 0.0f);
+}
+template <>
+inline std::complex<double> sparse_value(const double *ar, const double *ai,
+      mwIndex k, bool conj) {
+   return std::complex<double>(ar[k], ai ? (conj ? -ai[k] : ai[k]) : 0.0);
+}
+
+// Check that the sparse matrix A can be multiplied natively by vectors of
+// type T with m rows and n columns
+
+template <typename T>
+static void check_sparse_matrix(const mxArray *A, PRIMME_INT m, PRIMME_INT n) {
+   if (!A || !mxIsSparse(A)) return;
+   if ((PRIMME_INT)mxGetM(A) != m || (PRIMME_INT)mxGetN(A) != n) {
+      mexErrMsgTxtPrintf2("Unsupported matrix dimension; it should be %dx%d",
+            (int)m, (int)n);
+   }
+   if (mxIsComplex(A) && !isComplex<T>()) {
+      mexErrMsgTxt("Complex sparse matrix passed to a real solver");
+   }
+}
+
+// Compute y = A*x or y = A'*x with A a MATLAB sparse double matrix without
+// calling back MATLAB. A is stored by columns, so y = A*x scatters every
+// column of A over y and y = A'*x gathers a dot product per column of A.
+// Every nonzero of A is loaded once for all vectors in the block.
+// Arguments:
+// - A: MATLAB sparse matrix
+// - transpose: if true, compute y = A'*x
+// - x: input vectors
+// - ldx: leading dimension of x
+// - y: output vectors
+// - ldy: leading dimension of y
+// - blockSize: number of columns of x and y
+
+template <typename T>
+static void sparseMatvec(const mxArray *A, bool transpose, const T *x,
+      PRIMME_INT ldx, T *y, PRIMME_INT ldy, int blockSize) {
+
+   const mwIndex *jc = mxGetJc(A), *ir = mxGetIr(A);
+   const double *ar = mxGetPr(A), *ai = mxGetPi(A);
+   mwSize m = mxGetM(A), n = mxGetN(A);
+
+   if (!transpose) {
+      for (int b=0; b<blockSize; b++) {
+         for (mwSize i=0; i<m; i++) y[ldy*b+i] = 0.0;
+      }
+      for (mwSize j=0; j<n; j++) {
+         for (mwIndex k=jc[j]; k<jc[j+1]; k++) {
+            T a = sparse_value<T>(ar, ai, k, false);
+            for (int b=0; b<blockSize; b++) y[ldy*b+ir[k]] += a*x[ldx*b+j];
+         }
+      }
+   }
+   else {
+      for (mwSize j=0; j<n; j++) {
+         for (int b=0; b<blockSize; b++) y[ldy*b+j] = 0.0;
+         for (mwIndex k=jc[j]; k<jc[j+1]; k++) {
+            T a = sparse_value<T>(ar, ai, k, true);
+            for (int b=0; b<blockSize; b++) y[ldy*b+j] += a*x[ldx*b+ir[k]];
+         }
+      }
+   }
+}
+
 // Template version of sprimme, cprimme, dprimme and zprimme
 
 static int tprimme(float *evals, float *evecs, float *resNorms, primme_params *primme) {
@@ -376,6 +539,15 @@ static int tprimme_svds(double *svals, std::complex<double> *svecs, double *resN
       mexErrMsgTxtPrintf1("Argument %d should be function handler", (NARG)+2); \
    }
 
+// Check that argument NARG is a function handler or a sparse double matrix
+// in a MATLAB function
+
+#define ASSERT_FUNCTION_OR_SPARSE(NARG) \
+   if (mxGetClassID(prhs[(NARG)]) != mxFUNCTION_CLASS \
+         && !(mxIsSparse(prhs[(NARG)]) && mxIsDouble(prhs[(NARG)]))) { \
+      mexErrMsgTxtPrintf1("Argument %d should be function handler or sparse matrix", (NARG)+2); \
+   }
+
 // Check that argument NARG is compatible with a number/string in a MATLAB function
 
 #define ASSERT_NUMERIC_OR_CHAR(NARG) \
@@ -572,11 +744,12 @@ static void mexFunction_primme_set_member(int nlhs, mxArray *plhs[], int nrhs,
 
       // The function handlers are stored in the user data fields in
       // primme_params, e.g., in matrix for matrixMatvec and preconditioner
-      // for applyPreconditioner
+      // for applyPreconditioner. matrixMatvec may be also a sparse matrix,
+      // which is multiplied without calling MATLAB
 
       case PRIMME_matrixMatvec:
       {
-         ASSERT_FUNCTION(2);
+         ASSERT_FUNCTION_OR_SPARSE(2);
          if (primme->matrix) mxDestroyArray((mxArray*)primme->matrix);
          mxArray *a = mxDuplicateArray(prhs[2]);
          mexMakeArrayPersistent(a);
@@ -694,7 +867,8 @@ static void mexFunction_primme_get_member(int nlhs, mxArray *plhs[], int nrhs,
 
       // The function handlers are stored in the user data fields in
       // primme_params, e.g., in matrix for matrixMatvec and preconditioner
-      // for applyPreconditioner
+      // for applyPreconditioner. matrixMatvec may be also a sparse matrix,
+      // which is multiplied without calling MATLAB
 
       case PRIMME_matrixMatvec:
       {
@@ -789,7 +963,8 @@ struct getPreconditinerField {
 // Auxiliary function for mexFunction_xprimme; PRIMME wrapper around
 // matrixMatvec, massMatrixMatvec and applyPreconditioner. Create a mxArray
 // from input vector x, call the function handler returned by F(primme) and
-// copy the content of its returned mxArray into the output vector y.
+// copy the content of its returned mxArray into the output vector y. If
+// F(primme) is a sparse matrix, multiply it by x without calling MATLAB.
 
 template <typename T, typename F>
 static void matrixMatvecEigs(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
@@ -805,14 +980,22 @@ static void matrixMatvecEigs(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
    }
 #endif
 
+   // Multiply natively sparse matrices
+
+   prhs[0] = (mxArray*)F::get(primme);
+   if (mxIsSparse(prhs[0])) {
+      sparseMatvec(prhs[0], false, (T*)x, *ldx, (T*)y, *ldy, *blockSize);
+      *ierr = 0;
+      return;
+   }
+
    // Create input vector x (avoid copy if possible)
 
-   prhs[1] = create_mxArray<typename Real<T>::type,PRIMME_INT>((T*)x, primme->n,
-         (PRIMME_INT)*blockSize, *ldx, true);
+   prhs[1] = create_input_mxArray((T*)x, primme->n, (PRIMME_INT)*blockSize,
+         *ldx);
 
    // Call the callback
 
-   prhs[0] = (mxArray*)F::get(primme);
    *ierr = mexCallMATLAB(1, plhs, 2, prhs, "feval");
 
    // Copy lhs[0] to y and destroy it
@@ -824,8 +1007,7 @@ static void matrixMatvecEigs(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
 
    // Destroy prhs[1]
 
-   if (mxGetData(prhs[1]) == x) mxSetData(prhs[1], NULL);
-   mxDestroyArray(prhs[1]); 
+   destroy_input_mxArray(prhs[1], x);
 }
 
 template <typename T>
@@ -885,17 +1067,24 @@ static void monitorFunEigs(void *basisEvals, int *basisSize, int *basisFlags,
 
 
 // Wrapper around xprimme; prototype:
-// [ret, evals, rnorms, evecs] = mexFunction_xprimme(init_guesses, primme)
+// [ret, evals, rnorms, evecs] = mexFunction_xprimme(init_guesses, primme,
+//                                                   reuseBuffers)
+// If reuseBuffers is given and true, the callbacks receive the same array
+// as input vector in every call.
 
 template<typename T>
 static void mexFunction_xprimme(int nlhs, mxArray *plhs[], int nrhs,
       const mxArray *prhs[])
 {
-   ASSERT_NUMARGSIN(2);
+   if (nrhs != 2 && nrhs != 3) {
+      mexErrMsgTxt("Required 3 or 4 arguments\n");
+   }
    ASSERT_NUMARGSOUTGE(1);
    ASSERT_POINTER(1);
 
    primme_params *primme = (primme_params*)mxArrayToPointer(prhs[1]);
+   bool reuseBuffers = (nrhs == 3 && mxGetScalar(prhs[2]) != 0.0);
+   check_sparse_matrix<T>((mxArray*)primme->matrix, primme->n, primme->n);
 
    // Allocate evals, rnorms and evecs; if possible create the mxArray and use
    // its data
@@ -959,10 +1148,21 @@ static void mexFunction_xprimme(int nlhs, mxArray *plhs[], int nrhs,
    prev_handler = signal(SIGINT, interrumptHandler);
 #endif
 
+   // Set the shared input array of the callbacks; save the current one in
+   // case this is a nested call
+
+   MatvecBuffer prevMatvecBuffer = matvecBuffer;
+   matvecBuffer.enabled = reuseBuffers;
+   matvecBuffer.x = NULL;
+   matvecBuffer.capacity = 0;
+
    // Call xprimme
 
    int ret = tprimme(evals, evecs, rnorms, primme);
 
+   if (matvecBuffer.x) mxDestroyArray(matvecBuffer.x);
+   matvecBuffer = prevMatvecBuffer;
+
 #if defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))
    // Unset ctrl+c handler
 
@@ -1105,11 +1305,12 @@ static void mexFunction_primme_svds_set_member(int nlhs, mxArray *plhs[],
 
       // The function handlers are stored in the user data fields in
       // primme_params, e.g., in matrix for matrixMatvec and preconditioner
-      // for applyPreconditioner
+      // for applyPreconditioner. matrixMatvec may be also a sparse matrix,
+      // which is multiplied without calling MATLAB
 
       case PRIMME_SVDS_matrixMatvec: 
       {
-         ASSERT_FUNCTION(2);
+         ASSERT_FUNCTION_OR_SPARSE(2);
          if (primme_svds->matrix) mxDestroyArray((mxArray*)primme_svds->matrix);
          mxArray *a = mxDuplicateArray(prhs[2]);
          mexMakeArrayPersistent(a);
@@ -1225,7 +1426,8 @@ static void mexFunction_primme_svds_get_member(int nlhs, mxArray *plhs[],
 
       // The function handlers are stored in the user data fields in
       // primme_params, e.g., in matrix for matrixMatvec and preconditioner
-      // for applyPreconditioner
+      // for applyPreconditioner. matrixMatvec may be also a sparse matrix,
+      // which is multiplied without calling MATLAB
 
       case PRIMME_SVDS_matrixMatvec: 
       {
@@ -1373,7 +1575,8 @@ struct getSvdsForPreconditioner {
 // from input vector x, call the function handler returned by F and
 // copy the content of its returned mxArray into the output vector y. The
 // functor F returns also the number of rows in x and y and the string
-// passed in callback depending on mode.
+// passed in callback depending on mode. If F returns a sparse matrix,
+// multiply it by x without calling MATLAB.
 
 template <typename T, typename F>
 static void matrixMatvecSvds(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
@@ -1395,10 +1598,18 @@ static void matrixMatvecSvds(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
    const char *str;
    F::get(*mode, primme_svds, &mx, &my, &prhs[0], &str);
 
+   // Multiply natively sparse matrices
+
+   if (mxIsSparse(prhs[0])) {
+      sparseMatvec(prhs[0], strcmp(str, "transp") == 0, (T*)x, *ldx, (T*)y,
+            *ldy, *blockSize);
+      *ierr = 0;
+      return;
+   }
+
    // Create input vector x (avoid copy if possible)
 
-   prhs[1] = create_mxArray<typename Real<T>::type,PRIMME_INT>((T*)x, mx,
-         (PRIMME_INT)*blockSize, *ldx, true);
+   prhs[1] = create_input_mxArray((T*)x, mx, (PRIMME_INT)*blockSize, *ldx);
    prhs[2] = mxCreateString(str);
 
    // Call the callback
@@ -1414,8 +1625,7 @@ static void matrixMatvecSvds(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
 
    // Destroy prhs[*]
 
-   if (mxGetData(prhs[1]) == x) mxSetData(prhs[1], NULL);
-   mxDestroyArray(prhs[1]); 
+   destroy_input_mxArray(prhs[1], x);
    mxDestroyArray(prhs[2]); 
 }
 
@@ -1479,17 +1689,24 @@ static void monitorFunSvds(void *basisSvals, int *basisSize, int *basisFlags,
 
 // Wrapper around xprimme_svds; prototype:
 // [ret, evals, rnorms, evecs] = mexFunction_xprimme_svds(...
-//                            init_guesses_left, init_guesses_right, primme_svds)
+//          init_guesses_left, init_guesses_right, primme_svds, reuseBuffers)
+// If reuseBuffers is given and true, the callbacks receive the same array
+// as input vector in every call.
 
 template<typename T>
 static void mexFunction_xprimme_svds(int nlhs, mxArray *plhs[], int nrhs,
       const mxArray *prhs[])
 {
-   ASSERT_NUMARGSIN(3);
+   if (nrhs != 3 && nrhs != 4) {
+      mexErrMsgTxt("Required 4 or 5 arguments\n");
+   }
    ASSERT_NUMARGSOUTGE(1);
    ASSERT_POINTER(2);
 
    primme_svds_params *primme_svds = (primme_svds_params*)mxArrayToPointer(prhs[2]);
+   bool reuseBuffers = (nrhs == 4 && mxGetScalar(prhs[3]) != 0.0);
+   check_sparse_matrix<T>((mxArray*)primme_svds->matrix, primme_svds->m,
+         primme_svds->n);
 
    // Allocate svals, rnorms and svecs; if possible create the mxArray and use
    // its data
@@ -1551,10 +1768,21 @@ static void mexFunction_xprimme_svds(int nlhs, mxArray *plhs[], int nrhs,
    prev_handler = signal(SIGINT, interrumptHandler);
 #endif
 
+   // Set the shared input array of the callbacks; save the current one in
+   // case this is a nested call
+
+   MatvecBuffer prevMatvecBuffer = matvecBuffer;
+   matvecBuffer.enabled = reuseBuffers;
+   matvecBuffer.x = NULL;
+   matvecBuffer.capacity = 0;
+
    // Call xprimme_svds
 
    int ret = tprimme_svds(svals, svecs, rnorms, primme_svds);
 
+   if (matvecBuffer.x) mxDestroyArray(matvecBuffer.x);
+   matvecBuffer = prevMatvecBuffer;
+
 #if defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))
    // Unset ctrl+c handler
 
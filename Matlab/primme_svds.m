@@ -40,6 +40,9 @@ function [varargout] = primme_svds(varargin)
 %   OPTIONS.locking  1, hard locking; 0, soft locking              -
 %   OPTIONS.maxBlockSize maximum block size                        1
 %   OPTIONS.iseed    random seed
+%   OPTIONS.reuseBuffers pass the same array as input to AFUN and   0
+%                    PFUN in every call; they must not keep a
+%                    reference to it, the next call overwrites it
 %   OPTIONS.primme   options for first stage solver                -
 %   OPTIONS.primmeStage2 options for second stage solver           -
 %
@@ -161,12 +164,14 @@ function [varargout] = primme_svds(varargin)
       opts.m = m;
       opts.n = n;
       opts.matrixMatvec = @(x,mode)matvecsvds(A,x,mode);
+      Asparse = issparse(A);
 
       % Get type and complexity
       Acomplex = ~isreal(A);
       Adouble = strcmp(class(A), 'double');
    else
       opts.matrixMatvec = fcnchk_gen(A); % get the function handle of user's function
+      Asparse = 0;
       m = round(varargin{nextArg});
       n = round(varargin{nextArg+1});
       if ~isscalar(m) || ~isreal(m) || (m<0) || ~isfinite(m) || ...
@@ -278,6 +283,14 @@ function [varargout] = primme_svds(varargin)
       opts = rmfield(opts, 'isdouble');
    end
 
+   % Process 'reuseBuffers' in opts
+   if isfield(opts, 'reuseBuffers')
+      reuseBuffers = opts.reuseBuffers;
+      opts = rmfield(opts, 'reuseBuffers');
+   else
+      reuseBuffers = 0;
+   end
+
    % Process 'disp' in opts
    if isfield(opts, 'disp')
       dispLevel = opts.disp;
@@ -406,6 +419,11 @@ function [varargout] = primme_svds(varargin)
    % Set other options in primme_svds_params
    primme_svds_set_members(opts, primme_svds);
 
+   % Sparse matrices are multiplied by primme_mex without calling MATLAB
+   if Asparse
+      primme_mex('primme_svds_set_member', primme_svds, 'matrixMatvec', A);
+   end
+
    % Set method in primme_svds_params
    primme_mex('primme_svds_set_method', method, primmeStage0method, ...
                                         primmeStage1method, primme_svds);
@@ -448,7 +466,7 @@ function [varargout] = primme_svds(varargin)
 
    % Call xprimme_svds
    [ierr, svals, norms, svecsl, svecsr] = primme_mex(xprimme_svds, init{1}, ...
-               init{2}, primme_svds); 
+               init{2}, primme_svds, reuseBuffers); 
 
    % Process error code and return the required arguments
    if ierr ~= 0
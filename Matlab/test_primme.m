@@ -59,6 +59,21 @@ for i=1:k
   assert(norm(A*evecs(:,i) - evecs(:,i)*evals(i,i)) < 1e-6*norm(A))
 end
 
+% Same but reusing the input array of the matrix-vector product
+
+ops.reuseBuffers = 1;
+[evecs, evals] = primme_eigs(fun, matrix_dim, k, 'SA', ops);
+ops = rmfield(ops, 'reuseBuffers');
+
+assert(norm(diag(evals) - (1:k)') < 1e-6*norm(A))
+
+% Compute the 6 largest eigenvalues of a sparse matrix, which is
+% multiplied without calling MATLAB
+
+evals = primme_eigs(sparse(A), k, 'LA', ops);
+
+assert(norm(evals - (50:-1:50-k+1)') < 1e-6*norm(A))
+
 % Compute the 6 eigenvalues closest to 30.5 using the Jacobi preconditioner
 % (too much convenient for a diagonal matrix)
 
@@ -82,7 +97,7 @@ eigs_meths = {'DEFAULT_METHOD', 'DYNAMIC', 'DEFAULT_MIN_TIME', ...
               'DEFAULT_MIN_MATVECS', 'Arnoldi', 'GD_plusK', 'GD_Olsen_plusK', ...
               'JD_Olsen_plusK', 'JDQR', 'JDQMR', 'JDQMR_ETol', ...
               'STEEPEST_DESCENT', 'LOBPCG_OrthoBasis', ...
-              'LOBPCG_OrthoBasis_Window'}; 
+              'LOBPCG_OrthoBasis_Window', 'GD_plusK_Pipelined'}; 
 for i = 1:numel(eigs_meths)
    [x,d,r,s,h] = primme_eigs(diag(1:100), 2, 'SA', struct('disp', 3), ...
                              eigs_meths{i});
@@ -144,6 +159,9 @@ A = sparse(diag(1:50) + diag(ones(49,1), 1));
 [L,U] = ilu(A, struct('type', 'nofill'));
 svals = primme_svds(A, 5, 'S', [], L, U);
 
+svals0 = svd(full(A));
+assert(norm(sort(svals) - sort(svals0(end-4:end))) < 1e-6*norm(svals0))
+
 % Compute the 5 smallest singular values of a square matrix using the R factor
 % of QR=A as a preconditioner
 
@@ -110,7 +110,7 @@ except __builtin__.Exception:
 
 
 
-__all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh', 'PrimmeError', 'PRIMME_Arnoldi', 'PRIMME_DEFAULT_METHOD', 'PRIMME_DEFAULT_MIN_MATVECS', 'PRIMME_DEFAULT_MIN_TIME', 'PRIMME_DYNAMIC', 'PRIMME_GD', 'PRIMME_GD_Olsen_plusK', 'PRIMME_GD_plusK', 'PRIMME_JDQMR', 'PRIMME_JDQMR_ETol', 'PRIMME_JDQR', 'PRIMME_JD_Olsen_plusK', 'PRIMME_LOBPCG_OrthoBasis', 'PRIMME_LOBPCG_OrthoBasis_Window', 'PRIMME_RQI', 'PRIMME_STEEPEST_DESCENT', 'primme_adaptive', 'primme_adaptive_ETolerance', 'primme_closest_abs', 'primme_closest_geq', 'primme_closest_leq', 'primme_decreasing_LTolerance', 'primme_dtr', 'primme_full_LTolerance', 'primme_init_default', 'primme_init_krylov', 'primme_init_random', 'primme_init_user', 'primme_largest', 'primme_largest_abs', 'primme_proj_RR', 'primme_proj_default', 'primme_proj_harmonic', 'primme_proj_refined', 'primme_smallest', 'primme_thick', 'PrimmeSvdsParams', 'svds', 'primme_svds_augmented', 'primme_svds_closest_abs', 'primme_svds_default', 'primme_svds_hybrid', 'primme_svds_largest', 'primme_svds_normalequations', 'primme_svds_op_AAt', 'primme_svds_op_AtA', 'primme_svds_op_augmented', 'primme_svds_op_none', 'primme_svds_smallest', 'sprimme_svds', 'cprimme_svds', 'dprimme_svds', 'zprimme_svds', 'PrimmeSvdsError']
+__all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh', 'PrimmeError', 'PRIMME_Arnoldi', 'PRIMME_DEFAULT_METHOD', 'PRIMME_DEFAULT_MIN_MATVECS', 'PRIMME_DEFAULT_MIN_TIME', 'PRIMME_DYNAMIC', 'PRIMME_GD', 'PRIMME_GD_Olsen_plusK', 'PRIMME_GD_plusK', 'PRIMME_JDQMR', 'PRIMME_JDQMR_ETol', 'PRIMME_JDQR', 'PRIMME_JD_Olsen_plusK', 'PRIMME_LOBPCG_OrthoBasis', 'PRIMME_LOBPCG_OrthoBasis_Window', 'PRIMME_GD_plusK_Pipelined', 'PRIMME_RQI', 'PRIMME_STEEPEST_DESCENT', 'primme_adaptive', 'primme_adaptive_ETolerance', 'primme_closest_abs', 'primme_closest_geq', 'primme_closest_leq', 'primme_decreasing_LTolerance', 'primme_dtr', 'primme_full_LTolerance', 'primme_init_default', 'primme_init_krylov', 'primme_init_random', 'primme_init_user', 'primme_largest', 'primme_largest_abs', 'primme_proj_RR', 'primme_proj_default', 'primme_proj_harmonic', 'primme_proj_refined', 'primme_smallest', 'primme_storage_bf16', 'primme_storage_fp16', 'primme_storage_full', 'primme_thick', 'PrimmeSvdsParams', 'svds', 'primme_svds_augmented', 'primme_svds_closest_abs', 'primme_svds_default', 'primme_svds_hybrid', 'primme_svds_largest', 'primme_svds_normalequations', 'primme_svds_op_AAt', 'primme_svds_op_AtA', 'primme_svds_op_augmented', 'primme_svds_op_none', 'primme_svds_smallest', 'sprimme_svds', 'cprimme_svds', 'dprimme_svds', 'zprimme_svds', 'PrimmeSvdsError']
 
 primme_smallest = _Primme.primme_smallest
 primme_largest = _Primme.primme_largest
@@ -132,12 +132,23 @@ primme_full_LTolerance = _Primme.primme_full_LTolerance
 primme_decreasing_LTolerance = _Primme.primme_decreasing_LTolerance
 primme_adaptive_ETolerance = _Primme.primme_adaptive_ETolerance
 primme_adaptive = _Primme.primme_adaptive
+primme_storage_full = _Primme.primme_storage_full
+primme_storage_bf16 = _Primme.primme_storage_bf16
+primme_storage_fp16 = _Primme.primme_storage_fp16
 primme_event_outer_iteration = _Primme.primme_event_outer_iteration
 primme_event_inner_iteration = _Primme.primme_event_inner_iteration
 primme_event_restart = _Primme.primme_event_restart
 primme_event_reset = _Primme.primme_event_reset
 primme_event_converged = _Primme.primme_event_converged
 primme_event_locked = _Primme.primme_event_locked
+primme_phase_matvec = _Primme.primme_phase_matvec
+primme_phase_precond = _Primme.primme_phase_precond
+primme_phase_ortho = _Primme.primme_phase_ortho
+primme_phase_globalSum = _Primme.primme_phase_globalSum
+primme_phase_solveH = _Primme.primme_phase_solveH
+primme_phase_restart = _Primme.primme_phase_restart
+primme_phase_locking = _Primme.primme_phase_locking
+PRIMME_NUM_PHASES = _Primme.PRIMME_NUM_PHASES
 class primme_stats(_object):
     __swig_setmethods__ = {}
     __setattr__ = lambda self, name, value: _swig_setattr(self, primme_stats, name, value)
@@ -172,6 +183,18 @@ class primme_stats(_object):
     __swig_getmethods__["numOrthoInnerProds"] = _Primme.primme_stats_numOrthoInnerProds_get
     if _newclass:
         numOrthoInnerProds = _swig_property(_Primme.primme_stats_numOrthoInnerProds_get, _Primme.primme_stats_numOrthoInnerProds_set)
+    __swig_setmethods__["numInnerIterations"] = _Primme.primme_stats_numInnerIterations_set
+    __swig_getmethods__["numInnerIterations"] = _Primme.primme_stats_numInnerIterations_get
+    if _newclass:
+        numInnerIterations = _swig_property(_Primme.primme_stats_numInnerIterations_get, _Primme.primme_stats_numInnerIterations_set)
+    __swig_setmethods__["numInnerGlobalSum"] = _Primme.primme_stats_numInnerGlobalSum_set
+    __swig_getmethods__["numInnerGlobalSum"] = _Primme.primme_stats_numInnerGlobalSum_get
+    if _newclass:
+        numInnerGlobalSum = _swig_property(_Primme.primme_stats_numInnerGlobalSum_get, _Primme.primme_stats_numInnerGlobalSum_set)
+    __swig_setmethods__["volumeRestart"] = _Primme.primme_stats_volumeRestart_set
+    __swig_getmethods__["volumeRestart"] = _Primme.primme_stats_volumeRestart_get
+    if _newclass:
+        volumeRestart = _swig_property(_Primme.primme_stats_volumeRestart_get, _Primme.primme_stats_volumeRestart_set)
     __swig_setmethods__["elapsedTime"] = _Primme.primme_stats_elapsedTime_set
     __swig_getmethods__["elapsedTime"] = _Primme.primme_stats_elapsedTime_get
     if _newclass:
@@ -192,6 +215,18 @@ class primme_stats(_object):
     __swig_getmethods__["timeGlobalSum"] = _Primme.primme_stats_timeGlobalSum_get
     if _newclass:
         timeGlobalSum = _swig_property(_Primme.primme_stats_timeGlobalSum_get, _Primme.primme_stats_timeGlobalSum_set)
+    __swig_setmethods__["timeSolveH"] = _Primme.primme_stats_timeSolveH_set
+    __swig_getmethods__["timeSolveH"] = _Primme.primme_stats_timeSolveH_get
+    if _newclass:
+        timeSolveH = _swig_property(_Primme.primme_stats_timeSolveH_get, _Primme.primme_stats_timeSolveH_set)
+    __swig_setmethods__["timeRestart"] = _Primme.primme_stats_timeRestart_set
+    __swig_getmethods__["timeRestart"] = _Primme.primme_stats_timeRestart_get
+    if _newclass:
+        timeRestart = _swig_property(_Primme.primme_stats_timeRestart_get, _Primme.primme_stats_timeRestart_set)
+    __swig_setmethods__["timeLocking"] = _Primme.primme_stats_timeLocking_set
+    __swig_getmethods__["timeLocking"] = _Primme.primme_stats_timeLocking_get
+    if _newclass:
+        timeLocking = _swig_property(_Primme.primme_stats_timeLocking_get, _Primme.primme_stats_timeLocking_set)
     __swig_setmethods__["estimateMinEVal"] = _Primme.primme_stats_estimateMinEVal_set
     __swig_getmethods__["estimateMinEVal"] = _Primme.primme_stats_estimateMinEVal_get
     if _newclass:
@@ -212,6 +247,22 @@ class primme_stats(_object):
     __swig_getmethods__["estimateResidualError"] = _Primme.primme_stats_estimateResidualError_get
     if _newclass:
         estimateResidualError = _swig_property(_Primme.primme_stats_estimateResidualError_get, _Primme.primme_stats_estimateResidualError_set)
+    __swig_setmethods__["hwCounters"] = _Primme.primme_stats_hwCounters_set
+    __swig_getmethods__["hwCounters"] = _Primme.primme_stats_hwCounters_get
+    if _newclass:
+        hwCounters = _swig_property(_Primme.primme_stats_hwCounters_get, _Primme.primme_stats_hwCounters_set)
+    __swig_setmethods__["hwCycles"] = _Primme.primme_stats_hwCycles_set
+    __swig_getmethods__["hwCycles"] = _Primme.primme_stats_hwCycles_get
+    if _newclass:
+        hwCycles = _swig_property(_Primme.primme_stats_hwCycles_get, _Primme.primme_stats_hwCycles_set)
+    __swig_setmethods__["hwInstructions"] = _Primme.primme_stats_hwInstructions_set
+    __swig_getmethods__["hwInstructions"] = _Primme.primme_stats_hwInstructions_get
+    if _newclass:
+        hwInstructions = _swig_property(_Primme.primme_stats_hwInstructions_get, _Primme.primme_stats_hwInstructions_set)
+    __swig_setmethods__["hwCacheMisses"] = _Primme.primme_stats_hwCacheMisses_set
+    __swig_getmethods__["hwCacheMisses"] = _Primme.primme_stats_hwCacheMisses_get
+    if _newclass:
+        hwCacheMisses = _swig_property(_Primme.primme_stats_hwCacheMisses_get, _Primme.primme_stats_hwCacheMisses_set)
 
     def __init__(self):
         this = _Primme.new_primme_stats()
@@ -276,6 +327,14 @@ class projection_params(_object):
     __swig_getmethods__["projection"] = _Primme.projection_params_projection_get
     if _newclass:
         projection = _swig_property(_Primme.projection_params_projection_get, _Primme.projection_params_projection_set)
+    __swig_setmethods__["pipeline"] = _Primme.projection_params_pipeline_set
+    __swig_getmethods__["pipeline"] = _Primme.projection_params_pipeline_get
+    if _newclass:
+        pipeline = _swig_property(_Primme.projection_params_pipeline_get, _Primme.projection_params_pipeline_set)
+    __swig_setmethods__["redundantSolve"] = _Primme.projection_params_redundantSolve_set
+    __swig_getmethods__["redundantSolve"] = _Primme.projection_params_redundantSolve_get
+    if _newclass:
+        redundantSolve = _swig_property(_Primme.projection_params_redundantSolve_get, _Primme.projection_params_redundantSolve_set)
 
     def __init__(self):
         this = _Primme.new_projection_params()
@@ -318,6 +377,14 @@ class correction_params(_object):
     __swig_getmethods__["relTolBase"] = _Primme.correction_params_relTolBase_get
     if _newclass:
         relTolBase = _swig_property(_Primme.correction_params_relTolBase_get, _Primme.correction_params_relTolBase_set)
+    __swig_setmethods__["storagePrecision"] = _Primme.correction_params_storagePrecision_set
+    __swig_getmethods__["storagePrecision"] = _Primme.correction_params_storagePrecision_get
+    if _newclass:
+        storagePrecision = _swig_property(_Primme.correction_params_storagePrecision_get, _Primme.correction_params_storagePrecision_set)
+    __swig_setmethods__["pipeline"] = _Primme.correction_params_pipeline_set
+    __swig_getmethods__["pipeline"] = _Primme.correction_params_pipeline_get
+    if _newclass:
+        pipeline = _swig_property(_Primme.correction_params_pipeline_get, _Primme.correction_params_pipeline_set)
 
     def __init__(self):
         this = _Primme.new_correction_params()
@@ -394,6 +461,10 @@ class primme_params(_object):
     __swig_getmethods__["dynamicMethodSwitch"] = _Primme.primme_params_dynamicMethodSwitch_get
     if _newclass:
         dynamicMethodSwitch = _swig_property(_Primme.primme_params_dynamicMethodSwitch_get, _Primme.primme_params_dynamicMethodSwitch_set)
+    __swig_setmethods__["dynamicSizes"] = _Primme.primme_params_dynamicSizes_set
+    __swig_getmethods__["dynamicSizes"] = _Primme.primme_params_dynamicSizes_get
+    if _newclass:
+        dynamicSizes = _swig_property(_Primme.primme_params_dynamicSizes_get, _Primme.primme_params_dynamicSizes_set)
     __swig_setmethods__["locking"] = _Primme.primme_params_locking_set
     __swig_getmethods__["locking"] = _Primme.primme_params_locking_get
     if _newclass:
@@ -510,6 +581,7 @@ PRIMME_JDQMR_ETol = _Primme.PRIMME_JDQMR_ETol
 PRIMME_STEEPEST_DESCENT = _Primme.PRIMME_STEEPEST_DESCENT
 PRIMME_LOBPCG_OrthoBasis = _Primme.PRIMME_LOBPCG_OrthoBasis
 PRIMME_LOBPCG_OrthoBasis_Window = _Primme.PRIMME_LOBPCG_OrthoBasis_Window
+PRIMME_GD_plusK_Pipelined = _Primme.PRIMME_GD_plusK_Pipelined
 primme_int = _Primme.primme_int
 primme_double = _Primme.primme_double
 primme_pointer = _Primme.primme_pointer
@@ -546,6 +618,8 @@ PRIMME_matrix = _Primme.PRIMME_matrix
 PRIMME_preconditioner = _Primme.PRIMME_preconditioner
 PRIMME_initBasisMode = _Primme.PRIMME_initBasisMode
 PRIMME_projectionParams_projection = _Primme.PRIMME_projectionParams_projection
+PRIMME_projectionParams_pipeline = _Primme.PRIMME_projectionParams_pipeline
+PRIMME_projectionParams_redundantSolve = _Primme.PRIMME_projectionParams_redundantSolve
 PRIMME_restartingParams_scheme = _Primme.PRIMME_restartingParams_scheme
 PRIMME_restartingParams_maxPrevRetain = _Primme.PRIMME_restartingParams_maxPrevRetain
 PRIMME_correctionParams_precondition = _Primme.PRIMME_correctionParams_precondition
@@ -559,6 +633,8 @@ PRIMME_correctionParams_projectors_SkewQ = _Primme.PRIMME_correctionParams_proje
 PRIMME_correctionParams_projectors_SkewX = _Primme.PRIMME_correctionParams_projectors_SkewX
 PRIMME_correctionParams_convTest = _Primme.PRIMME_correctionParams_convTest
 PRIMME_correctionParams_relTolBase = _Primme.PRIMME_correctionParams_relTolBase
+PRIMME_correctionParams_storagePrecision = _Primme.PRIMME_correctionParams_storagePrecision
+PRIMME_correctionParams_pipeline = _Primme.PRIMME_correctionParams_pipeline
 PRIMME_stats_numOuterIterations = _Primme.PRIMME_stats_numOuterIterations
 PRIMME_stats_numRestarts = _Primme.PRIMME_stats_numRestarts
 PRIMME_stats_numMatvecs = _Primme.PRIMME_stats_numMatvecs
@@ -566,11 +642,21 @@ PRIMME_stats_numPreconds = _Primme.PRIMME_stats_numPreconds
 PRIMME_stats_numGlobalSum = _Primme.PRIMME_stats_numGlobalSum
 PRIMME_stats_volumeGlobalSum = _Primme.PRIMME_stats_volumeGlobalSum
 PRIMME_stats_numOrthoInnerProds = _Primme.PRIMME_stats_numOrthoInnerProds
+PRIMME_stats_numInnerIterations = _Primme.PRIMME_stats_numInnerIterations
+PRIMME_stats_numInnerGlobalSum = _Primme.PRIMME_stats_numInnerGlobalSum
+PRIMME_stats_volumeRestart = _Primme.PRIMME_stats_volumeRestart
 PRIMME_stats_elapsedTime = _Primme.PRIMME_stats_elapsedTime
 PRIMME_stats_timeMatvec = _Primme.PRIMME_stats_timeMatvec
 PRIMME_stats_timePrecond = _Primme.PRIMME_stats_timePrecond
 PRIMME_stats_timeOrtho = _Primme.PRIMME_stats_timeOrtho
 PRIMME_stats_timeGlobalSum = _Primme.PRIMME_stats_timeGlobalSum
+PRIMME_stats_timeSolveH = _Primme.PRIMME_stats_timeSolveH
+PRIMME_stats_timeRestart = _Primme.PRIMME_stats_timeRestart
+PRIMME_stats_timeLocking = _Primme.PRIMME_stats_timeLocking
+PRIMME_stats_hwCounters = _Primme.PRIMME_stats_hwCounters
+PRIMME_stats_hwCycles = _Primme.PRIMME_stats_hwCycles
+PRIMME_stats_hwInstructions = _Primme.PRIMME_stats_hwInstructions
+PRIMME_stats_hwCacheMisses = _Primme.PRIMME_stats_hwCacheMisses
 PRIMME_stats_estimateMinEVal = _Primme.PRIMME_stats_estimateMinEVal
 PRIMME_stats_estimateMaxEVal = _Primme.PRIMME_stats_estimateMaxEVal
 PRIMME_stats_estimateLargestSVal = _Primme.PRIMME_stats_estimateLargestSVal
@@ -582,6 +668,9 @@ PRIMME_ldevecs = _Primme.PRIMME_ldevecs
 PRIMME_ldOPs = _Primme.PRIMME_ldOPs
 PRIMME_monitorFun = _Primme.PRIMME_monitorFun
 PRIMME_monitor = _Primme.PRIMME_monitor
+PRIMME_monitorStream = _Primme.PRIMME_monitorStream
+PRIMME_convTestBlockFun = _Primme.PRIMME_convTestBlockFun
+PRIMME_dynamicSizes = _Primme.PRIMME_dynamicSizes
 
 def sprimme(*args):
     return _Primme.sprimme(*args)
@@ -859,6 +948,7 @@ PRIMME_SVDS_stats_timeOrtho = _Primme.PRIMME_SVDS_stats_timeOrtho
 PRIMME_SVDS_stats_timeGlobalSum = _Primme.PRIMME_SVDS_stats_timeGlobalSum
 PRIMME_SVDS_monitorFun = _Primme.PRIMME_SVDS_monitorFun
 PRIMME_SVDS_monitor = _Primme.PRIMME_SVDS_monitor
+PRIMME_SVDS_monitorStream = _Primme.PRIMME_SVDS_monitorStream
 
 def sprimme_svds(*args):
     return _Primme.sprimme_svds(*args)
@@ -1013,6 +1103,22 @@ class PrimmeParams(primme_params):
     __swig_getmethods__["monitor_set"] = _Primme.PrimmeParams_monitor_set_get
     if _newclass:
         monitor_set = _swig_property(_Primme.PrimmeParams_monitor_set_get, _Primme.PrimmeParams_monitor_set_set)
+    __swig_setmethods__["matvec_out_set"] = _Primme.PrimmeParams_matvec_out_set_set
+    __swig_getmethods__["matvec_out_set"] = _Primme.PrimmeParams_matvec_out_set_get
+    if _newclass:
+        matvec_out_set = _swig_property(_Primme.PrimmeParams_matvec_out_set_get, _Primme.PrimmeParams_matvec_out_set_set)
+
+    def _set_sparse_matrix(self, format, indptr, indices, data):
+        return _Primme.PrimmeParams__set_sparse_matrix(self, format, indptr, indices, data)
+
+    def _open_monitor_stream(self, capacity):
+        return _Primme.PrimmeParams__open_monitor_stream(self, capacity)
+
+    def _pop_monitor_records(self):
+        return _Primme.PrimmeParams__pop_monitor_records(self)
+
+    def _close_monitor_stream(self):
+        return _Primme.PrimmeParams__close_monitor_stream(self)
     def __disown__(self):
         self.this.disown()
         _Primme.disown_PrimmeParams(self)
@@ -1144,6 +1250,22 @@ class PrimmeSvdsParams(primme_svds_params):
     __swig_getmethods__["monitor_set"] = _Primme.PrimmeSvdsParams_monitor_set_get
     if _newclass:
         monitor_set = _swig_property(_Primme.PrimmeSvdsParams_monitor_set_get, _Primme.PrimmeSvdsParams_monitor_set_set)
+    __swig_setmethods__["matvec_out_set"] = _Primme.PrimmeSvdsParams_matvec_out_set_set
+    __swig_getmethods__["matvec_out_set"] = _Primme.PrimmeSvdsParams_matvec_out_set_get
+    if _newclass:
+        matvec_out_set = _swig_property(_Primme.PrimmeSvdsParams_matvec_out_set_get, _Primme.PrimmeSvdsParams_matvec_out_set_set)
+
+    def _set_sparse_matrix(self, format, indptr, indices, data):
+        return _Primme.PrimmeSvdsParams__set_sparse_matrix(self, format, indptr, indices, data)
+
+    def _open_monitor_stream(self, capacity):
+        return _Primme.PrimmeSvdsParams__open_monitor_stream(self, capacity)
+
+    def _pop_monitor_records(self):
+        return _Primme.PrimmeSvdsParams__pop_monitor_records(self)
+
+    def _close_monitor_stream(self):
+        return _Primme.PrimmeSvdsParams__close_monitor_stream(self)
     def __disown__(self):
         self.this.disown()
         _Primme.disown_PrimmeSvdsParams(self)
@@ -1151,7 +1273,11 @@ class PrimmeSvdsParams(primme_svds_params):
 PrimmeSvdsParams_swigregister = _Primme.PrimmeSvdsParams_swigregister
 PrimmeSvdsParams_swigregister(PrimmeSvdsParams)
 
+import warnings
 import numpy as np
+import scipy.linalg
+import scipy.sparse
+import scipy.sparse.linalg
 from scipy.sparse.linalg.interface import aslinearoperator
 
 __docformat__ = "restructuredtext en"
@@ -1249,6 +1375,128 @@ class PrimmeSvdsError(RuntimeError):
         RuntimeError.__init__(self, "PRIMME SVDS error %d: %s" % (err, msg))
 
 
+def _matmat_out(A, dtype):
+    """
+    Return a function f(X, Y, transpose=0) that stores A*X, or A.H*X if
+    transpose is nonzero, into the preallocated array Y, or None if A is not
+    a dense array.
+
+    It is used to pass the matrix-vector product to PRIMME with the
+    out-parameter protocol (see PrimmeParams.matvec_out_set), which avoids
+    allocating and copying a new array at every call.
+    """
+
+    if isinstance(A, np.ndarray) and A.ndim == 2:
+        A = np.asarray(A, dtype=dtype)
+        AH = A.T.conj()
+        def matmat(X, Y, transpose=0):
+            np.matmul(A if transpose == 0 else AH, X, out=Y)
+        return matmat
+
+    return None
+
+def _set_sparse_matrix(pp, A, dtype):
+    """
+    If A is a sparse matrix, pass its CSR or CSC buffers to PRIMME, which
+    then computes the products with A and A.H without calling Python, and
+    return True. Otherwise return False.
+    """
+
+    if not scipy.sparse.issparse(A):
+        return False
+    if A.format not in ('csr', 'csc'):
+        A = A.tocsr()
+    indptr, indices = A.indptr, A.indices
+    if indptr.dtype != indices.dtype or indptr.dtype.type not in (np.int32, np.int64):
+        indptr, indices = indptr.astype(np.int64), indices.astype(np.int64)
+    buffers = (np.ascontiguousarray(indptr), np.ascontiguousarray(indices),
+               np.ascontiguousarray(A.data, dtype=dtype))
+    pp._set_sparse_matrix(1 if A.format == 'csr' else 2, *buffers)
+# Keep the buffers alive as long as pp
+    pp._sparse_buffers = buffers
+    return True
+
+# Layout of primme_monitor_record (see primme_eigs.h)
+_monitor_record_dtype = np.dtype([
+    ("time", np.float64), ("value", np.float64), ("resNorm", np.float64),
+    ("LSRes", np.float64), ("numMatvecs", np.int64),
+    ("numOuterIterations", np.int64), ("event", np.int32),
+    ("index", np.int32), ("numConverged", np.int32), ("stage", np.int32)])
+
+def _monitor_stream_capacity(maxIterations, maxBlockSize):
+    """
+    Return the number of records buffered in the monitor stream: one for
+    every pair of the block at every outer iteration, between 2**12 and
+    2**20. The consumer thread empties the buffer while PRIMME runs, so the
+    buffer only fills up if the thread falls behind.
+    """
+
+    n = max(maxIterations, 1) * max(maxBlockSize, 1)
+    return int(min(max(n, 1 << 12), 1 << 20))
+
+def _monitor_history(pp, value):
+    """
+    Close the monitor stream of pp and return the history reported in the
+    stats of eigsh and svds: the first pair of the block at every outer
+    iteration.
+
+    The records are gathered by a background thread while PRIMME runs, so
+    PRIMME does not call Python or take the GIL at every iteration.
+    """
+
+    data, dropped = pp._close_monitor_stream()
+    if dropped > 0:
+        warnings.warn("the history misses %d records because the monitor "
+                      "stream was full" % dropped, RuntimeWarning)
+    r = np.frombuffer(data, dtype=_monitor_record_dtype)
+    r = r[(r["event"] == 0) & (r["index"] == 0)]
+    return {"numMatvecs": r["numMatvecs"].tolist(),
+            "elapsedTime": r["time"].tolist(),
+            "nconv": r["numConverged"].tolist(),
+            value: r["value"].tolist(),
+            "resNorm": r["resNorm"].tolist()}
+
+def _mass_factor(M, dtype):
+    """
+    Return functions (G, GH, Ginv, GHinv) that apply G, G.H, inv(G) and
+    inv(G.H) to a block of vectors, where M = G*G.H and M is Hermitian
+    positive definite.
+
+    If M is sparse, G = P.T*L*sqrt(D), from the factorization
+    P*M*P.T = L*D*L.H computed by SuperLU in symmetric mode without
+    pivoting. Otherwise G is the Cholesky factor of M.
+    """
+
+    if scipy.sparse.issparse(M):
+        lu = scipy.sparse.linalg.splu(scipy.sparse.csc_matrix(M, dtype=dtype),
+                permc_spec='MMD_AT_PLUS_A', diag_pivot_thresh=0.,
+                options=dict(SymmetricMode=True))
+        d = lu.U.diagonal()
+        if np.any(lu.perm_r != lu.perm_c) or np.any(d.real <= 0):
+            raise ValueError('M: expected a Hermitian positive definite matrix')
+        L, LH = lu.L.tocsr(), lu.L.T.conj().tocsr()
+        s = np.sqrt(d.real).astype(dtype).reshape((-1, 1))
+        p, pinv = lu.perm_c, np.argsort(lu.perm_c)
+        solve = scipy.sparse.linalg.spsolve_triangular
+        G = lambda X: L.dot(s*X)[p]
+        GH = lambda X: s*LH.dot(X[pinv])
+        Ginv = lambda X: solve(L, X[pinv], lower=True, unit_diagonal=True)/s
+        GHinv = lambda X: solve(LH, X/s, lower=False, unit_diagonal=True)[p]
+    elif isinstance(M, np.ndarray):
+        try:
+            L = scipy.linalg.cholesky(np.asarray(M, dtype=dtype), lower=True)
+        except np.linalg.LinAlgError:
+            raise ValueError('M: expected a Hermitian positive definite matrix')
+        solve = scipy.linalg.solve_triangular
+        G = lambda X: L.dot(X)
+        GH = lambda X: L.T.conj().dot(X)
+        Ginv = lambda X: solve(L, X, lower=True)
+        GHinv = lambda X: solve(L, X, lower=True, trans='C')
+    else:
+        raise ValueError('M: expected a dense or a sparse matrix')
+    return G, GH, Ginv, GHinv
+
+
 def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
           ncv=None, maxiter=None, tol=0, return_eigenvectors=True,
           Minv=None, OPinv=None, mode='normal', ortho=None,
@@ -1270,18 +1518,35 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     A : An N x N matrix, array, sparse matrix, or LinearOperator
         the operation A * x, where A is a real symmetric matrix or complex
         Hermitian.
+        The products with a sparse matrix are computed in C without calling
+        back to Python. The solver releases the GIL, and only the
+        callbacks to Python code acquire it.
     k : int, optional
         The number of eigenvalues and eigenvectors to be computed. Must be
         1 <= k < min(A.shape).
-    M : An N x N matrix, array, sparse matrix, or LinearOperator
-        (not supported yet)
+    M : An N x N matrix, array, or sparse matrix, optional
         the operation M * x for the generalized eigenvalue problem
 
             A * x = w * M * x.
 
-        M must represent a real, symmetric matrix if A is real, and must
-        represent a complex, Hermitian matrix if A is complex. For best
-        results, the data type of M should be the same as that of A.
+        M must represent a real, symmetric positive definite matrix if A
+        is real, and must represent a complex, Hermitian positive definite
+        matrix if A is complex. For best results, the data type of M should
+        be the same as that of A.
+        PRIMME has no support for M-inner products, so the problem is
+        solved as the standard problem
+        inv(G) * A * inv(G.H) * y = w * y, where M = G * G.H and
+        x = inv(G.H) * y. G is computed once before the solver starts:
+        the Cholesky factor of M if M is dense, which costs O(N^3) flops
+        and N^2 memory, or the LDL' factorization of SuperLU if M is sparse,
+        whose cost and memory depend on the fill-in. Every product with
+        the transformed operator also applies two triangular solves with G.
+        The returned eigenvectors are M-orthonormal and the vectors in
+        ortho should be M-orthonormal. The tolerance, the residual norms
+        in stats and the matrix-vector products counted in stats refer to
+        the transformed operator; the residual norm of a pair is
+        ||inv(G) * (A*x - w*M*x)||, the inv(M)-norm of the residual of the
+        generalized problem.
     sigma : real, optional
         Find eigenvalues near sigma.
     v0 : N x i, ndarray, optional
@@ -1363,7 +1628,8 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
         - "estimateMinEVal": the leftmost Ritz value seen
         - "estimateMaxEVal": the rightmost Ritz value seen
         - "estimateLargestSVal": the largest singular value seen
-        - "rnorms" : ||A*x[i] - x[i]*w[i]||
+        - "rnorms" : ||A*x[i] - x[i]*w[i]||, or
+          ||inv(G)*(A*x[i] - M*x[i]*w[i])|| if M is given (see M)
         - "hist" : (if return_history) report at every outer iteration of:
 
           - "elapsedTime": time spent up to now
@@ -1411,31 +1677,25 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     array([ 96.,  95.,  94.])
     """
 
-    A = aslinearoperator(A)
+    Aorig, A = A, aslinearoperator(A)
     if len(A.shape) != 2 or A.shape[0] != A.shape[1]:
         raise ValueError('A: expected square matrix (shape=%s)' % (A.shape,))
 
-    if M is not None:
-        raise ValueError('generalized problems (M != None) are not supported')
-
-    hist = {"numMatvecs": [], "elapsedTime": [], "nconv": [],
-            "eval": [], "resNorm": []}
+    if M is not None and M.shape != A.shape:
+        raise ValueError('M: expected matrix with the same shape as A (shape=%s)' % (M.shape,))
 
     class PP(PrimmeParams):
         def __init__(self):
             PrimmeParams.__init__(self)
-        def matvec(self, X):
-            return A.matmat(X)
+        def matvec(self, X, out=None):
+            if out is not None:
+                matmat_out(X, out)
+            else:
+                return A.matmat(X)
         def prevec(self, X):
+            if M is not None:
+                return GH(OPinv.matmat(G(X)))
             return OPinv.matmat(X)
-        def mon(self, basisEvals, basisFlags, iblock, basisNorms, numConverged,
-                    lockedEvals, lockedFlags, lockedNorms, inner_its, LSRes, event):
-            if event == 0 and len(iblock)>0: # event iteration
-                hist["numMatvecs"].append(self.stats.numMatvecs)
-                hist["elapsedTime"].append(self.stats.elapsedTime)
-                hist["nconv"].append(numConverged)
-                hist["eval"].append(basisEvals[iblock[0]])
-                hist["resNorm"].append(basisNorms[iblock[0]])
 
     pp = PP()
 
@@ -1494,9 +1754,6 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
             raise ValueError('ortho: expected matrix with the same columns as A (shape=%s)' % (ortho.shape,))
         pp.numOrthoConst = min(ortho.shape[1], pp.n)
 
-    if return_history and return_stats:
-        pp.monitor_set = 1
-
 # Set other parameters
     for dk, dv in kargs.items():
       setattr(pp, dk, dv)
@@ -1505,6 +1762,8 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
         dtype = np.dtype("d")
     else:
         dtype = A.dtype
+    if M is not None and M.dtype.kind == 'c':
+        dtype = np.result_type(dtype, M.dtype)
 
     if dtype.type is np.complex64:
         Xprimme = cprimme
@@ -1519,17 +1778,33 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
         Xprimme = zprimme
         rtype = np.dtype(np.float64)
 
+    matmat_out = None
+    if M is not None:
+# Solve inv(G)*A*inv(G.H) * y = w * y, where M = G*G.H
+        G, GH, Ginv, GHinv = _mass_factor(M, dtype)
+        def matmat_out(X, Y):
+            np.copyto(Y, Ginv(A.matmat(GHinv(X))), casting='unsafe')
+        pp.matvec_out_set = 1
+    elif not _set_sparse_matrix(pp, Aorig, dtype):
+        matmat_out = _matmat_out(Aorig, dtype)
+        pp.matvec_out_set = 0 if matmat_out is None else 1
+
     evals = np.zeros(pp.numEvals, rtype)
     norms = np.zeros(pp.numEvals, rtype)
     evecs = np.zeros((pp.n, pp.numOrthoConst+pp.numEvals), dtype, order='F')
 
     if ortho is not None:
         np.copyto(evecs[:, 0:pp.numOrthoConst], ortho[:, 0:pp.numOrthoConst])
+        if M is not None:
+            evecs[:, 0:pp.numOrthoConst] = GH(evecs[:, 0:pp.numOrthoConst])
 
     if v0 is not None:
         pp.initSize = min(v0.shape[1], pp.numEvals)
         np.copyto(evecs[:, pp.numOrthoConst:pp.numOrthoConst+pp.initSize],
             v0[:, 0:pp.initSize])
+        if M is not None:
+            evecs[:, pp.numOrthoConst:pp.numOrthoConst+pp.initSize] = \
+                GH(evecs[:, pp.numOrthoConst:pp.numOrthoConst+pp.initSize])
 
     if maxBlockSize:
         pp.maxBlockSize = maxBlockSize
@@ -1543,14 +1818,23 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     if method is not None:
         pp.set_method(method)
 
+    if return_history and return_stats:
+        pp._open_monitor_stream(_monitor_stream_capacity(
+            min(pp.maxOuterIterations, pp.maxMatvecs), pp.maxBlockSize))
+
     err = Xprimme(evals, evecs, norms, pp)
 
+    if return_history and return_stats:
+        hist = _monitor_history(pp, "eval")
+
     if err != 0:
         raise PrimmeError(err)
 
     evals = evals[0:pp.initSize]
     norms = norms[0:pp.initSize]
     evecs = evecs[:, pp.numOrthoConst:pp.numOrthoConst+pp.initSize]
+    if M is not None:
+        evecs = GHinv(evecs)
 
     if return_stats:
         stats = dict((f, getattr(pp.stats, f)) for f in [
@@ -1579,6 +1863,9 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
     ----------
     A : {sparse matrix, LinearOperator}
         Array to compute the SVD on, of shape (M, N)
+        The products with a sparse matrix are computed in C without calling
+        back to Python. The solver releases the GIL, and only the
+        callbacks to Python code acquire it.
     k : int, optional
         Number of singular values and vectors to compute.
         Must be 1 <= k < min(A.shape).
@@ -1700,7 +1987,7 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
     ['5.99871', '5.99057', '6.01065']
     """
 
-    A = aslinearoperator(A)
+    Aorig, A = A, aslinearoperator(A)
 
     m, n = A.shape
 
@@ -1722,15 +2009,14 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
         if precAug.shape[0] != precAug.shape[1] or precAug.shape[0] != m+n:
             raise ValueError('precAug: expected square matrix with size %d' % (m+n))
 
-    hist = {"numMatvecs": [], "elapsedTime": [], "nconv": [],
-            "sval": [], "resNorm": []}
-
     class PSP(PrimmeSvdsParams):
         def __init__(self):
             PrimmeSvdsParams.__init__(self)
 
-        def matvec(self, X, transpose):
-            if transpose == 0:
+        def matvec(self, X, transpose, out=None):
+            if out is not None:
+                matmat_out(X, out, transpose)
+            elif transpose == 0:
                 return A.matmat(X)
             else:
                 return A.H.matmat(X) 
@@ -1744,16 +2030,6 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
                 return precAug.matmat(X) 
             return X
 
-        def mon(self, basisSvals, basisFlags, iblock, basisNorms, numConverged,
-                    lockedSvals, lockedFlags, lockedNorms, inner_its, LSRes,
-                    event, stage):
-            if event == 0 and len(iblock)>0: # event iteration
-                hist["numMatvecs"].append(self.stats.numMatvecs)
-                hist["elapsedTime"].append(self.stats.elapsedTime)
-                hist["nconv"].append(numConverged)
-                hist["sval"].append(basisSvals[iblock[0]])
-                hist["resNorm"].append(basisNorms[iblock[0]])
-
     pp = PSP()
 
     pp.m = A.shape[0]
@@ -1814,9 +2090,6 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
     if orthou0 is not None:
         pp.numOrthoConst = min(orthou0.shape[1], min(m,n))
 
-    if return_history and return_stats:
-        pp.monitor_set = 1
-
 # Set other parameters
     for dk, dv in kargs.items():
       setattr(pp, dk, dv)
@@ -1839,6 +2112,11 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
         Xprimme_svds = zprimme_svds
         rtype = np.dtype(np.float64)
 
+    matmat_out = None
+    if not _set_sparse_matrix(pp, Aorig, dtype):
+        matmat_out = _matmat_out(Aorig, dtype)
+        pp.matvec_out_set = 0 if matmat_out is None else 1
+
     svals = np.zeros(pp.numSvals, rtype)
     svecsl = np.zeros((pp.m, pp.numOrthoConst+pp.numSvals), dtype, order='F')
     svecsr = np.zeros((pp.n, pp.numOrthoConst+pp.numSvals), dtype, order='F')
@@ -1862,8 +2140,15 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
         if methodStage2 is None: methodStage2 = PRIMME_DEFAULT_METHOD
         pp.set_method(method, methodStage1, methodStage2)
 
+    if return_history and return_stats:
+        pp._open_monitor_stream(_monitor_stream_capacity(pp.maxMatvecs,
+            pp.maxBlockSize))
+
     err = Xprimme_svds(svals, svecsl, svecsr, norms, pp)
 
+    if return_history and return_stats:
+        hist = _monitor_history(pp, "sval")
+
     if err != 0:
         raise PrimmeSvdsError(err)
 
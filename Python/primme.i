@@ -42,7 +42,7 @@ Uses PRIMME: https://github.com/primme/primme
 %module(docstring=DOCSTRING,directors="1") Primme
 
 %pythoncode %{
-__all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh', 'PrimmeError', 'PRIMME_Arnoldi', 'PRIMME_DEFAULT_METHOD', 'PRIMME_DEFAULT_MIN_MATVECS', 'PRIMME_DEFAULT_MIN_TIME', 'PRIMME_DYNAMIC', 'PRIMME_GD', 'PRIMME_GD_Olsen_plusK', 'PRIMME_GD_plusK', 'PRIMME_JDQMR', 'PRIMME_JDQMR_ETol', 'PRIMME_JDQR', 'PRIMME_JD_Olsen_plusK', 'PRIMME_LOBPCG_OrthoBasis', 'PRIMME_LOBPCG_OrthoBasis_Window', 'PRIMME_RQI', 'PRIMME_STEEPEST_DESCENT', 'primme_adaptive', 'primme_adaptive_ETolerance', 'primme_closest_abs', 'primme_closest_geq', 'primme_closest_leq', 'primme_decreasing_LTolerance', 'primme_dtr', 'primme_full_LTolerance', 'primme_init_default', 'primme_init_krylov', 'primme_init_random', 'primme_init_user', 'primme_largest', 'primme_largest_abs', 'primme_proj_RR', 'primme_proj_default', 'primme_proj_harmonic', 'primme_proj_refined', 'primme_smallest', 'primme_thick', 'PrimmeSvdsParams', 'svds', 'primme_svds_augmented', 'primme_svds_closest_abs', 'primme_svds_default', 'primme_svds_hybrid', 'primme_svds_largest', 'primme_svds_normalequations', 'primme_svds_op_AAt', 'primme_svds_op_AtA', 'primme_svds_op_augmented', 'primme_svds_op_none', 'primme_svds_smallest', 'sprimme_svds', 'cprimme_svds', 'dprimme_svds', 'zprimme_svds', 'PrimmeSvdsError']
+__all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh', 'PrimmeError', 'PRIMME_Arnoldi', 'PRIMME_DEFAULT_METHOD', 'PRIMME_DEFAULT_MIN_MATVECS', 'PRIMME_DEFAULT_MIN_TIME', 'PRIMME_DYNAMIC', 'PRIMME_GD', 'PRIMME_GD_Olsen_plusK', 'PRIMME_GD_plusK', 'PRIMME_JDQMR', 'PRIMME_JDQMR_ETol', 'PRIMME_JDQR', 'PRIMME_JD_Olsen_plusK', 'PRIMME_LOBPCG_OrthoBasis', 'PRIMME_LOBPCG_OrthoBasis_Window', 'PRIMME_GD_plusK_Pipelined', 'PRIMME_RQI', 'PRIMME_STEEPEST_DESCENT', 'primme_adaptive', 'primme_adaptive_ETolerance', 'primme_closest_abs', 'primme_closest_geq', 'primme_closest_leq', 'primme_decreasing_LTolerance', 'primme_dtr', 'primme_full_LTolerance', 'primme_init_default', 'primme_init_krylov', 'primme_init_random', 'primme_init_user', 'primme_largest', 'primme_largest_abs', 'primme_proj_RR', 'primme_proj_default', 'primme_proj_harmonic', 'primme_proj_refined', 'primme_smallest', 'primme_storage_bf16', 'primme_storage_fp16', 'primme_storage_full', 'primme_thick', 'PrimmeSvdsParams', 'svds', 'primme_svds_augmented', 'primme_svds_closest_abs', 'primme_svds_default', 'primme_svds_hybrid', 'primme_svds_largest', 'primme_svds_normalequations', 'primme_svds_op_AAt', 'primme_svds_op_AtA', 'primme_svds_op_augmented', 'primme_svds_op_none', 'primme_svds_smallest', 'sprimme_svds', 'cprimme_svds', 'dprimme_svds', 'zprimme_svds', 'PrimmeSvdsError']
 %}
 // Support PRIMME_INT for int64_t
 %include "stdint.i"
@@ -78,6 +78,10 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
 }
 %init %{
   import_array();
+#if PY_VERSION_HEX < 0x03070000
+  /* The solver releases the GIL; see my_primme */
+  PyEval_InitThreads();
+#endif
 %}
 
 // Global ignores
@@ -93,9 +97,24 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
 
 %ignore PRId64;
 
+%ignore primme_monitor_record;
+%ignore primme_monitor_stream;
+%ignore primme_monitor_sink;
+%ignore primme_monitor_stream_open;
+%ignore primme_monitor_stream_push;
+%ignore primme_monitor_stream_close;
+%ignore primme_monitor_sink_file;
+
 %ignore tprimme;
 %ignore tprimme_svds;
 
+%ignore SparseMatrix;
+%ignore PrimmeParams::sparse;
+%ignore PrimmeSvdsParams::sparse;
+%ignore MonitorBuffer;
+%ignore PrimmeParams::monitorBuffer;
+%ignore PrimmeSvdsParams::monitorBuffer;
+
 %ignore PrimmeParams::matrixMatvec;
 %ignore PrimmeParams::massMatrixMatvec;
 %ignore PrimmeParams::applyPreconditioner;
@@ -113,6 +132,8 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
 %ignore PrimmeParams::ShiftsForPreconditioner;
 %ignore PrimmeParams::convTest;
 %ignore PrimmeParams::monitor;
+%ignore PrimmeParams::monitorStream;
+%ignore PrimmeParams::convTestBlockFun;
 %ignore primme_params::matrixMatvec;
 %ignore primme_params::massMatrixMatvec;
 %ignore primme_params::applyPreconditioner;
@@ -130,6 +151,8 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
 %ignore primme_params::ShiftsForPreconditioner;
 %ignore primme_params::convTest;
 %ignore primme_params::monitor;
+%ignore primme_params::monitorStream;
+%ignore primme_params::convTestBlockFun;
 %ignore PrimmeSvdsParams::matrixMatvec;
 %ignore PrimmeSvdsParams::applyPreconditioner;
 %ignore PrimmeSvdsParams::convTestFun;
@@ -147,6 +170,7 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
 %ignore PrimmeSvdsParams::primmeStage2;
 %ignore PrimmeSvdsParams::monitorFun;
 %ignore PrimmeSvdsParams::monitor;
+%ignore PrimmeSvdsParams::monitorStream;
 %ignore primme_svds_params::matrixMatvec;
 %ignore primme_svds_params::applyPreconditioner;
 %ignore primme_svds_params::convTestFun;
@@ -164,6 +188,7 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
 %ignore primme_svds_params::primmeStage2;
 %ignore primme_svds_params::monitorFun;
 %ignore primme_svds_params::monitor;
+%ignore primme_svds_params::monitorStream;
 
 
 %fragment("NumPy_Array_Requirements_extra",
@@ -175,7 +200,7 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
    * set the Fortran ordering flag and recompute the strides.
    * NOTE: based on require_fortran in numpy.i
    */
-  int require_fortran2(PyArrayObject* ary, int ld)
+  int require_fortran2(PyArrayObject* ary, npy_intp ld)
   {
     int success = 1;
     if (array_numdims(ary) != 2) return 0;
@@ -196,12 +221,16 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
  
 %define %numpy_typemaps_ext(DATA_TYPE, DATA_TYPECODE, DIM_TYPE)
 
+/* NOTE: the number of rows and the leading dimension of the 2D arrays are
+   int64_t, the type of PRIMME_INT when built with PRIMME_INT_SIZE=64, so
+   that vectors longer than 2^31 rows can be passed to the callbacks */
+
 /* Typemap suite for (DIM_TYPE DIM1, DIM_TYPE DIM2, DATA_TYPE* IN_FARRAY2D)
    See description of ARGOUTVIEW_FARRAY2 in numpy.i
  */
 %typemap(directorin,
          fragment="NumPy_Backward_Compatibility,NumPy_Array_Requirements_extra,NumPy_Fragments")
-  (DIM_TYPE DIM1, DIM_TYPE DIM2, DIM_TYPE LD, DATA_TYPE* IN_FARRAY2D)
+  (int64_t DIM1, int DIM2, int64_t LD, DATA_TYPE* IN_FARRAY2D)
 {
   npy_intp dims[2] = { $1, $2 };
   PyObject* obj = PyArray_SimpleNewFromData(2, dims, DATA_TYPECODE, (void*)($4));
@@ -216,18 +245,18 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
  */
 %typecheck(SWIG_TYPECHECK_DOUBLE_ARRAY,
            fragment="NumPy_Macros")
-  (DIM_TYPE DIM1, DIM_TYPE DIM2, DIM_TYPE LD, DATA_TYPE* OUT_FARRAY2D)
+  (int64_t DIM1, int DIM2, int64_t LD, DATA_TYPE* OUT_FARRAY2D)
 {
   $1 = is_array($input) && PyArray_EquivTypenums(array_type($input),
                                                  DATA_TYPECODE);
 }
 %typemap(in,numinputs=0)
-  (DIM_TYPE DIM1, DIM_TYPE DIM2, DIM_TYPE LD, DATA_TYPE* OUT_FARRAY2D)
+  (int64_t DIM1, int DIM2, int64_t LD, DATA_TYPE* OUT_FARRAY2D)
 { $1 = $2 = $3 = 0; }
 
 %typemap(directorargout,
          fragment="NumPy_Fragments")
-  (DIM_TYPE DIM1, DIM_TYPE DIM2, DIM_TYPE LD, DATA_TYPE* OUT_FARRAY2D)
+  (int64_t DIM1, int DIM2, int64_t LD, DATA_TYPE* OUT_FARRAY2D)
   (PyArrayObject* array=NULL, PyObject* o=NULL)
 {
   o = $result;
@@ -235,16 +264,17 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
   if (!array || !require_dimensions(array,2) || !require_native(array) ||
         !require_c_or_f_contiguous(array))
      Swig::DirectorMethodException::raise("No valid type for object returned by $symname");
-  if (($1) != (DIM_TYPE) array_size(array,0) ||
-      ($2) != (DIM_TYPE) array_size(array,1))
+  if (($1) != (int64_t) array_size(array,0) ||
+      ($2) != (int) array_size(array,1))
           {Swig::DirectorMethodException::raise("No valid dimensions for object returned by $symname");}
   npy_intp * strides = array_strides(array);
   if (array_is_fortran(array)) {
-    copy_matrix((DATA_TYPE*)array_data(array), ($1), ($2), (DIM_TYPE)(strides[1]/strides[0]), ($4), ($3));
+    copy_matrix((DATA_TYPE*)array_data(array), ($1), ($2),
+          ($2) > 1 ? (int64_t)(strides[1]/strides[0]) : ($1), ($4), ($3));
   } else {
       DATA_TYPE *x = (DATA_TYPE*)array_data(array);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<($1); i++)
+      for (npy_intp i=0; i<($1); i++)
          for (int j=0; j<($2); j++)
             ($4)[i+j*($3)] = x[i*ldx+j];
   }
@@ -329,22 +359,22 @@ __all__ = ['PrimmeParams', 'sprimme', 'cprimme', 'dprimme', 'zprimme', 'eigsh',
    (int len1SvecsLeft, int len2SvecsLeft, std::complex<float>* svecsLeft),
    (int len1SvecsRight, int len2SvecsRight, std::complex<float>* svecsRight)};
 
-%apply (int DIM1, int DIM2, int LD, double* IN_FARRAY2D) {
-   (int len1YD, int len2YD, int ldYD, double* yd)};
-%apply (int DIM1, int DIM2, int LD, float* IN_FARRAY2D) {
-   (int len1YD, int len2YD, int ldYD, float* yd)};
-%apply (int DIM1, int DIM2, int LD, double* OUT_FARRAY2D) {
-   (int len1XD, int len2XD, int ldXD, double* xd)};
-%apply (int DIM1, int DIM2, int LD, float* OUT_FARRAY2D) {
-   (int len1XD, int len2XD, int ldXD, float* xd)};
-%apply (int DIM1, int DIM2, int LD, std::complex<double>* IN_FARRAY2D) {
-   (int len1YD, int len2YD, int ldYD, std::complex<double>* yd)};
-%apply (int DIM1, int DIM2, int LD, std::complex<float>* IN_FARRAY2D) {
-   (int len1YD, int len2YD, int ldYD, std::complex<float>* yd)};
-%apply (int DIM1, int DIM2, int LD, std::complex<double>* OUT_FARRAY2D) {
-   (int len1XD, int len2XD, int ldXD, std::complex<double>* xd)};
-%apply (int DIM1, int DIM2, int LD, std::complex<float>* OUT_FARRAY2D) {
-   (int len1XD, int len2XD, int ldXD, std::complex<float>* xd)};
+%apply (int64_t DIM1, int DIM2, int64_t LD, double* IN_FARRAY2D) {
+   (PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, double* yd)};
+%apply (int64_t DIM1, int DIM2, int64_t LD, float* IN_FARRAY2D) {
+   (PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, float* yd)};
+%apply (int64_t DIM1, int DIM2, int64_t LD, double* OUT_FARRAY2D) {
+   (PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, double* xd)};
+%apply (int64_t DIM1, int DIM2, int64_t LD, float* OUT_FARRAY2D) {
+   (PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, float* xd)};
+%apply (int64_t DIM1, int DIM2, int64_t LD, std::complex<double>* IN_FARRAY2D) {
+   (PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, std::complex<double>* yd)};
+%apply (int64_t DIM1, int DIM2, int64_t LD, std::complex<float>* IN_FARRAY2D) {
+   (PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, std::complex<float>* yd)};
+%apply (int64_t DIM1, int DIM2, int64_t LD, std::complex<double>* OUT_FARRAY2D) {
+   (PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, std::complex<double>* xd)};
+%apply (int64_t DIM1, int DIM2, int64_t LD, std::complex<float>* OUT_FARRAY2D) {
+   (PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, std::complex<float>* xd)};
 
 /* typemaps for targetShift and numTargetShifts */
  
@@ -440,18 +470,92 @@ static int tprimme(double *evals, std::complex<double> *evecs, double *resNorms,
       return zprimme(evals, evecs, resNorms, primme);
 }
 
+template <typename T>
+struct NumpyType {};
+template <>
+struct NumpyType<float> { enum { code = NPY_FLOAT }; };
+template <>
+struct NumpyType<std::complex<float> > { enum { code = NPY_CFLOAT }; };
+template <>
+struct NumpyType<double> { enum { code = NPY_DOUBLE }; };
+template <>
+struct NumpyType<std::complex<double> > { enum { code = NPY_CDOUBLE }; };
+
+/* Return a writable Fortran-ordered NumPy view of the m x n matrix x */
+
+template <typename T>
+static PyObject *fortran_view(PRIMME_INT m, int n, PRIMME_INT ldx, T *x) {
+    npy_intp dims[2] = {m, n};
+    npy_intp strides[2] = {(npy_intp)sizeof(T), (npy_intp)sizeof(T)*ldx};
+    return PyArray_New(&PyArray_Type, 2, dims, NumpyType<T>::code, strides,
+          (void*)x, 0, NPY_ARRAY_FARRAY, NULL);
+}
+
+/* Call self.matvec(X, out=Y), or self.matvec(X, transpose, out=Y) if       */
+/* transpose is not NULL, where X and Y are views of x and y. The callback */
+/* writes the product directly into PRIMME's buffer.                       */
+
+template <typename T>
+static void matvec_out(Swig::Director *director, PRIMME_INT m, int n, PRIMME_INT ldx, T *x,
+      PRIMME_INT my, PRIMME_INT ldy, T *y, int *transpose) {
+    if (!director)
+        Swig::DirectorMethodException::raise("matvec_out_set requires matvec to be defined in Python");
+    swig::SwigVar_PyObject X = fortran_view(m, n, ldx, x);
+    swig::SwigVar_PyObject Y = fortran_view(my, n, ldy, y);
+    if (!X || !Y)
+        throw Swig::DirectorMethodException();
+    swig::SwigVar_PyObject method = PyObject_GetAttrString(director->swig_get_self(), "matvec");
+    swig::SwigVar_PyObject args = transpose ? Py_BuildValue("(Oi)", (PyObject*)X, *transpose)
+                                            : Py_BuildValue("(O)", (PyObject*)X);
+    swig::SwigVar_PyObject kwargs = Py_BuildValue("{s:O}", "out", (PyObject*)Y);
+    if (!method || !args || !kwargs)
+        throw Swig::DirectorMethodException();
+    swig::SwigVar_PyObject result = PyObject_Call(method, args, kwargs);
+    if (!result)
+        throw Swig::DirectorMethodException();
+}
+
+/* Hold the GIL while the callbacks call Python; the solver runs without it */
+
+class GILGuard {
+   PyGILState_STATE state;
+   public:
+   GILGuard() { state = PyGILState_Ensure(); }
+   ~GILGuard() { PyGILState_Release(state); }
+};
+
 template <typename T>
 static void mymatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, struct primme_params *primme, int *ierr) {
     PrimmeParams *pp = static_cast<PrimmeParams*>(primme);
-    pp->matvec((int)primme->nLocal, *blockSize, (int)*ldx, (T*)x, (int)primme->nLocal, *blockSize, (int)*ldy, (T*)y);
     *ierr = 0; 
+    if (pp->sparse.format) {
+       sparse_matvec(&pp->sparse, 0, *blockSize, (T*)x, *ldx, (T*)y, *ldy);
+       return;
+    }
+    GILGuard gil;
+    try {
+       if (pp->matvec_out_set)
+          matvec_out(dynamic_cast<Swig::Director*>(pp), primme->nLocal, *blockSize, *ldx, (T*)x, primme->nLocal, *ldy, (T*)y, (int*)NULL);
+       else
+          pp->matvec(primme->nLocal, *blockSize, *ldx, (T*)x, primme->nLocal, *blockSize, *ldy, (T*)y);
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+    }
 }
 
 template <typename T>
 static void myprevec(void *x, PRIMME_INT *ldx,  void *y, PRIMME_INT *ldy, int *blockSize, struct primme_params *primme, int *ierr) {
     PrimmeParams *pp = static_cast<PrimmeParams*>(primme);
-    pp->prevec((int)primme->nLocal, *blockSize, (int)*ldx, (T*)x, (int)primme->nLocal, *blockSize, (int)*ldy, (T*)y);
-    *ierr = 0; 
+    GILGuard gil;
+    try {
+       pp->prevec(primme->nLocal, *blockSize, *ldx, (T*)x, primme->nLocal, *blockSize, *ldy, (T*)y);
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+       return;
+    }
+    *ierr = 0;
 }
 
 template <typename T>
@@ -464,7 +568,14 @@ struct Real<std::complex<float> > { typedef float type;};
 template <typename T>
 static void myglobalSum(void *sendBuf, void *recvBuf, int *count, struct primme_params *primme, int *ierr) {
     PrimmeParams *pp = static_cast<PrimmeParams*>(primme);
-    pp->globalSum(*count, static_cast<typename Real<T>::type*>(sendBuf), *count, static_cast<typename Real<T>::type*>(recvBuf));
+    GILGuard gil;
+    try {
+       pp->globalSum(*count, static_cast<typename Real<T>::type*>(sendBuf), *count, static_cast<typename Real<T>::type*>(recvBuf));
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+       return;
+    }
     *ierr = 0;
 }
 
@@ -475,22 +586,50 @@ static void mymonitorFun(void *basisEvals, int *basisSize, int *basisFlags, int
       int *inner_its, void *LSRes, primme_event *event, struct primme_params *primme, int *ierr)
 {
     PrimmeParams *pp = static_cast<PrimmeParams*>(primme);
-    pp->mon(
-            basisSize?*basisSize:0, static_cast<typename Real<T>::type*>(basisEvals),
-            basisFlags?*basisSize:0, basisFlags,
-            blockSize?*blockSize:0, iblock,
-            basisNorms?*basisSize:0, static_cast<typename Real<T>::type*>(basisNorms),
-            numConverged?*numConverged:-1,
-            numLocked?*numLocked:0, static_cast<typename Real<T>::type*>(lockedEvals),
-            lockedFlags?*numLocked:0, lockedFlags,
-            lockedNorms?*numLocked:0, static_cast<typename Real<T>::type*>(lockedNorms),
-            inner_its?*inner_its:-1,
-            LSRes?*static_cast<typename Real<T>::type*>(LSRes):static_cast<typename Real<T>::type>(-1.0),
-            (int)*event); 
+    GILGuard gil;
+    try {
+       pp->mon(
+               basisSize?*basisSize:0, static_cast<typename Real<T>::type*>(basisEvals),
+               basisFlags?*basisSize:0, basisFlags,
+               blockSize?*blockSize:0, iblock,
+               basisNorms?*basisSize:0, static_cast<typename Real<T>::type*>(basisNorms),
+               numConverged?*numConverged:-1,
+               numLocked?*numLocked:0, static_cast<typename Real<T>::type*>(lockedEvals),
+               lockedFlags?*numLocked:0, lockedFlags,
+               lockedNorms?*numLocked:0, static_cast<typename Real<T>::type*>(lockedNorms),
+               inner_its?*inner_its:-1,
+               LSRes?*static_cast<typename Real<T>::type*>(LSRes):static_cast<typename Real<T>::type>(-1.0),
+               (int)*event);
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+       return;
+    }
     *ierr = 0;
 }
 
 
+/* Check that the sparse matrix set with _set_sparse_matrix, if any, has */
+/* the dimensions and the scalar type of the problem                    */
+
+template <typename T>
+static bool check_sparse_matrix(const SparseMatrix *A, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT mLocal, PRIMME_INT nLocal) {
+   if (!A->format) return true;
+   if (A->m != m || A->n != n || mLocal != m || nLocal != n) {
+        PyErr_Format(PyExc_ValueError,
+                     "The sparse matrix should have size (%" PRIMME_INT_P ", %" PRIMME_INT_P ") and not be distributed",
+                     m, n);
+        return false;
+   }
+   if (A->dataType != NumpyType<T>::code) {
+        PyErr_Format(PyExc_ValueError,
+                     "The type of the sparse matrix entries should be the same as `evecs'");
+        return false;
+   }
+   return true;
+}
+
 template <typename T, typename R>
 int my_primme(int lenEvals, R *evals,
             int len1Evecs, int len2Evecs, T *evecs,
@@ -516,6 +655,8 @@ int my_primme(int lenEvals, R *evals,
                      primme->numEvals);
         return -32;
    }
+   if (!check_sparse_matrix<T>(&primme->sparse, primme->n, primme->n, primme->nLocal, primme->nLocal))
+        return -7;
    primme->matrixMatvec = mymatvec<T>;
    if (primme->correctionParams.precondition) 
       primme->applyPreconditioner = myprevec<T>;
@@ -523,7 +664,12 @@ int my_primme(int lenEvals, R *evals,
       primme->globalSumReal = myglobalSum<T>;
    if (primme->monitor_set)
       primme->monitorFun = mymonitorFun<T>;
-   int ret = tprimme(evals, evecs, resNorms, static_cast<primme_params*>(primme));
+   int ret;
+   /* The callbacks acquire the GIL only while they call Python. If one */
+   /* fails, the Python error is raised when tprimme returns            */
+   Py_BEGIN_ALLOW_THREADS
+   ret = tprimme(evals, evecs, resNorms, static_cast<primme_params*>(primme));
+   Py_END_ALLOW_THREADS
    return ret;
 }
 
@@ -543,7 +689,14 @@ static int tprimme_svds(double *svals, std::complex<double> *svecs, double *resN
 template <typename T>
 static void myglobalSum_svds(void *sendBuf, void *recvBuf, int *count, struct primme_svds_params *primme_svds, int *ierr) {
     PrimmeSvdsParams *pp = static_cast<PrimmeSvdsParams*>(primme_svds);
-    pp->globalSum(*count, static_cast<typename Real<T>::type*>(sendBuf), *count, static_cast<typename Real<T>::type*>(recvBuf));
+    GILGuard gil;
+    try {
+       pp->globalSum(*count, static_cast<typename Real<T>::type*>(sendBuf), *count, static_cast<typename Real<T>::type*>(recvBuf));
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+       return;
+    }
     *ierr = 0;
 }
 
@@ -559,8 +712,21 @@ static void mymatvec_svds(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, in
       n = primme_svds->mLocal;
       m = primme_svds->nLocal;
    }
-   pp->matvec((int)n, *blockSize, (int)*ldx, (T*)x, (int)m, *blockSize, (int)*ldy, (T*)y, *transpose);
    *ierr = 0;
+   if (pp->sparse.format) {
+      sparse_matvec(&pp->sparse, *transpose, *blockSize, (T*)x, *ldx, (T*)y, *ldy);
+      return;
+   }
+   GILGuard gil;
+   try {
+      if (pp->matvec_out_set)
+         matvec_out(dynamic_cast<Swig::Director*>(pp), n, *blockSize, *ldx, (T*)x, m, *ldy, (T*)y, transpose);
+      else
+         pp->matvec(n, *blockSize, *ldx, (T*)x, m, *blockSize, *ldy, (T*)y, *transpose);
+   }
+   catch (Swig::DirectorException &e) {
+      *ierr = -1;
+   }
 }
 
 template <typename T>
@@ -574,7 +740,14 @@ static void myprevec_svds(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, in
    } else if (*mode == primme_svds_op_augmented) {
       m = primme_svds->mLocal + primme_svds->nLocal;
    }
-   pp->prevec((int)m, *blockSize, (int)*ldx, (T*)x, (int)m, *blockSize, (int)*ldy, (T*)y, *mode);
+   GILGuard gil;
+   try {
+      pp->prevec(m, *blockSize, *ldx, (T*)x, m, *blockSize, *ldy, (T*)y, *mode);
+   }
+   catch (Swig::DirectorException &e) {
+      *ierr = -1;
+      return;
+   }
    *ierr = 0;
 }
 
@@ -584,19 +757,26 @@ static void mymonitorFun_svds(void *basisEvals, int *basisSize, int *basisFlags,
       int *inner_its, void *LSRes, primme_event *event, int *stage, struct primme_svds_params *primme_svds, int *ierr)
 {
     PrimmeSvdsParams *pp = static_cast<PrimmeSvdsParams*>(primme_svds);
-    pp->mon(
-            basisSize?*basisSize:0, static_cast<typename Real<T>::type*>(basisEvals),
-            basisFlags?*basisSize:0, basisFlags,
-            blockSize?*blockSize:0, iblock,
-            basisNorms?*basisSize:0, static_cast<typename Real<T>::type*>(basisNorms),
-            numConverged?*numConverged:-1,
-            numLocked?*numLocked:0, static_cast<typename Real<T>::type*>(lockedEvals),
-            lockedFlags?*numLocked:0, lockedFlags,
-            lockedNorms?*numLocked:0, static_cast<typename Real<T>::type*>(lockedNorms),
-            inner_its?*inner_its:-1,
-            LSRes?*static_cast<typename Real<T>::type*>(LSRes):static_cast<typename Real<T>::type>(-1.0),
-            (int)*event,
-            *stage); 
+    GILGuard gil;
+    try {
+       pp->mon(
+               basisSize?*basisSize:0, static_cast<typename Real<T>::type*>(basisEvals),
+               basisFlags?*basisSize:0, basisFlags,
+               blockSize?*blockSize:0, iblock,
+               basisNorms?*basisSize:0, static_cast<typename Real<T>::type*>(basisNorms),
+               numConverged?*numConverged:-1,
+               numLocked?*numLocked:0, static_cast<typename Real<T>::type*>(lockedEvals),
+               lockedFlags?*numLocked:0, lockedFlags,
+               lockedNorms?*numLocked:0, static_cast<typename Real<T>::type*>(lockedNorms),
+               inner_its?*inner_its:-1,
+               LSRes?*static_cast<typename Real<T>::type*>(LSRes):static_cast<typename Real<T>::type>(-1.0),
+               (int)*event,
+               *stage);
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+       return;
+    }
     *ierr = 0;
 }
 
@@ -635,6 +815,8 @@ int my_primme_svds(int lenSvals, R *svals,
                      primme_svds->numSvals);
         return -32;
    }
+   if (!check_sparse_matrix<T>(&primme_svds->sparse, primme_svds->m, primme_svds->n, primme_svds->mLocal, primme_svds->nLocal))
+        return -7;
    primme_svds->matrixMatvec = mymatvec_svds<T>;
    if (primme_svds->precondition) 
       primme_svds->applyPreconditioner = myprevec_svds<T>;
@@ -648,7 +830,10 @@ int my_primme_svds(int lenSvals, R *svals,
    copy_matrix(svecsRight, primme_svds->nLocal, primme_svds->numOrthoConst,
          (PRIMME_INT)len1SvecsRight, &svecs[primme_svds->numOrthoConst*primme_svds->mLocal],
          primme_svds->nLocal);
-   int ret = tprimme_svds(svals, svecs, resNorms, static_cast<primme_svds_params*>(primme_svds));
+   int ret;
+   Py_BEGIN_ALLOW_THREADS
+   ret = tprimme_svds(svals, svecs, resNorms, static_cast<primme_svds_params*>(primme_svds));
+   Py_END_ALLOW_THREADS
    copy_matrix(&svecs[primme_svds->mLocal*primme_svds->numOrthoConst],
          primme_svds->mLocal, primme_svds->numSvals,
          primme_svds->mLocal, &svecsLeft[len1SvecsLeft*primme_svds->numOrthoConst], (PRIMME_INT)len1SvecsLeft);
@@ -662,6 +847,123 @@ int my_primme_svds(int lenSvals, R *svals,
 }
 %}
 
+%{
+/* Set the matrix of the products from the buffers of a scipy.sparse CSR */
+/* (format 1) or CSC (format 2) matrix; format 0 unsets the matrix. The  */
+/* caller should keep the arrays alive while the matrix is in use.       */
+
+static void set_sparse_matrix(SparseMatrix *A, int format, PRIMME_INT m,
+      PRIMME_INT n, PyObject *indptr, PyObject *indices, PyObject *data) {
+   A->format = 0;
+   if (format == 0) return;
+   if (format != 1 && format != 2)
+      throw std::invalid_argument("format should be 0, 1 (CSR) or 2 (CSC)");
+   PyObject *arrays[3] = {indptr, indices, data};
+   for (int i=0; i<3; i++) {
+      if (!PyArray_Check(arrays[i]) || PyArray_NDIM((PyArrayObject*)arrays[i]) != 1
+            || !PyArray_ISCARRAY_RO((PyArrayObject*)arrays[i]))
+         throw std::invalid_argument("indptr, indices and data should be contiguous one-dimensional arrays");
+   }
+   int itype = PyArray_TYPE((PyArrayObject*)indptr);
+   if (itype != PyArray_TYPE((PyArrayObject*)indices) || (itype != NPY_INT32 && itype != NPY_INT64))
+      throw std::invalid_argument("indptr and indices should be both int32 or int64 arrays");
+   PRIMME_INT nptr = format == 1 ? m : n;
+   if (PyArray_SIZE((PyArrayObject*)indptr) != nptr+1)
+      throw std::invalid_argument("Length of indptr does not match the dimensions of the matrix");
+   void *p = PyArray_DATA((PyArrayObject*)indptr);
+   PRIMME_INT nnz = itype == NPY_INT32 ? ((int32_t*)p)[nptr] : ((int64_t*)p)[nptr];
+   if (PyArray_SIZE((PyArrayObject*)indices) < nnz || PyArray_SIZE((PyArrayObject*)data) < nnz)
+      throw std::invalid_argument("indices and data are shorter than indptr indicates");
+
+   A->m = m;
+   A->n = n;
+   A->indexSize = itype == NPY_INT32 ? 4 : 8;
+   A->dataType = PyArray_TYPE((PyArrayObject*)data);
+   A->indptr = p;
+   A->indices = PyArray_DATA((PyArrayObject*)indices);
+   A->data = PyArray_DATA((PyArrayObject*)data);
+   A->format = format;
+}
+
+/* Open monitorStream with a consumer thread that appends the records to a */
+/* MonitorBuffer; the records are popped with pop_monitor_records          */
+
+static void open_monitor_stream(primme_monitor_stream **stream,
+      MonitorBuffer **buffer, int capacity) {
+   if (*buffer) {
+      PyErr_SetString(PyExc_RuntimeError, "The monitor stream is already open");
+      return;
+   }
+   *buffer = new MonitorBuffer;
+   if (primme_monitor_stream_open(capacity, MonitorBuffer::sink, *buffer,
+            stream) != 0) {
+      delete *buffer;
+      *buffer = NULL;
+      PyErr_SetString(PyExc_RuntimeError, "Failed to open the monitor stream");
+   }
+}
+
+/* Return the records gathered so far as bytes, and remove them */
+
+static PyObject *pop_monitor_records(MonitorBuffer *buffer) {
+   if (!buffer) return PyBytes_FromStringAndSize(NULL, 0);
+   std::vector<primme_monitor_record> records;
+   {
+      std::lock_guard<std::mutex> lock(buffer->mutex);
+      records.swap(buffer->records);
+   }
+   return PyBytes_FromStringAndSize((const char*)records.data(),
+         (Py_ssize_t)(records.size()*sizeof(primme_monitor_record)));
+}
+
+/* Stop the consumer thread after passing it the pending records; return   */
+/* the records left and the number of records dropped                      */
+
+static PyObject *close_monitor_stream(primme_monitor_stream **stream,
+      MonitorBuffer **buffer) {
+   PRIMME_INT dropped = 0;
+   if (!*buffer) return Py_BuildValue("(NL)", pop_monitor_records(NULL), 0LL);
+   Py_BEGIN_ALLOW_THREADS
+   primme_monitor_stream_close(*stream, &dropped);
+   Py_END_ALLOW_THREADS
+   *stream = NULL;
+   PyObject *records = pop_monitor_records(*buffer);
+   delete *buffer;
+   *buffer = NULL;
+   return Py_BuildValue("(NL)", records, (long long)dropped);
+}
+%}
+
+%extend PrimmeParams {
+   void _set_sparse_matrix(int format, PyObject *indptr, PyObject *indices, PyObject *data) {
+      set_sparse_matrix(&$self->sparse, format, $self->n, $self->n, indptr, indices, data);
+   }
+   void _open_monitor_stream(int capacity) {
+      open_monitor_stream(&$self->monitorStream, &$self->monitorBuffer, capacity);
+   }
+   PyObject *_pop_monitor_records() {
+      return pop_monitor_records($self->monitorBuffer);
+   }
+   PyObject *_close_monitor_stream() {
+      return close_monitor_stream(&$self->monitorStream, &$self->monitorBuffer);
+   }
+}
+
+%extend PrimmeSvdsParams {
+   void _set_sparse_matrix(int format, PyObject *indptr, PyObject *indices, PyObject *data) {
+      set_sparse_matrix(&$self->sparse, format, $self->m, $self->n, indptr, indices, data);
+   }
+   void _open_monitor_stream(int capacity) {
+      open_monitor_stream(&$self->monitorStream, &$self->monitorBuffer, capacity);
+   }
+   PyObject *_pop_monitor_records() {
+      return pop_monitor_records($self->monitorBuffer);
+   }
+   PyObject *_close_monitor_stream() {
+      return close_monitor_stream(&$self->monitorStream, &$self->monitorBuffer);
+   }
+}
+
 %template (sprimme) my_primme<float,float>;
 %template (cprimme) my_primme<std::complex<float>,float>;
 %template (dprimme) my_primme<double,double>;
@@ -3667,18 +3667,92 @@ static int tprimme(double *evals, std::complex<double> *evecs, double *resNorms,
       return zprimme(evals, evecs, resNorms, primme);
 }
 
+template <typename T>
+struct NumpyType {};
+template <>
+struct NumpyType<float> { enum { code = NPY_FLOAT }; };
+template <>
+struct NumpyType<std::complex<float> > { enum { code = NPY_CFLOAT }; };
+template <>
+struct NumpyType<double> { enum { code = NPY_DOUBLE }; };
+template <>
+struct NumpyType<std::complex<double> > { enum { code = NPY_CDOUBLE }; };
+
+/* Return a writable Fortran-ordered NumPy view of the m x n matrix x */
+
+template <typename T>
+static PyObject *fortran_view(PRIMME_INT m, int n, PRIMME_INT ldx, T *x) {
+    npy_intp dims[2] = {m, n};
+    npy_intp strides[2] = {(npy_intp)sizeof(T), (npy_intp)sizeof(T)*ldx};
+    return PyArray_New(&PyArray_Type, 2, dims, NumpyType<T>::code, strides,
+          (void*)x, 0, NPY_ARRAY_FARRAY, NULL);
+}
+
+/* Call self.matvec(X, out=Y), or self.matvec(X, transpose, out=Y) if       */
+/* transpose is not NULL, where X and Y are views of x and y. The callback */
+/* writes the product directly into PRIMME's buffer.                       */
+
+template <typename T>
+static void matvec_out(Swig::Director *director, PRIMME_INT m, int n, PRIMME_INT ldx, T *x,
+      PRIMME_INT my, PRIMME_INT ldy, T *y, int *transpose) {
+    if (!director)
+        Swig::DirectorMethodException::raise("matvec_out_set requires matvec to be defined in Python");
+    swig::SwigVar_PyObject X = fortran_view(m, n, ldx, x);
+    swig::SwigVar_PyObject Y = fortran_view(my, n, ldy, y);
+    if (!X || !Y)
+        throw Swig::DirectorMethodException();
+    swig::SwigVar_PyObject method = PyObject_GetAttrString(director->swig_get_self(), "matvec");
+    swig::SwigVar_PyObject args = transpose ? Py_BuildValue("(Oi)", (PyObject*)X, *transpose)
+                                            : Py_BuildValue("(O)", (PyObject*)X);
+    swig::SwigVar_PyObject kwargs = Py_BuildValue("{s:O}", "out", (PyObject*)Y);
+    if (!method || !args || !kwargs)
+        throw Swig::DirectorMethodException();
+    swig::SwigVar_PyObject result = PyObject_Call(method, args, kwargs);
+    if (!result)
+        throw Swig::DirectorMethodException();
+}
+
+/* Hold the GIL while the callbacks call Python; the solver runs without it */
+
+class GILGuard {
+   PyGILState_STATE state;
+   public:
+   GILGuard() { state = PyGILState_Ensure(); }
+   ~GILGuard() { PyGILState_Release(state); }
+};
+
 template <typename T>
 static void mymatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, struct primme_params *primme, int *ierr) {
     PrimmeParams *pp = static_cast<PrimmeParams*>(primme);
-    pp->matvec((int)primme->nLocal, *blockSize, (int)*ldx, (T*)x, (int)primme->nLocal, *blockSize, (int)*ldy, (T*)y);
     *ierr = 0; 
+    if (pp->sparse.format) {
+       sparse_matvec(&pp->sparse, 0, *blockSize, (T*)x, *ldx, (T*)y, *ldy);
+       return;
+    }
+    GILGuard gil;
+    try {
+       if (pp->matvec_out_set)
+          matvec_out(dynamic_cast<Swig::Director*>(pp), primme->nLocal, *blockSize, *ldx, (T*)x, primme->nLocal, *ldy, (T*)y, (int*)NULL);
+       else
+          pp->matvec(primme->nLocal, *blockSize, *ldx, (T*)x, primme->nLocal, *blockSize, *ldy, (T*)y);
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+    }
 }
 
 template <typename T>
 static void myprevec(void *x, PRIMME_INT *ldx,  void *y, PRIMME_INT *ldy, int *blockSize, struct primme_params *primme, int *ierr) {
     PrimmeParams *pp = static_cast<PrimmeParams*>(primme);
-    pp->prevec((int)primme->nLocal, *blockSize, (int)*ldx, (T*)x, (int)primme->nLocal, *blockSize, (int)*ldy, (T*)y);
-    *ierr = 0; 
+    GILGuard gil;
+    try {
+       pp->prevec(primme->nLocal, *blockSize, *ldx, (T*)x, primme->nLocal, *blockSize, *ldy, (T*)y);
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+       return;
+    }
+    *ierr = 0;
 }
 
 template <typename T>
@@ -3691,7 +3765,14 @@ struct Real<std::complex<float> > { typedef float type;};
 template <typename T>
 static void myglobalSum(void *sendBuf, void *recvBuf, int *count, struct primme_params *primme, int *ierr) {
     PrimmeParams *pp = static_cast<PrimmeParams*>(primme);
-    pp->globalSum(*count, static_cast<typename Real<T>::type*>(sendBuf), *count, static_cast<typename Real<T>::type*>(recvBuf));
+    GILGuard gil;
+    try {
+       pp->globalSum(*count, static_cast<typename Real<T>::type*>(sendBuf), *count, static_cast<typename Real<T>::type*>(recvBuf));
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+       return;
+    }
     *ierr = 0;
 }
 
@@ -3702,22 +3783,50 @@ static void mymonitorFun(void *basisEvals, int *basisSize, int *basisFlags, int
       int *inner_its, void *LSRes, primme_event *event, struct primme_params *primme, int *ierr)
 {
     PrimmeParams *pp = static_cast<PrimmeParams*>(primme);
-    pp->mon(
-            basisSize?*basisSize:0, static_cast<typename Real<T>::type*>(basisEvals),
-            basisFlags?*basisSize:0, basisFlags,
-            blockSize?*blockSize:0, iblock,
-            basisNorms?*basisSize:0, static_cast<typename Real<T>::type*>(basisNorms),
-            numConverged?*numConverged:-1,
-            numLocked?*numLocked:0, static_cast<typename Real<T>::type*>(lockedEvals),
-            lockedFlags?*numLocked:0, lockedFlags,
-            lockedNorms?*numLocked:0, static_cast<typename Real<T>::type*>(lockedNorms),
-            inner_its?*inner_its:-1,
-            LSRes?*static_cast<typename Real<T>::type*>(LSRes):static_cast<typename Real<T>::type>(-1.0),
-            (int)*event); 
+    GILGuard gil;
+    try {
+       pp->mon(
+               basisSize?*basisSize:0, static_cast<typename Real<T>::type*>(basisEvals),
+               basisFlags?*basisSize:0, basisFlags,
+               blockSize?*blockSize:0, iblock,
+               basisNorms?*basisSize:0, static_cast<typename Real<T>::type*>(basisNorms),
+               numConverged?*numConverged:-1,
+               numLocked?*numLocked:0, static_cast<typename Real<T>::type*>(lockedEvals),
+               lockedFlags?*numLocked:0, lockedFlags,
+               lockedNorms?*numLocked:0, static_cast<typename Real<T>::type*>(lockedNorms),
+               inner_its?*inner_its:-1,
+               LSRes?*static_cast<typename Real<T>::type*>(LSRes):static_cast<typename Real<T>::type>(-1.0),
+               (int)*event);
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+       return;
+    }
     *ierr = 0;
 }
 
 
+/* Check that the sparse matrix set with _set_sparse_matrix, if any, has */
+/* the dimensions and the scalar type of the problem                    */
+
+template <typename T>
+static bool check_sparse_matrix(const SparseMatrix *A, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT mLocal, PRIMME_INT nLocal) {
+   if (!A->format) return true;
+   if (A->m != m || A->n != n || mLocal != m || nLocal != n) {
+        PyErr_Format(PyExc_ValueError,
+                     "The sparse matrix should have size (%" PRIMME_INT_P ", %" PRIMME_INT_P ") and not be distributed",
+                     m, n);
+        return false;
+   }
+   if (A->dataType != NumpyType<T>::code) {
+        PyErr_Format(PyExc_ValueError,
+                     "The type of the sparse matrix entries should be the same as `evecs'");
+        return false;
+   }
+   return true;
+}
+
 template <typename T, typename R>
 int my_primme(int lenEvals, R *evals,
             int len1Evecs, int len2Evecs, T *evecs,
@@ -3743,6 +3852,8 @@ int my_primme(int lenEvals, R *evals,
                      primme->numEvals);
         return -32;
    }
+   if (!check_sparse_matrix<T>(&primme->sparse, primme->n, primme->n, primme->nLocal, primme->nLocal))
+        return -7;
    primme->matrixMatvec = mymatvec<T>;
    if (primme->correctionParams.precondition) 
       primme->applyPreconditioner = myprevec<T>;
@@ -3750,7 +3861,12 @@ int my_primme(int lenEvals, R *evals,
       primme->globalSumReal = myglobalSum<T>;
    if (primme->monitor_set)
       primme->monitorFun = mymonitorFun<T>;
-   int ret = tprimme(evals, evecs, resNorms, static_cast<primme_params*>(primme));
+   int ret;
+   /* The callbacks acquire the GIL only while they call Python. If one */
+   /* fails, the Python error is raised when tprimme returns            */
+   Py_BEGIN_ALLOW_THREADS
+   ret = tprimme(evals, evecs, resNorms, static_cast<primme_params*>(primme));
+   Py_END_ALLOW_THREADS
    return ret;
 }
 
@@ -3770,7 +3886,14 @@ static int tprimme_svds(double *svals, std::complex<double> *svecs, double *resN
 template <typename T>
 static void myglobalSum_svds(void *sendBuf, void *recvBuf, int *count, struct primme_svds_params *primme_svds, int *ierr) {
     PrimmeSvdsParams *pp = static_cast<PrimmeSvdsParams*>(primme_svds);
-    pp->globalSum(*count, static_cast<typename Real<T>::type*>(sendBuf), *count, static_cast<typename Real<T>::type*>(recvBuf));
+    GILGuard gil;
+    try {
+       pp->globalSum(*count, static_cast<typename Real<T>::type*>(sendBuf), *count, static_cast<typename Real<T>::type*>(recvBuf));
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+       return;
+    }
     *ierr = 0;
 }
 
@@ -3786,8 +3909,21 @@ static void mymatvec_svds(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, in
       n = primme_svds->mLocal;
       m = primme_svds->nLocal;
    }
-   pp->matvec((int)n, *blockSize, (int)*ldx, (T*)x, (int)m, *blockSize, (int)*ldy, (T*)y, *transpose);
    *ierr = 0;
+   if (pp->sparse.format) {
+      sparse_matvec(&pp->sparse, *transpose, *blockSize, (T*)x, *ldx, (T*)y, *ldy);
+      return;
+   }
+   GILGuard gil;
+   try {
+      if (pp->matvec_out_set)
+         matvec_out(dynamic_cast<Swig::Director*>(pp), n, *blockSize, *ldx, (T*)x, m, *ldy, (T*)y, transpose);
+      else
+         pp->matvec(n, *blockSize, *ldx, (T*)x, m, *blockSize, *ldy, (T*)y, *transpose);
+   }
+   catch (Swig::DirectorException &e) {
+      *ierr = -1;
+   }
 }
 
 template <typename T>
@@ -3801,7 +3937,14 @@ static void myprevec_svds(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, in
    } else if (*mode == primme_svds_op_augmented) {
       m = primme_svds->mLocal + primme_svds->nLocal;
    }
-   pp->prevec((int)m, *blockSize, (int)*ldx, (T*)x, (int)m, *blockSize, (int)*ldy, (T*)y, *mode);
+   GILGuard gil;
+   try {
+      pp->prevec(m, *blockSize, *ldx, (T*)x, m, *blockSize, *ldy, (T*)y, *mode);
+   }
+   catch (Swig::DirectorException &e) {
+      *ierr = -1;
+      return;
+   }
    *ierr = 0;
 }
 
@@ -3811,19 +3954,26 @@ static void mymonitorFun_svds(void *basisEvals, int *basisSize, int *basisFlags,
       int *inner_its, void *LSRes, primme_event *event, int *stage, struct primme_svds_params *primme_svds, int *ierr)
 {
     PrimmeSvdsParams *pp = static_cast<PrimmeSvdsParams*>(primme_svds);
-    pp->mon(
-            basisSize?*basisSize:0, static_cast<typename Real<T>::type*>(basisEvals),
-            basisFlags?*basisSize:0, basisFlags,
-            blockSize?*blockSize:0, iblock,
-            basisNorms?*basisSize:0, static_cast<typename Real<T>::type*>(basisNorms),
-            numConverged?*numConverged:-1,
-            numLocked?*numLocked:0, static_cast<typename Real<T>::type*>(lockedEvals),
-            lockedFlags?*numLocked:0, lockedFlags,
-            lockedNorms?*numLocked:0, static_cast<typename Real<T>::type*>(lockedNorms),
-            inner_its?*inner_its:-1,
-            LSRes?*static_cast<typename Real<T>::type*>(LSRes):static_cast<typename Real<T>::type>(-1.0),
-            (int)*event,
-            *stage); 
+    GILGuard gil;
+    try {
+       pp->mon(
+               basisSize?*basisSize:0, static_cast<typename Real<T>::type*>(basisEvals),
+               basisFlags?*basisSize:0, basisFlags,
+               blockSize?*blockSize:0, iblock,
+               basisNorms?*basisSize:0, static_cast<typename Real<T>::type*>(basisNorms),
+               numConverged?*numConverged:-1,
+               numLocked?*numLocked:0, static_cast<typename Real<T>::type*>(lockedEvals),
+               lockedFlags?*numLocked:0, lockedFlags,
+               lockedNorms?*numLocked:0, static_cast<typename Real<T>::type*>(lockedNorms),
+               inner_its?*inner_its:-1,
+               LSRes?*static_cast<typename Real<T>::type*>(LSRes):static_cast<typename Real<T>::type>(-1.0),
+               (int)*event,
+               *stage);
+    }
+    catch (Swig::DirectorException &e) {
+       *ierr = -1;
+       return;
+    }
     *ierr = 0;
 }
 
@@ -3862,6 +4012,8 @@ int my_primme_svds(int lenSvals, R *svals,
                      primme_svds->numSvals);
         return -32;
    }
+   if (!check_sparse_matrix<T>(&primme_svds->sparse, primme_svds->m, primme_svds->n, primme_svds->mLocal, primme_svds->nLocal))
+        return -7;
    primme_svds->matrixMatvec = mymatvec_svds<T>;
    if (primme_svds->precondition) 
       primme_svds->applyPreconditioner = myprevec_svds<T>;
@@ -3875,7 +4027,10 @@ int my_primme_svds(int lenSvals, R *svals,
    copy_matrix(svecsRight, primme_svds->nLocal, primme_svds->numOrthoConst,
          (PRIMME_INT)len1SvecsRight, &svecs[primme_svds->numOrthoConst*primme_svds->mLocal],
          primme_svds->nLocal);
-   int ret = tprimme_svds(svals, svecs, resNorms, static_cast<primme_svds_params*>(primme_svds));
+   int ret;
+   Py_BEGIN_ALLOW_THREADS
+   ret = tprimme_svds(svals, svecs, resNorms, static_cast<primme_svds_params*>(primme_svds));
+   Py_END_ALLOW_THREADS
    copy_matrix(&svecs[primme_svds->mLocal*primme_svds->numOrthoConst],
          primme_svds->mLocal, primme_svds->numSvals,
          primme_svds->mLocal, &svecsLeft[len1SvecsLeft*primme_svds->numOrthoConst], (PRIMME_INT)len1SvecsLeft);
@@ -4863,7 +5018,7 @@ SWIG_AsCharPtrAndSize(PyObject *obj, char** cptr, size_t* psize, int *alloc)
    * set the Fortran ordering flag and recompute the strides.
    * NOTE: based on require_fortran in numpy.i
    */
-  int require_fortran2(PyArrayObject* ary, int ld)
+  int require_fortran2(PyArrayObject* ary, npy_intp ld)
   {
     int success = 1;
     if (array_numdims(ary) != 2) return 0;
@@ -4944,6 +5099,116 @@ SWIG_From_float  (float value)
 
 
 
+/* Set the matrix of the products from the buffers of a scipy.sparse CSR */
+/* (format 1) or CSC (format 2) matrix; format 0 unsets the matrix. The  */
+/* caller should keep the arrays alive while the matrix is in use.       */
+
+static void set_sparse_matrix(SparseMatrix *A, int format, PRIMME_INT m,
+      PRIMME_INT n, PyObject *indptr, PyObject *indices, PyObject *data) {
+   A->format = 0;
+   if (format == 0) return;
+   if (format != 1 && format != 2)
+      throw std::invalid_argument("format should be 0, 1 (CSR) or 2 (CSC)");
+   PyObject *arrays[3] = {indptr, indices, data};
+   for (int i=0; i<3; i++) {
+      if (!PyArray_Check(arrays[i]) || PyArray_NDIM((PyArrayObject*)arrays[i]) != 1
+            || !PyArray_ISCARRAY_RO((PyArrayObject*)arrays[i]))
+         throw std::invalid_argument("indptr, indices and data should be contiguous one-dimensional arrays");
+   }
+   int itype = PyArray_TYPE((PyArrayObject*)indptr);
+   if (itype != PyArray_TYPE((PyArrayObject*)indices) || (itype != NPY_INT32 && itype != NPY_INT64))
+      throw std::invalid_argument("indptr and indices should be both int32 or int64 arrays");
+   PRIMME_INT nptr = format == 1 ? m : n;
+   if (PyArray_SIZE((PyArrayObject*)indptr) != nptr+1)
+      throw std::invalid_argument("Length of indptr does not match the dimensions of the matrix");
+   void *p = PyArray_DATA((PyArrayObject*)indptr);
+   PRIMME_INT nnz = itype == NPY_INT32 ? ((int32_t*)p)[nptr] : ((int64_t*)p)[nptr];
+   if (PyArray_SIZE((PyArrayObject*)indices) < nnz || PyArray_SIZE((PyArrayObject*)data) < nnz)
+      throw std::invalid_argument("indices and data are shorter than indptr indicates");
+
+   A->m = m;
+   A->n = n;
+   A->indexSize = itype == NPY_INT32 ? 4 : 8;
+   A->dataType = PyArray_TYPE((PyArrayObject*)data);
+   A->indptr = p;
+   A->indices = PyArray_DATA((PyArrayObject*)indices);
+   A->data = PyArray_DATA((PyArrayObject*)data);
+   A->format = format;
+}
+
+/* Open monitorStream with a consumer thread that appends the records to a */
+/* MonitorBuffer; the records are popped with pop_monitor_records          */
+
+static void open_monitor_stream(primme_monitor_stream **stream,
+      MonitorBuffer **buffer, int capacity) {
+   if (*buffer) {
+      PyErr_SetString(PyExc_RuntimeError, "The monitor stream is already open");
+      return;
+   }
+   *buffer = new MonitorBuffer;
+   if (primme_monitor_stream_open(capacity, MonitorBuffer::sink, *buffer,
+            stream) != 0) {
+      delete *buffer;
+      *buffer = NULL;
+      PyErr_SetString(PyExc_RuntimeError, "Failed to open the monitor stream");
+   }
+}
+
+/* Return the records gathered so far as bytes, and remove them */
+
+static PyObject *pop_monitor_records(MonitorBuffer *buffer) {
+   if (!buffer) return PyBytes_FromStringAndSize(NULL, 0);
+   std::vector<primme_monitor_record> records;
+   {
+      std::lock_guard<std::mutex> lock(buffer->mutex);
+      records.swap(buffer->records);
+   }
+   return PyBytes_FromStringAndSize((const char*)records.data(),
+         (Py_ssize_t)(records.size()*sizeof(primme_monitor_record)));
+}
+
+/* Stop the consumer thread after passing it the pending records; return   */
+/* the records left and the number of records dropped                      */
+
+static PyObject *close_monitor_stream(primme_monitor_stream **stream,
+      MonitorBuffer **buffer) {
+   PRIMME_INT dropped = 0;
+   if (!*buffer) return Py_BuildValue("(NL)", pop_monitor_records(NULL), 0LL);
+   Py_BEGIN_ALLOW_THREADS
+   primme_monitor_stream_close(*stream, &dropped);
+   Py_END_ALLOW_THREADS
+   *stream = NULL;
+   PyObject *records = pop_monitor_records(*buffer);
+   delete *buffer;
+   *buffer = NULL;
+   return Py_BuildValue("(NL)", records, (long long)dropped);
+}
+
+SWIGINTERN void PrimmeParams__set_sparse_matrix(PrimmeParams *self,int format,PyObject *indptr,PyObject *indices,PyObject *data){
+      set_sparse_matrix(&self->sparse, format, self->n, self->n, indptr, indices, data);
+   }
+SWIGINTERN void PrimmeParams__open_monitor_stream(PrimmeParams *self,int capacity){
+      open_monitor_stream(&self->monitorStream, &self->monitorBuffer, capacity);
+   }
+SWIGINTERN PyObject *PrimmeParams__pop_monitor_records(PrimmeParams *self){
+      return pop_monitor_records(self->monitorBuffer);
+   }
+SWIGINTERN PyObject *PrimmeParams__close_monitor_stream(PrimmeParams *self){
+      return close_monitor_stream(&self->monitorStream, &self->monitorBuffer);
+   }
+SWIGINTERN void PrimmeSvdsParams__set_sparse_matrix(PrimmeSvdsParams *self,int format,PyObject *indptr,PyObject *indices,PyObject *data){
+      set_sparse_matrix(&self->sparse, format, self->m, self->n, indptr, indices, data);
+   }
+SWIGINTERN void PrimmeSvdsParams__open_monitor_stream(PrimmeSvdsParams *self,int capacity){
+      open_monitor_stream(&self->monitorStream, &self->monitorBuffer, capacity);
+   }
+SWIGINTERN PyObject *PrimmeSvdsParams__pop_monitor_records(PrimmeSvdsParams *self){
+      return pop_monitor_records(self->monitorBuffer);
+   }
+SWIGINTERN PyObject *PrimmeSvdsParams__close_monitor_stream(PrimmeSvdsParams *self){
+      return close_monitor_stream(&self->monitorStream, &self->monitorBuffer);
+   }
+
 /* ---------------------------------------------------
  * C++ director class methods
  * --------------------------------------------------- */
@@ -4960,7 +5225,7 @@ SwigDirector_PrimmeParams::SwigDirector_PrimmeParams(PyObject *self): PrimmePara
 SwigDirector_PrimmeParams::~SwigDirector_PrimmeParams() {
 }
 
-void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd) {
+void SwigDirector_PrimmeParams::matvec(int64_t len1YD, int len2YD, int64_t ldYD, float *yd, int64_t len1XD, int len2XD, int64_t ldXD, float *xd) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5001,18 +5266,18 @@ void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, float *
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by matvec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by matvec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((float*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((float*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       float *x = (float*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5020,7 +5285,7 @@ void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, float *
 }
 
 
-void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, std::complex< float > *yd, int len1XD, int len2XD, int ldXD, std::complex< float > *xd) {
+void SwigDirector_PrimmeParams::matvec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< float > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< float > *xd) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5061,18 +5326,18 @@ void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, std::co
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by matvec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by matvec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((std::complex<float>*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((std::complex<float>*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       std::complex<float> *x = (std::complex<float>*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5080,7 +5345,7 @@ void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, std::co
 }
 
 
-void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd) {
+void SwigDirector_PrimmeParams::matvec(int64_t len1YD, int len2YD, int64_t ldYD, double *yd, int64_t len1XD, int len2XD, int64_t ldXD, double *xd) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5121,18 +5386,18 @@ void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, double
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by matvec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by matvec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((double*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((double*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       double *x = (double*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5140,7 +5405,7 @@ void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, double
 }
 
 
-void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, std::complex< double > *yd, int len1XD, int len2XD, int ldXD, std::complex< double > *xd) {
+void SwigDirector_PrimmeParams::matvec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< double > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< double > *xd) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5181,18 +5446,18 @@ void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, std::co
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by matvec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by matvec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((std::complex<double>*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((std::complex<double>*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       std::complex<double> *x = (std::complex<double>*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5200,7 +5465,7 @@ void SwigDirector_PrimmeParams::matvec(int len1YD, int len2YD, int ldYD, std::co
 }
 
 
-void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd) {
+void SwigDirector_PrimmeParams::prevec(int64_t len1YD, int len2YD, int64_t ldYD, float *yd, int64_t len1XD, int len2XD, int64_t ldXD, float *xd) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5241,18 +5506,18 @@ void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, float *
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by prevec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by prevec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((float*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((float*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       float *x = (float*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5260,7 +5525,7 @@ void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, float *
 }
 
 
-void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, std::complex< float > *yd, int len1XD, int len2XD, int ldXD, std::complex< float > *xd) {
+void SwigDirector_PrimmeParams::prevec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< float > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< float > *xd) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5301,18 +5566,18 @@ void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, std::co
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by prevec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by prevec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((std::complex<float>*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((std::complex<float>*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       std::complex<float> *x = (std::complex<float>*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5320,7 +5585,7 @@ void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, std::co
 }
 
 
-void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd) {
+void SwigDirector_PrimmeParams::prevec(int64_t len1YD, int len2YD, int64_t ldYD, double *yd, int64_t len1XD, int len2XD, int64_t ldXD, double *xd) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5361,18 +5626,18 @@ void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, double
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by prevec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by prevec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((double*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((double*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       double *x = (double*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5380,7 +5645,7 @@ void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, double
 }
 
 
-void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, std::complex< double > *yd, int len1XD, int len2XD, int ldXD, std::complex< double > *xd) {
+void SwigDirector_PrimmeParams::prevec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< double > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< double > *xd) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5421,18 +5686,18 @@ void SwigDirector_PrimmeParams::prevec(int len1YD, int len2YD, int ldYD, std::co
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by prevec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by prevec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((std::complex<double>*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((std::complex<double>*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       std::complex<double> *x = (std::complex<double>*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5780,7 +6045,7 @@ SwigDirector_PrimmeSvdsParams::SwigDirector_PrimmeSvdsParams(PyObject *self): Pr
 SwigDirector_PrimmeSvdsParams::~SwigDirector_PrimmeSvdsParams() {
 }
 
-void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd, int transpose) {
+void SwigDirector_PrimmeSvdsParams::matvec(int64_t len1YD, int len2YD, int64_t ldYD, float *yd, int64_t len1XD, int len2XD, int64_t ldXD, float *xd, int transpose) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5823,18 +6088,18 @@ void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, flo
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by matvec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by matvec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((float*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((float*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       float *x = (float*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5842,7 +6107,7 @@ void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, flo
 }
 
 
-void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, std::complex< float > *yd, int len1XD, int len2XD, int ldXD, std::complex< float > *xd, int transpose) {
+void SwigDirector_PrimmeSvdsParams::matvec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< float > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< float > *xd, int transpose) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5885,18 +6150,18 @@ void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, std
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by matvec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by matvec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((std::complex<float>*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((std::complex<float>*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       std::complex<float> *x = (std::complex<float>*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5904,7 +6169,7 @@ void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, std
 }
 
 
-void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd, int transpose) {
+void SwigDirector_PrimmeSvdsParams::matvec(int64_t len1YD, int len2YD, int64_t ldYD, double *yd, int64_t len1XD, int len2XD, int64_t ldXD, double *xd, int transpose) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -5947,18 +6212,18 @@ void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, dou
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by matvec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by matvec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((double*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((double*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       double *x = (double*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -5966,7 +6231,7 @@ void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, dou
 }
 
 
-void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, std::complex< double > *yd, int len1XD, int len2XD, int ldXD, std::complex< double > *xd, int transpose) {
+void SwigDirector_PrimmeSvdsParams::matvec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< double > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< double > *xd, int transpose) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -6009,18 +6274,18 @@ void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, std
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by matvec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by matvec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((std::complex<double>*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((std::complex<double>*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       std::complex<double> *x = (std::complex<double>*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -6028,7 +6293,7 @@ void SwigDirector_PrimmeSvdsParams::matvec(int len1YD, int len2YD, int ldYD, std
 }
 
 
-void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd, int mode) {
+void SwigDirector_PrimmeSvdsParams::prevec(int64_t len1YD, int len2YD, int64_t ldYD, float *yd, int64_t len1XD, int len2XD, int64_t ldXD, float *xd, int mode) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -6071,18 +6336,18 @@ void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, flo
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by prevec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by prevec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((float*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((float*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       float *x = (float*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -6090,7 +6355,7 @@ void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, flo
 }
 
 
-void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, std::complex< float > *yd, int len1XD, int len2XD, int ldXD, std::complex< float > *xd, int mode) {
+void SwigDirector_PrimmeSvdsParams::prevec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< float > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< float > *xd, int mode) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -6133,18 +6398,18 @@ void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, std
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by prevec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by prevec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((std::complex<float>*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((std::complex<float>*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       std::complex<float> *x = (std::complex<float>*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -6152,7 +6417,7 @@ void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, std
 }
 
 
-void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd, int mode) {
+void SwigDirector_PrimmeSvdsParams::prevec(int64_t len1YD, int len2YD, int64_t ldYD, double *yd, int64_t len1XD, int len2XD, int64_t ldXD, double *xd, int mode) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -6195,18 +6460,18 @@ void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, dou
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by prevec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by prevec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((double*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((double*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       double *x = (double*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -6214,7 +6479,7 @@ void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, dou
 }
 
 
-void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, std::complex< double > *yd, int len1XD, int len2XD, int ldXD, std::complex< double > *xd, int mode) {
+void SwigDirector_PrimmeSvdsParams::prevec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< double > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< double > *xd, int mode) {
   PyArrayObject *array5 = NULL ;
   PyObject *o5 = NULL ;
   
@@ -6257,18 +6522,18 @@ void SwigDirector_PrimmeSvdsParams::prevec(int len1YD, int len2YD, int ldYD, std
     if (!array5 || !require_dimensions(array5,2) || !require_native(array5) ||
       !require_c_or_f_contiguous(array5))
     Swig::DirectorMethodException::raise("No valid type for object returned by prevec");
-    if ((len1XD) != (int) array_size(array5,0) ||
+    if ((len1XD) != (int64_t) array_size(array5,0) ||
       (len2XD) != (int) array_size(array5,1))
     {
       Swig::DirectorMethodException::raise("No valid dimensions for object returned by prevec");
     }
     npy_intp * strides = array_strides(array5);
     if (array_is_fortran(array5)) {
-      copy_matrix((std::complex<double>*)array_data(array5), (len1XD), (len2XD), (int)(strides[1]/strides[0]), (xd), (ldXD));
+      copy_matrix((std::complex<double>*)array_data(array5), (len1XD), (len2XD), (len2XD) > 1 ? (int64_t)(strides[1]/strides[0]) : (len1XD), (xd), (ldXD));
     } else {
       std::complex<double> *x = (std::complex<double>*)array_data(array5);
       npy_intp ldx = strides[0]/strides[1];
-      for (int i=0; i<(len1XD); i++)
+      for (npy_intp i=0; i<(len1XD); i++)
       for (int j=0; j<(len2XD); j++)
       (xd)[i+j*(ldXD)] = x[i*ldx+j];
     }
@@ -7661,6 +7926,162 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_primme_stats_numInnerIterations_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  int64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  long long val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_numInnerIterations_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_numInnerIterations_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_numInnerIterations_set" "', argument " "2"" of type '" "int64_t""'");
+  } 
+  arg2 = static_cast< int64_t >(val2);
+  if (arg1) (arg1)->numInnerIterations = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_numInnerIterations_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int64_t result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_numInnerIterations_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_numInnerIterations_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  result = (int64_t) ((arg1)->numInnerIterations);
+  resultobj = SWIG_From_long_SS_long(static_cast< long long >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_numInnerGlobalSum_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  int64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  long long val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_numInnerGlobalSum_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_numInnerGlobalSum_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_numInnerGlobalSum_set" "', argument " "2"" of type '" "int64_t""'");
+  } 
+  arg2 = static_cast< int64_t >(val2);
+  if (arg1) (arg1)->numInnerGlobalSum = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_numInnerGlobalSum_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int64_t result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_numInnerGlobalSum_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_numInnerGlobalSum_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  result = (int64_t) ((arg1)->numInnerGlobalSum);
+  resultobj = SWIG_From_long_SS_long(static_cast< long long >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_volumeRestart_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  int64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  long long val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_volumeRestart_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_volumeRestart_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_volumeRestart_set" "', argument " "2"" of type '" "int64_t""'");
+  } 
+  arg2 = static_cast< int64_t >(val2);
+  if (arg1) (arg1)->volumeRestart = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_volumeRestart_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int64_t result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_volumeRestart_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_volumeRestart_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  result = (int64_t) ((arg1)->volumeRestart);
+  resultobj = SWIG_From_long_SS_long(static_cast< long long >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_primme_stats_elapsedTime_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
@@ -7921,7 +8342,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_primme_stats_estimateMinEVal_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_primme_stats_timeSolveH_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
   double arg2 ;
@@ -7932,18 +8353,18 @@ SWIGINTERN PyObject *_wrap_primme_stats_estimateMinEVal_set(PyObject *SWIGUNUSED
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_estimateMinEVal_set",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_timeSolveH_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateMinEVal_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_timeSolveH_set" "', argument " "1"" of type '" "primme_stats *""'"); 
   }
   arg1 = reinterpret_cast< primme_stats * >(argp1);
   ecode2 = SWIG_AsVal_double(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_estimateMinEVal_set" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_timeSolveH_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = static_cast< double >(val2);
-  if (arg1) (arg1)->estimateMinEVal = arg2;
+  if (arg1) (arg1)->timeSolveH = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7951,7 +8372,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_primme_stats_estimateMinEVal_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_primme_stats_timeSolveH_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
   void *argp1 = 0 ;
@@ -7959,13 +8380,13 @@ SWIGINTERN PyObject *_wrap_primme_stats_estimateMinEVal_get(PyObject *SWIGUNUSED
   PyObject * obj0 = 0 ;
   double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_estimateMinEVal_get",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_timeSolveH_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateMinEVal_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_timeSolveH_get" "', argument " "1"" of type '" "primme_stats *""'"); 
   }
   arg1 = reinterpret_cast< primme_stats * >(argp1);
-  result = (double) ((arg1)->estimateMinEVal);
+  result = (double) ((arg1)->timeSolveH);
   resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
@@ -7973,7 +8394,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_primme_stats_estimateMaxEVal_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_primme_stats_timeRestart_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
   double arg2 ;
@@ -7984,18 +8405,18 @@ SWIGINTERN PyObject *_wrap_primme_stats_estimateMaxEVal_set(PyObject *SWIGUNUSED
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_estimateMaxEVal_set",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_timeRestart_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateMaxEVal_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_timeRestart_set" "', argument " "1"" of type '" "primme_stats *""'"); 
   }
   arg1 = reinterpret_cast< primme_stats * >(argp1);
   ecode2 = SWIG_AsVal_double(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_estimateMaxEVal_set" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_timeRestart_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = static_cast< double >(val2);
-  if (arg1) (arg1)->estimateMaxEVal = arg2;
+  if (arg1) (arg1)->timeRestart = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8003,7 +8424,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_primme_stats_estimateMaxEVal_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_primme_stats_timeRestart_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
   void *argp1 = 0 ;
@@ -8011,13 +8432,13 @@ SWIGINTERN PyObject *_wrap_primme_stats_estimateMaxEVal_get(PyObject *SWIGUNUSED
   PyObject * obj0 = 0 ;
   double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_estimateMaxEVal_get",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_timeRestart_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateMaxEVal_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_timeRestart_get" "', argument " "1"" of type '" "primme_stats *""'"); 
   }
   arg1 = reinterpret_cast< primme_stats * >(argp1);
-  result = (double) ((arg1)->estimateMaxEVal);
+  result = (double) ((arg1)->timeRestart);
   resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
@@ -8025,7 +8446,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_primme_stats_estimateLargestSVal_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_primme_stats_timeLocking_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
   double arg2 ;
@@ -8036,18 +8457,18 @@ SWIGINTERN PyObject *_wrap_primme_stats_estimateLargestSVal_set(PyObject *SWIGUN
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_estimateLargestSVal_set",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_timeLocking_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateLargestSVal_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_timeLocking_set" "', argument " "1"" of type '" "primme_stats *""'"); 
   }
   arg1 = reinterpret_cast< primme_stats * >(argp1);
   ecode2 = SWIG_AsVal_double(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_estimateLargestSVal_set" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_timeLocking_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = static_cast< double >(val2);
-  if (arg1) (arg1)->estimateLargestSVal = arg2;
+  if (arg1) (arg1)->timeLocking = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8055,7 +8476,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_primme_stats_estimateLargestSVal_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_primme_stats_timeLocking_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
   void *argp1 = 0 ;
@@ -8063,13 +8484,13 @@ SWIGINTERN PyObject *_wrap_primme_stats_estimateLargestSVal_get(PyObject *SWIGUN
   PyObject * obj0 = 0 ;
   double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_estimateLargestSVal_get",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_timeLocking_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateLargestSVal_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_timeLocking_get" "', argument " "1"" of type '" "primme_stats *""'"); 
   }
   arg1 = reinterpret_cast< primme_stats * >(argp1);
-  result = (double) ((arg1)->estimateLargestSVal);
+  result = (double) ((arg1)->timeLocking);
   resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
@@ -8077,7 +8498,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_primme_stats_maxConvTol_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_primme_stats_estimateMinEVal_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
   double arg2 ;
@@ -8088,18 +8509,18 @@ SWIGINTERN PyObject *_wrap_primme_stats_maxConvTol_set(PyObject *SWIGUNUSEDPARM(
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_maxConvTol_set",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_estimateMinEVal_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_maxConvTol_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateMinEVal_set" "', argument " "1"" of type '" "primme_stats *""'"); 
   }
   arg1 = reinterpret_cast< primme_stats * >(argp1);
   ecode2 = SWIG_AsVal_double(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_maxConvTol_set" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_estimateMinEVal_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = static_cast< double >(val2);
-  if (arg1) (arg1)->maxConvTol = arg2;
+  if (arg1) (arg1)->estimateMinEVal = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8107,7 +8528,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_primme_stats_maxConvTol_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_primme_stats_estimateMinEVal_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
   void *argp1 = 0 ;
@@ -8115,13 +8536,13 @@ SWIGINTERN PyObject *_wrap_primme_stats_maxConvTol_get(PyObject *SWIGUNUSEDPARM(
   PyObject * obj0 = 0 ;
   double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_maxConvTol_get",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_estimateMinEVal_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_maxConvTol_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateMinEVal_get" "', argument " "1"" of type '" "primme_stats *""'"); 
   }
   arg1 = reinterpret_cast< primme_stats * >(argp1);
-  result = (double) ((arg1)->maxConvTol);
+  result = (double) ((arg1)->estimateMinEVal);
   resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
@@ -8129,7 +8550,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_primme_stats_estimateResidualError_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_primme_stats_estimateMaxEVal_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
   double arg2 ;
@@ -8140,18 +8561,18 @@ SWIGINTERN PyObject *_wrap_primme_stats_estimateResidualError_set(PyObject *SWIG
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_estimateResidualError_set",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_estimateMaxEVal_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateResidualError_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateMaxEVal_set" "', argument " "1"" of type '" "primme_stats *""'"); 
   }
   arg1 = reinterpret_cast< primme_stats * >(argp1);
   ecode2 = SWIG_AsVal_double(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_estimateResidualError_set" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_estimateMaxEVal_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = static_cast< double >(val2);
-  if (arg1) (arg1)->estimateResidualError = arg2;
+  if (arg1) (arg1)->estimateMaxEVal = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8159,7 +8580,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_primme_stats_estimateResidualError_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_primme_stats_estimateMaxEVal_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_stats *arg1 = (primme_stats *) 0 ;
   void *argp1 = 0 ;
@@ -8167,14 +8588,399 @@ SWIGINTERN PyObject *_wrap_primme_stats_estimateResidualError_get(PyObject *SWIG
   PyObject * obj0 = 0 ;
   double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_estimateResidualError_get",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_estimateMaxEVal_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateMaxEVal_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  result = (double) ((arg1)->estimateMaxEVal);
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_estimateLargestSVal_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_estimateLargestSVal_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateLargestSVal_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_estimateLargestSVal_set" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  if (arg1) (arg1)->estimateLargestSVal = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_estimateLargestSVal_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_estimateLargestSVal_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateLargestSVal_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  result = (double) ((arg1)->estimateLargestSVal);
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_maxConvTol_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_maxConvTol_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_maxConvTol_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_maxConvTol_set" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  if (arg1) (arg1)->maxConvTol = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_maxConvTol_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_maxConvTol_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_maxConvTol_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  result = (double) ((arg1)->maxConvTol);
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_estimateResidualError_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_estimateResidualError_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateResidualError_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_estimateResidualError_set" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  if (arg1) (arg1)->estimateResidualError = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_estimateResidualError_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_estimateResidualError_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_estimateResidualError_get" "', argument " "1"" of type '" "primme_stats *""'"); 
   }
   arg1 = reinterpret_cast< primme_stats * >(argp1);
-  result = (double) ((arg1)->estimateResidualError);
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  result = (double) ((arg1)->estimateResidualError);
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_hwCounters_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_hwCounters_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_hwCounters_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_stats_hwCounters_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->hwCounters = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_hwCounters_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_hwCounters_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_hwCounters_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  result = (int) ((arg1)->hwCounters);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_hwCycles_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  double *arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_hwCycles_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_hwCycles_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_double, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "primme_stats_hwCycles_set" "', argument " "2"" of type '" "double [PRIMME_NUM_PHASES]""'"); 
+  } 
+  arg2 = reinterpret_cast< double * >(argp2);
+  {
+    if (arg2) {
+      size_t ii = 0;
+      for (; ii < (size_t)PRIMME_NUM_PHASES; ++ii) *(double *)&arg1->hwCycles[ii] = *((double *)arg2 + ii);
+    } else {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in variable '""hwCycles""' of type '""double [PRIMME_NUM_PHASES]""'");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_hwCycles_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_hwCycles_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_hwCycles_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  result = (double *)(double *) ((arg1)->hwCycles);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_double, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_hwInstructions_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  double *arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_hwInstructions_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_hwInstructions_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_double, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "primme_stats_hwInstructions_set" "', argument " "2"" of type '" "double [PRIMME_NUM_PHASES]""'"); 
+  } 
+  arg2 = reinterpret_cast< double * >(argp2);
+  {
+    if (arg2) {
+      size_t ii = 0;
+      for (; ii < (size_t)PRIMME_NUM_PHASES; ++ii) *(double *)&arg1->hwInstructions[ii] = *((double *)arg2 + ii);
+    } else {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in variable '""hwInstructions""' of type '""double [PRIMME_NUM_PHASES]""'");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_hwInstructions_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_hwInstructions_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_hwInstructions_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  result = (double *)(double *) ((arg1)->hwInstructions);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_double, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_hwCacheMisses_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  double *arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_stats_hwCacheMisses_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_hwCacheMisses_set" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_double, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "primme_stats_hwCacheMisses_set" "', argument " "2"" of type '" "double [PRIMME_NUM_PHASES]""'"); 
+  } 
+  arg2 = reinterpret_cast< double * >(argp2);
+  {
+    if (arg2) {
+      size_t ii = 0;
+      for (; ii < (size_t)PRIMME_NUM_PHASES; ++ii) *(double *)&arg1->hwCacheMisses[ii] = *((double *)arg2 + ii);
+    } else {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in variable '""hwCacheMisses""' of type '""double [PRIMME_NUM_PHASES]""'");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_stats_hwCacheMisses_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_stats *arg1 = (primme_stats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_stats_hwCacheMisses_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_stats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_stats_hwCacheMisses_get" "', argument " "1"" of type '" "primme_stats *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_stats * >(argp1);
+  result = (double *)(double *) ((arg1)->hwCacheMisses);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_double, 0 |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -8699,6 +9505,110 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_projection_params_pipeline_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  projection_params *arg1 = (projection_params *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:projection_params_pipeline_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_projection_params, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "projection_params_pipeline_set" "', argument " "1"" of type '" "projection_params *""'"); 
+  }
+  arg1 = reinterpret_cast< projection_params * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "projection_params_pipeline_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->pipeline = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_projection_params_pipeline_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  projection_params *arg1 = (projection_params *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:projection_params_pipeline_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_projection_params, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "projection_params_pipeline_get" "', argument " "1"" of type '" "projection_params *""'"); 
+  }
+  arg1 = reinterpret_cast< projection_params * >(argp1);
+  result = (int) ((arg1)->pipeline);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_projection_params_redundantSolve_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  projection_params *arg1 = (projection_params *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:projection_params_redundantSolve_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_projection_params, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "projection_params_redundantSolve_set" "', argument " "1"" of type '" "projection_params *""'"); 
+  }
+  arg1 = reinterpret_cast< projection_params * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "projection_params_redundantSolve_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->redundantSolve = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_projection_params_redundantSolve_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  projection_params *arg1 = (projection_params *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:projection_params_redundantSolve_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_projection_params, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "projection_params_redundantSolve_get" "', argument " "1"" of type '" "projection_params *""'"); 
+  }
+  arg1 = reinterpret_cast< projection_params * >(argp1);
+  result = (int) ((arg1)->redundantSolve);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_new_projection_params(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   projection_params *result = 0 ;
@@ -8973,21 +9883,125 @@ SWIGINTERN PyObject *_wrap_correction_params_projectors_get(PyObject *SWIGUNUSED
   if (!PyArg_ParseTuple(args,(char *)"O:correction_params_projectors_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_correction_params, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_projectors_get" "', argument " "1"" of type '" "correction_params *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_projectors_get" "', argument " "1"" of type '" "correction_params *""'"); 
+  }
+  arg1 = reinterpret_cast< correction_params * >(argp1);
+  result = (JD_projectors *)& ((arg1)->projectors);
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_JD_projectors, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_correction_params_convTest_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  correction_params *arg1 = (correction_params *) 0 ;
+  primme_convergencetest arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:correction_params_convTest_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_correction_params, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_convTest_set" "', argument " "1"" of type '" "correction_params *""'"); 
+  }
+  arg1 = reinterpret_cast< correction_params * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "correction_params_convTest_set" "', argument " "2"" of type '" "primme_convergencetest""'");
+  } 
+  arg2 = static_cast< primme_convergencetest >(val2);
+  if (arg1) (arg1)->convTest = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_correction_params_convTest_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  correction_params *arg1 = (correction_params *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  primme_convergencetest result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:correction_params_convTest_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_correction_params, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_convTest_get" "', argument " "1"" of type '" "correction_params *""'"); 
+  }
+  arg1 = reinterpret_cast< correction_params * >(argp1);
+  result = (primme_convergencetest) ((arg1)->convTest);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_correction_params_relTolBase_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  correction_params *arg1 = (correction_params *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:correction_params_relTolBase_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_correction_params, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_relTolBase_set" "', argument " "1"" of type '" "correction_params *""'"); 
+  }
+  arg1 = reinterpret_cast< correction_params * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "correction_params_relTolBase_set" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  if (arg1) (arg1)->relTolBase = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_correction_params_relTolBase_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  correction_params *arg1 = (correction_params *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:correction_params_relTolBase_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_correction_params, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_relTolBase_get" "', argument " "1"" of type '" "correction_params *""'"); 
   }
   arg1 = reinterpret_cast< correction_params * >(argp1);
-  result = (JD_projectors *)& ((arg1)->projectors);
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_JD_projectors, 0 |  0 );
+  result = (double) ((arg1)->relTolBase);
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_correction_params_convTest_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_correction_params_storagePrecision_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   correction_params *arg1 = (correction_params *) 0 ;
-  primme_convergencetest arg2 ;
+  primme_storage_precision arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int val2 ;
@@ -8995,18 +10009,18 @@ SWIGINTERN PyObject *_wrap_correction_params_convTest_set(PyObject *SWIGUNUSEDPA
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:correction_params_convTest_set",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:correction_params_storagePrecision_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_correction_params, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_convTest_set" "', argument " "1"" of type '" "correction_params *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_storagePrecision_set" "', argument " "1"" of type '" "correction_params *""'"); 
   }
   arg1 = reinterpret_cast< correction_params * >(argp1);
   ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "correction_params_convTest_set" "', argument " "2"" of type '" "primme_convergencetest""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "correction_params_storagePrecision_set" "', argument " "2"" of type '" "primme_storage_precision""'");
   } 
-  arg2 = static_cast< primme_convergencetest >(val2);
-  if (arg1) (arg1)->convTest = arg2;
+  arg2 = static_cast< primme_storage_precision >(val2);
+  if (arg1) (arg1)->storagePrecision = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9014,21 +10028,21 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_correction_params_convTest_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_correction_params_storagePrecision_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   correction_params *arg1 = (correction_params *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  primme_convergencetest result;
+  primme_storage_precision result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:correction_params_convTest_get",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:correction_params_storagePrecision_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_correction_params, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_convTest_get" "', argument " "1"" of type '" "correction_params *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_storagePrecision_get" "', argument " "1"" of type '" "correction_params *""'"); 
   }
   arg1 = reinterpret_cast< correction_params * >(argp1);
-  result = (primme_convergencetest) ((arg1)->convTest);
+  result = (primme_storage_precision) ((arg1)->storagePrecision);
   resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
@@ -9036,29 +10050,29 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_correction_params_relTolBase_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_correction_params_pipeline_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   correction_params *arg1 = (correction_params *) 0 ;
-  double arg2 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val2 ;
+  int val2 ;
   int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:correction_params_relTolBase_set",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:correction_params_pipeline_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_correction_params, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_relTolBase_set" "', argument " "1"" of type '" "correction_params *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_pipeline_set" "', argument " "1"" of type '" "correction_params *""'"); 
   }
   arg1 = reinterpret_cast< correction_params * >(argp1);
-  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "correction_params_relTolBase_set" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "correction_params_pipeline_set" "', argument " "2"" of type '" "int""'");
   } 
-  arg2 = static_cast< double >(val2);
-  if (arg1) (arg1)->relTolBase = arg2;
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->pipeline = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9066,22 +10080,22 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_correction_params_relTolBase_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_correction_params_pipeline_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   correction_params *arg1 = (correction_params *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
-  double result;
+  int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:correction_params_relTolBase_get",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:correction_params_pipeline_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_correction_params, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_relTolBase_get" "', argument " "1"" of type '" "correction_params *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "correction_params_pipeline_get" "', argument " "1"" of type '" "correction_params *""'"); 
   }
   arg1 = reinterpret_cast< correction_params * >(argp1);
-  result = (double) ((arg1)->relTolBase);
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  result = (int) ((arg1)->pipeline);
+  resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
   return NULL;
@@ -9761,6 +10775,58 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_primme_params_dynamicSizes_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_params *arg1 = (primme_params *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:primme_params_dynamicSizes_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_params, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_params_dynamicSizes_set" "', argument " "1"" of type '" "primme_params *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_params * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "primme_params_dynamicSizes_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->dynamicSizes = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_primme_params_dynamicSizes_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  primme_params *arg1 = (primme_params *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:primme_params_dynamicSizes_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_primme_params, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "primme_params_dynamicSizes_get" "', argument " "1"" of type '" "primme_params *""'"); 
+  }
+  arg1 = reinterpret_cast< primme_params * >(argp1);
+  result = (int) ((arg1)->dynamicSizes);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_primme_params_locking_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   primme_params *arg1 = (primme_params *) 0 ;
@@ -14972,21 +16038,21 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeParams_matvec__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   float *arg5 = (float *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   float *arg9 = (float *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -15007,21 +16073,21 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec__SWIG_0(PyObject *SWIGUNUSEDPARM(
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_matvec" "', argument " "1"" of type '" "PrimmeParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_matvec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_matvec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeParams_matvec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_matvec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_matvec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_float, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeParams_matvec" "', argument " "5"" of type '" "float *""'"); 
@@ -15066,21 +16132,21 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeParams_matvec__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   std::complex< float > *arg5 = (std::complex< float > *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   std::complex< float > *arg9 = (std::complex< float > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -15101,21 +16167,21 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec__SWIG_1(PyObject *SWIGUNUSEDPARM(
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_matvec" "', argument " "1"" of type '" "PrimmeParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_matvec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_matvec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeParams_matvec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_matvec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_matvec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_std__complexT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeParams_matvec" "', argument " "5"" of type '" "std::complex< float > *""'"); 
@@ -15160,21 +16226,21 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeParams_matvec__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   double *arg5 = (double *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   double *arg9 = (double *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -15195,21 +16261,21 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec__SWIG_2(PyObject *SWIGUNUSEDPARM(
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_matvec" "', argument " "1"" of type '" "PrimmeParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_matvec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_matvec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeParams_matvec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_matvec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_matvec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_double, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeParams_matvec" "', argument " "5"" of type '" "double *""'"); 
@@ -15254,21 +16320,21 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeParams_matvec__SWIG_3(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   std::complex< double > *arg5 = (std::complex< double > *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   std::complex< double > *arg9 = (std::complex< double > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -15289,21 +16355,21 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec__SWIG_3(PyObject *SWIGUNUSEDPARM(
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_matvec" "', argument " "1"" of type '" "PrimmeParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_matvec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_matvec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeParams_matvec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_matvec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_matvec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_std__complexT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeParams_matvec" "', argument " "5"" of type '" "std::complex< double > *""'"); 
@@ -15364,7 +16430,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec(PyObject *self, PyObject *args) {
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -15374,7 +16440,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec(PyObject *self, PyObject *args) {
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -15396,7 +16462,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec(PyObject *self, PyObject *args) {
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -15406,7 +16472,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec(PyObject *self, PyObject *args) {
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -15428,7 +16494,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec(PyObject *self, PyObject *args) {
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -15438,7 +16504,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec(PyObject *self, PyObject *args) {
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -15460,7 +16526,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec(PyObject *self, PyObject *args) {
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -15470,7 +16536,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_matvec(PyObject *self, PyObject *args) {
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -15500,21 +16566,21 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeParams_prevec__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   float *arg5 = (float *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   float *arg9 = (float *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -15535,21 +16601,21 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec__SWIG_0(PyObject *SWIGUNUSEDPARM(
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_prevec" "', argument " "1"" of type '" "PrimmeParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_prevec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_prevec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeParams_prevec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_prevec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_prevec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_float, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeParams_prevec" "', argument " "5"" of type '" "float *""'"); 
@@ -15594,21 +16660,21 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeParams_prevec__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   std::complex< float > *arg5 = (std::complex< float > *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   std::complex< float > *arg9 = (std::complex< float > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -15629,21 +16695,21 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec__SWIG_1(PyObject *SWIGUNUSEDPARM(
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_prevec" "', argument " "1"" of type '" "PrimmeParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_prevec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_prevec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeParams_prevec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_prevec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_prevec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_std__complexT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeParams_prevec" "', argument " "5"" of type '" "std::complex< float > *""'"); 
@@ -15688,21 +16754,21 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeParams_prevec__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   double *arg5 = (double *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   double *arg9 = (double *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -15723,21 +16789,21 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec__SWIG_2(PyObject *SWIGUNUSEDPARM(
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_prevec" "', argument " "1"" of type '" "PrimmeParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_prevec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_prevec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeParams_prevec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_prevec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_prevec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_double, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeParams_prevec" "', argument " "5"" of type '" "double *""'"); 
@@ -15782,21 +16848,21 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeParams_prevec__SWIG_3(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   std::complex< double > *arg5 = (std::complex< double > *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   std::complex< double > *arg9 = (std::complex< double > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -15817,21 +16883,21 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec__SWIG_3(PyObject *SWIGUNUSEDPARM(
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_prevec" "', argument " "1"" of type '" "PrimmeParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_prevec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_prevec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeParams_prevec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_prevec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeParams_prevec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_std__complexT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeParams_prevec" "', argument " "5"" of type '" "std::complex< double > *""'"); 
@@ -15892,7 +16958,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec(PyObject *self, PyObject *args) {
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -15902,7 +16968,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec(PyObject *self, PyObject *args) {
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -15924,7 +16990,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec(PyObject *self, PyObject *args) {
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -15934,7 +17000,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec(PyObject *self, PyObject *args) {
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -15956,7 +17022,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec(PyObject *self, PyObject *args) {
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -15966,7 +17032,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec(PyObject *self, PyObject *args) {
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -15988,7 +17054,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec(PyObject *self, PyObject *args) {
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -15998,7 +17064,7 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_prevec(PyObject *self, PyObject *args) {
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -16947,15 +18013,67 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_mon(PyObject *self, PyObject *args) {
   }
   
 fail:
-  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'PrimmeParams_mon'.\n"
-    "  Possible C/C++ prototypes are:\n"
-    "    PrimmeParams::mon(int,float *,int,int *,int,int *,int,float *,int,int,float *,int,int *,int,float *,int,float,int)\n"
-    "    PrimmeParams::mon(int,double *,int,int *,int,int *,int,double *,int,int,double *,int,int *,int,double *,int,double,int)\n");
-  return 0;
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'PrimmeParams_mon'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    PrimmeParams::mon(int,float *,int,int *,int,int *,int,float *,int,int,float *,int,int *,int,float *,int,float,int)\n"
+    "    PrimmeParams::mon(int,double *,int,int *,int,int *,int,double *,int,int,double *,int,int *,int,double *,int,double,int)\n");
+  return 0;
+}
+
+
+SWIGINTERN PyObject *_wrap_PrimmeParams_monitor_set_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeParams *arg1 = (PrimmeParams *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:PrimmeParams_monitor_set_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_monitor_set_set" "', argument " "1"" of type '" "PrimmeParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeParams * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_monitor_set_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->monitor_set = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PrimmeParams_monitor_set_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeParams *arg1 = (PrimmeParams *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:PrimmeParams_monitor_set_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_monitor_set_get" "', argument " "1"" of type '" "PrimmeParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeParams * >(argp1);
+  result = (int) ((arg1)->monitor_set);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_PrimmeParams_monitor_set_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PrimmeParams_matvec_out_set_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
   int arg2 ;
@@ -16966,18 +18084,18 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_monitor_set_set(PyObject *SWIGUNUSEDPARM
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:PrimmeParams_monitor_set_set",&obj0,&obj1)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OO:PrimmeParams_matvec_out_set_set",&obj0,&obj1)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeParams, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_monitor_set_set" "', argument " "1"" of type '" "PrimmeParams *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_matvec_out_set_set" "', argument " "1"" of type '" "PrimmeParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeParams * >(argp1);
   ecode2 = SWIG_AsVal_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_monitor_set_set" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams_matvec_out_set_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->monitor_set = arg2;
+  if (arg1) (arg1)->matvec_out_set = arg2;
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -16985,7 +18103,7 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_PrimmeParams_monitor_set_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_PrimmeParams_matvec_out_set_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
   void *argp1 = 0 ;
@@ -16993,13 +18111,13 @@ SWIGINTERN PyObject *_wrap_PrimmeParams_monitor_set_get(PyObject *SWIGUNUSEDPARM
   PyObject * obj0 = 0 ;
   int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:PrimmeParams_monitor_set_get",&obj0)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"O:PrimmeParams_matvec_out_set_get",&obj0)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeParams, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_monitor_set_get" "', argument " "1"" of type '" "PrimmeParams *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams_matvec_out_set_get" "', argument " "1"" of type '" "PrimmeParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeParams * >(argp1);
-  result = (int) ((arg1)->monitor_set);
+  result = (int) ((arg1)->matvec_out_set);
   resultobj = SWIG_From_int(static_cast< int >(result));
   return resultobj;
 fail:
@@ -17007,6 +18125,191 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_PrimmeParams__set_sparse_matrix(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeParams *arg1 = (PrimmeParams *) 0 ;
+  int arg2 ;
+  PyObject *arg3 = (PyObject *) 0 ;
+  PyObject *arg4 = (PyObject *) 0 ;
+  PyObject *arg5 = (PyObject *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOO:PrimmeParams__set_sparse_matrix",&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams__set_sparse_matrix" "', argument " "1"" of type '" "PrimmeParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeParams * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams__set_sparse_matrix" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  arg3 = obj2;
+  arg4 = obj3;
+  arg5 = obj4;
+  {
+    try
+    {
+      PrimmeParams__set_sparse_matrix(arg1,arg2,arg3,arg4,arg5);
+    }
+    catch (const std::invalid_argument& e)
+    {
+      SWIG_exception(SWIG_ValueError, e.what());
+    }
+    catch (const std::out_of_range& e)
+    {
+      SWIG_exception(SWIG_IndexError, e.what());
+    }
+    catch (Swig::DirectorException &e)
+    {
+      SWIG_fail;
+    }
+    if (PyErr_Occurred()) SWIG_fail;
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PrimmeParams__open_monitor_stream(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeParams *arg1 = (PrimmeParams *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:PrimmeParams__open_monitor_stream",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams__open_monitor_stream" "', argument " "1"" of type '" "PrimmeParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeParams * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeParams__open_monitor_stream" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try
+    {
+      PrimmeParams__open_monitor_stream(arg1,arg2);
+    }
+    catch (const std::invalid_argument& e)
+    {
+      SWIG_exception(SWIG_ValueError, e.what());
+    }
+    catch (const std::out_of_range& e)
+    {
+      SWIG_exception(SWIG_IndexError, e.what());
+    }
+    catch (Swig::DirectorException &e)
+    {
+      SWIG_fail;
+    }
+    if (PyErr_Occurred()) SWIG_fail;
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PrimmeParams__pop_monitor_records(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeParams *arg1 = (PrimmeParams *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:PrimmeParams__pop_monitor_records",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams__pop_monitor_records" "', argument " "1"" of type '" "PrimmeParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeParams * >(argp1);
+  {
+    try
+    {
+      result = (PyObject *)PrimmeParams__pop_monitor_records(arg1);
+    }
+    catch (const std::invalid_argument& e)
+    {
+      SWIG_exception(SWIG_ValueError, e.what());
+    }
+    catch (const std::out_of_range& e)
+    {
+      SWIG_exception(SWIG_IndexError, e.what());
+    }
+    catch (Swig::DirectorException &e)
+    {
+      SWIG_fail;
+    }
+    if (PyErr_Occurred()) SWIG_fail;
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PrimmeParams__close_monitor_stream(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeParams *arg1 = (PrimmeParams *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:PrimmeParams__close_monitor_stream",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeParams__close_monitor_stream" "', argument " "1"" of type '" "PrimmeParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeParams * >(argp1);
+  {
+    try
+    {
+      result = (PyObject *)PrimmeParams__close_monitor_stream(arg1);
+    }
+    catch (const std::invalid_argument& e)
+    {
+      SWIG_exception(SWIG_ValueError, e.what());
+    }
+    catch (const std::out_of_range& e)
+    {
+      SWIG_exception(SWIG_IndexError, e.what());
+    }
+    catch (Swig::DirectorException &e)
+    {
+      SWIG_fail;
+    }
+    if (PyErr_Occurred()) SWIG_fail;
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_disown_PrimmeParams(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeParams *arg1 = (PrimmeParams *) 0 ;
@@ -17352,22 +18655,22 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   float *arg5 = (float *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   float *arg9 = (float *) 0 ;
   int arg10 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -17391,21 +18694,21 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec__SWIG_0(PyObject *SWIGUNUSEDP
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams_matvec" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_matvec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_matvec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeSvdsParams_matvec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_matvec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_matvec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_float, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeSvdsParams_matvec" "', argument " "5"" of type '" "float *""'"); 
@@ -17455,22 +18758,22 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   std::complex< float > *arg5 = (std::complex< float > *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   std::complex< float > *arg9 = (std::complex< float > *) 0 ;
   int arg10 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -17494,21 +18797,21 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec__SWIG_1(PyObject *SWIGUNUSEDP
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams_matvec" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_matvec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_matvec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeSvdsParams_matvec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_matvec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_matvec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_std__complexT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeSvdsParams_matvec" "', argument " "5"" of type '" "std::complex< float > *""'"); 
@@ -17558,22 +18861,22 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   double *arg5 = (double *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   double *arg9 = (double *) 0 ;
   int arg10 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -17597,21 +18900,21 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec__SWIG_2(PyObject *SWIGUNUSEDP
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams_matvec" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_matvec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_matvec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeSvdsParams_matvec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_matvec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_matvec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_double, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeSvdsParams_matvec" "', argument " "5"" of type '" "double *""'"); 
@@ -17661,22 +18964,22 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec__SWIG_3(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   std::complex< double > *arg5 = (std::complex< double > *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   std::complex< double > *arg9 = (std::complex< double > *) 0 ;
   int arg10 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -17700,21 +19003,21 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec__SWIG_3(PyObject *SWIGUNUSEDP
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams_matvec" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_matvec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_matvec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeSvdsParams_matvec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_matvec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_matvec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_std__complexT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeSvdsParams_matvec" "', argument " "5"" of type '" "std::complex< double > *""'"); 
@@ -17780,7 +19083,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec(PyObject *self, PyObject *arg
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -17790,7 +19093,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec(PyObject *self, PyObject *arg
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -17818,7 +19121,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec(PyObject *self, PyObject *arg
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -17828,7 +19131,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec(PyObject *self, PyObject *arg
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -17856,7 +19159,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec(PyObject *self, PyObject *arg
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -17866,7 +19169,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec(PyObject *self, PyObject *arg
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -17894,7 +19197,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec(PyObject *self, PyObject *arg
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -17904,7 +19207,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec(PyObject *self, PyObject *arg
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -17940,22 +19243,22 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   float *arg5 = (float *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   float *arg9 = (float *) 0 ;
   int arg10 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -17979,21 +19282,21 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec__SWIG_0(PyObject *SWIGUNUSEDP
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams_prevec" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_prevec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_prevec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeSvdsParams_prevec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_prevec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_prevec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_float, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeSvdsParams_prevec" "', argument " "5"" of type '" "float *""'"); 
@@ -18043,22 +19346,22 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   std::complex< float > *arg5 = (std::complex< float > *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   std::complex< float > *arg9 = (std::complex< float > *) 0 ;
   int arg10 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -18082,21 +19385,21 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec__SWIG_1(PyObject *SWIGUNUSEDP
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams_prevec" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_prevec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_prevec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeSvdsParams_prevec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_prevec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_prevec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_std__complexT_float_t, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeSvdsParams_prevec" "', argument " "5"" of type '" "std::complex< float > *""'"); 
@@ -18146,22 +19449,22 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   double *arg5 = (double *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   double *arg9 = (double *) 0 ;
   int arg10 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -18185,21 +19488,21 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec__SWIG_2(PyObject *SWIGUNUSEDP
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams_prevec" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_prevec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_prevec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeSvdsParams_prevec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_prevec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_prevec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_double, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeSvdsParams_prevec" "', argument " "5"" of type '" "double *""'"); 
@@ -18249,22 +19552,22 @@ fail:
 SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec__SWIG_3(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
-  int arg2 ;
+  int64_t arg2 ;
   int arg3 ;
-  int arg4 ;
+  int64_t arg4 ;
   std::complex< double > *arg5 = (std::complex< double > *) 0 ;
-  int arg6 ;
+  int64_t arg6 ;
   int arg7 ;
-  int arg8 ;
+  int64_t arg8 ;
   std::complex< double > *arg9 = (std::complex< double > *) 0 ;
   int arg10 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int val2 ;
+  long long val2 ;
   int ecode2 = 0 ;
   int val3 ;
   int ecode3 = 0 ;
-  int val4 ;
+  long long val4 ;
   int ecode4 = 0 ;
   void *argp5 = 0 ;
   int res5 = 0 ;
@@ -18288,21 +19591,21 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec__SWIG_3(PyObject *SWIGUNUSEDP
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams_prevec" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
   }
   arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
-  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  ecode2 = SWIG_AsVal_long_SS_long(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_prevec" "', argument " "2"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_prevec" "', argument " "2"" of type '" "int64_t""\'");
   } 
-  arg2 = static_cast< int >(val2);
+  arg2 = static_cast< int64_t >(val2);
   ecode3 = SWIG_AsVal_int(obj2, &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PrimmeSvdsParams_prevec" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(obj3, &val4);
+  ecode4 = SWIG_AsVal_long_SS_long(obj3, &val4);
   if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_prevec" "', argument " "4"" of type '" "int""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "PrimmeSvdsParams_prevec" "', argument " "4"" of type '" "int64_t""\'");
   } 
-  arg4 = static_cast< int >(val4);
+  arg4 = static_cast< int64_t >(val4);
   res5 = SWIG_ConvertPtr(obj4, &argp5,SWIGTYPE_p_std__complexT_double_t, 0 |  0 );
   if (!SWIG_IsOK(res5)) {
     SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "PrimmeSvdsParams_prevec" "', argument " "5"" of type '" "std::complex< double > *""'"); 
@@ -18368,7 +19671,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec(PyObject *self, PyObject *arg
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -18378,7 +19681,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec(PyObject *self, PyObject *arg
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -18406,7 +19709,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec(PyObject *self, PyObject *arg
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -18416,7 +19719,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec(PyObject *self, PyObject *arg
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -18444,7 +19747,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec(PyObject *self, PyObject *arg
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -18454,7 +19757,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec(PyObject *self, PyObject *arg
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -18482,7 +19785,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec(PyObject *self, PyObject *arg
     _v = SWIG_CheckState(res);
     if (_v) {
       {
-        int res = SWIG_AsVal_int(argv[1], NULL);
+        int res = SWIG_AsVal_long_SS_long(argv[1], NULL);
         _v = SWIG_CheckState(res);
       }
       if (_v) {
@@ -18492,7 +19795,7 @@ SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_prevec(PyObject *self, PyObject *arg
         }
         if (_v) {
           {
-            int res = SWIG_AsVal_int(argv[3], NULL);
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
             _v = SWIG_CheckState(res);
           }
           if (_v) {
@@ -19537,6 +20840,243 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec_out_set_set(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:PrimmeSvdsParams_matvec_out_set_set",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeSvdsParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams_matvec_out_set_set" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams_matvec_out_set_set" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->matvec_out_set = arg2;
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PrimmeSvdsParams_matvec_out_set_get(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:PrimmeSvdsParams_matvec_out_set_get",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeSvdsParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams_matvec_out_set_get" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
+  result = (int) ((arg1)->matvec_out_set);
+  resultobj = SWIG_From_int(static_cast< int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PrimmeSvdsParams__set_sparse_matrix(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
+  int arg2 ;
+  PyObject *arg3 = (PyObject *) 0 ;
+  PyObject *arg4 = (PyObject *) 0 ;
+  PyObject *arg5 = (PyObject *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOO:PrimmeSvdsParams__set_sparse_matrix",&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeSvdsParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams__set_sparse_matrix" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams__set_sparse_matrix" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  arg3 = obj2;
+  arg4 = obj3;
+  arg5 = obj4;
+  {
+    try
+    {
+      PrimmeSvdsParams__set_sparse_matrix(arg1,arg2,arg3,arg4,arg5);
+    }
+    catch (const std::invalid_argument& e)
+    {
+      SWIG_exception(SWIG_ValueError, e.what());
+    }
+    catch (const std::out_of_range& e)
+    {
+      SWIG_exception(SWIG_IndexError, e.what());
+    }
+    catch (Swig::DirectorException &e)
+    {
+      SWIG_fail;
+    }
+    if (PyErr_Occurred()) SWIG_fail;
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PrimmeSvdsParams__open_monitor_stream(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:PrimmeSvdsParams__open_monitor_stream",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeSvdsParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams__open_monitor_stream" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PrimmeSvdsParams__open_monitor_stream" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try
+    {
+      PrimmeSvdsParams__open_monitor_stream(arg1,arg2);
+    }
+    catch (const std::invalid_argument& e)
+    {
+      SWIG_exception(SWIG_ValueError, e.what());
+    }
+    catch (const std::out_of_range& e)
+    {
+      SWIG_exception(SWIG_IndexError, e.what());
+    }
+    catch (Swig::DirectorException &e)
+    {
+      SWIG_fail;
+    }
+    if (PyErr_Occurred()) SWIG_fail;
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PrimmeSvdsParams__pop_monitor_records(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:PrimmeSvdsParams__pop_monitor_records",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeSvdsParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams__pop_monitor_records" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
+  {
+    try
+    {
+      result = (PyObject *)PrimmeSvdsParams__pop_monitor_records(arg1);
+    }
+    catch (const std::invalid_argument& e)
+    {
+      SWIG_exception(SWIG_ValueError, e.what());
+    }
+    catch (const std::out_of_range& e)
+    {
+      SWIG_exception(SWIG_IndexError, e.what());
+    }
+    catch (Swig::DirectorException &e)
+    {
+      SWIG_fail;
+    }
+    if (PyErr_Occurred()) SWIG_fail;
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PrimmeSvdsParams__close_monitor_stream(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:PrimmeSvdsParams__close_monitor_stream",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PrimmeSvdsParams, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PrimmeSvdsParams__close_monitor_stream" "', argument " "1"" of type '" "PrimmeSvdsParams *""'"); 
+  }
+  arg1 = reinterpret_cast< PrimmeSvdsParams * >(argp1);
+  {
+    try
+    {
+      result = (PyObject *)PrimmeSvdsParams__close_monitor_stream(arg1);
+    }
+    catch (const std::invalid_argument& e)
+    {
+      SWIG_exception(SWIG_ValueError, e.what());
+    }
+    catch (const std::out_of_range& e)
+    {
+      SWIG_exception(SWIG_IndexError, e.what());
+    }
+    catch (Swig::DirectorException &e)
+    {
+      SWIG_fail;
+    }
+    if (PyErr_Occurred()) SWIG_fail;
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_disown_PrimmeSvdsParams(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PrimmeSvdsParams *arg1 = (PrimmeSvdsParams *) 0 ;
@@ -19585,6 +21125,12 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"primme_stats_volumeGlobalSum_get", _wrap_primme_stats_volumeGlobalSum_get, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_numOrthoInnerProds_set", _wrap_primme_stats_numOrthoInnerProds_set, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_numOrthoInnerProds_get", _wrap_primme_stats_numOrthoInnerProds_get, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_numInnerIterations_set", _wrap_primme_stats_numInnerIterations_set, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_numInnerIterations_get", _wrap_primme_stats_numInnerIterations_get, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_numInnerGlobalSum_set", _wrap_primme_stats_numInnerGlobalSum_set, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_numInnerGlobalSum_get", _wrap_primme_stats_numInnerGlobalSum_get, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_volumeRestart_set", _wrap_primme_stats_volumeRestart_set, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_volumeRestart_get", _wrap_primme_stats_volumeRestart_get, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_elapsedTime_set", _wrap_primme_stats_elapsedTime_set, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_elapsedTime_get", _wrap_primme_stats_elapsedTime_get, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_timeMatvec_set", _wrap_primme_stats_timeMatvec_set, METH_VARARGS, NULL},
@@ -19595,6 +21141,12 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"primme_stats_timeOrtho_get", _wrap_primme_stats_timeOrtho_get, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_timeGlobalSum_set", _wrap_primme_stats_timeGlobalSum_set, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_timeGlobalSum_get", _wrap_primme_stats_timeGlobalSum_get, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_timeSolveH_set", _wrap_primme_stats_timeSolveH_set, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_timeSolveH_get", _wrap_primme_stats_timeSolveH_get, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_timeRestart_set", _wrap_primme_stats_timeRestart_set, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_timeRestart_get", _wrap_primme_stats_timeRestart_get, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_timeLocking_set", _wrap_primme_stats_timeLocking_set, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_timeLocking_get", _wrap_primme_stats_timeLocking_get, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_estimateMinEVal_set", _wrap_primme_stats_estimateMinEVal_set, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_estimateMinEVal_get", _wrap_primme_stats_estimateMinEVal_get, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_estimateMaxEVal_set", _wrap_primme_stats_estimateMaxEVal_set, METH_VARARGS, NULL},
@@ -19605,6 +21157,14 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"primme_stats_maxConvTol_get", _wrap_primme_stats_maxConvTol_get, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_estimateResidualError_set", _wrap_primme_stats_estimateResidualError_set, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_estimateResidualError_get", _wrap_primme_stats_estimateResidualError_get, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_hwCounters_set", _wrap_primme_stats_hwCounters_set, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_hwCounters_get", _wrap_primme_stats_hwCounters_get, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_hwCycles_set", _wrap_primme_stats_hwCycles_set, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_hwCycles_get", _wrap_primme_stats_hwCycles_get, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_hwInstructions_set", _wrap_primme_stats_hwInstructions_set, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_hwInstructions_get", _wrap_primme_stats_hwInstructions_get, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_hwCacheMisses_set", _wrap_primme_stats_hwCacheMisses_set, METH_VARARGS, NULL},
+	 { (char *)"primme_stats_hwCacheMisses_get", _wrap_primme_stats_hwCacheMisses_get, METH_VARARGS, NULL},
 	 { (char *)"new_primme_stats", _wrap_new_primme_stats, METH_VARARGS, NULL},
 	 { (char *)"delete_primme_stats", _wrap_delete_primme_stats, METH_VARARGS, NULL},
 	 { (char *)"primme_stats_swigregister", primme_stats_swigregister, METH_VARARGS, NULL},
@@ -19625,6 +21185,10 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"JD_projectors_swigregister", JD_projectors_swigregister, METH_VARARGS, NULL},
 	 { (char *)"projection_params_projection_set", _wrap_projection_params_projection_set, METH_VARARGS, NULL},
 	 { (char *)"projection_params_projection_get", _wrap_projection_params_projection_get, METH_VARARGS, NULL},
+	 { (char *)"projection_params_pipeline_set", _wrap_projection_params_pipeline_set, METH_VARARGS, NULL},
+	 { (char *)"projection_params_pipeline_get", _wrap_projection_params_pipeline_get, METH_VARARGS, NULL},
+	 { (char *)"projection_params_redundantSolve_set", _wrap_projection_params_redundantSolve_set, METH_VARARGS, NULL},
+	 { (char *)"projection_params_redundantSolve_get", _wrap_projection_params_redundantSolve_get, METH_VARARGS, NULL},
 	 { (char *)"new_projection_params", _wrap_new_projection_params, METH_VARARGS, NULL},
 	 { (char *)"delete_projection_params", _wrap_delete_projection_params, METH_VARARGS, NULL},
 	 { (char *)"projection_params_swigregister", projection_params_swigregister, METH_VARARGS, NULL},
@@ -19640,6 +21204,10 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"correction_params_convTest_get", _wrap_correction_params_convTest_get, METH_VARARGS, NULL},
 	 { (char *)"correction_params_relTolBase_set", _wrap_correction_params_relTolBase_set, METH_VARARGS, NULL},
 	 { (char *)"correction_params_relTolBase_get", _wrap_correction_params_relTolBase_get, METH_VARARGS, NULL},
+	 { (char *)"correction_params_storagePrecision_set", _wrap_correction_params_storagePrecision_set, METH_VARARGS, NULL},
+	 { (char *)"correction_params_storagePrecision_get", _wrap_correction_params_storagePrecision_get, METH_VARARGS, NULL},
+	 { (char *)"correction_params_pipeline_set", _wrap_correction_params_pipeline_set, METH_VARARGS, NULL},
+	 { (char *)"correction_params_pipeline_get", _wrap_correction_params_pipeline_get, METH_VARARGS, NULL},
 	 { (char *)"new_correction_params", _wrap_new_correction_params, METH_VARARGS, NULL},
 	 { (char *)"delete_correction_params", _wrap_delete_correction_params, METH_VARARGS, NULL},
 	 { (char *)"correction_params_swigregister", correction_params_swigregister, METH_VARARGS, NULL},
@@ -19666,6 +21234,8 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"primme_params_target_get", _wrap_primme_params_target_get, METH_VARARGS, NULL},
 	 { (char *)"primme_params_dynamicMethodSwitch_set", _wrap_primme_params_dynamicMethodSwitch_set, METH_VARARGS, NULL},
 	 { (char *)"primme_params_dynamicMethodSwitch_get", _wrap_primme_params_dynamicMethodSwitch_get, METH_VARARGS, NULL},
+	 { (char *)"primme_params_dynamicSizes_set", _wrap_primme_params_dynamicSizes_set, METH_VARARGS, NULL},
+	 { (char *)"primme_params_dynamicSizes_get", _wrap_primme_params_dynamicSizes_get, METH_VARARGS, NULL},
 	 { (char *)"primme_params_locking_set", _wrap_primme_params_locking_set, METH_VARARGS, NULL},
 	 { (char *)"primme_params_locking_get", _wrap_primme_params_locking_get, METH_VARARGS, NULL},
 	 { (char *)"primme_params_initSize_set", _wrap_primme_params_initSize_set, METH_VARARGS, NULL},
@@ -19855,6 +21425,12 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"PrimmeParams_mon", _wrap_PrimmeParams_mon, METH_VARARGS, NULL},
 	 { (char *)"PrimmeParams_monitor_set_set", _wrap_PrimmeParams_monitor_set_set, METH_VARARGS, NULL},
 	 { (char *)"PrimmeParams_monitor_set_get", _wrap_PrimmeParams_monitor_set_get, METH_VARARGS, NULL},
+	 { (char *)"PrimmeParams_matvec_out_set_set", _wrap_PrimmeParams_matvec_out_set_set, METH_VARARGS, NULL},
+	 { (char *)"PrimmeParams_matvec_out_set_get", _wrap_PrimmeParams_matvec_out_set_get, METH_VARARGS, NULL},
+	 { (char *)"PrimmeParams__set_sparse_matrix", _wrap_PrimmeParams__set_sparse_matrix, METH_VARARGS, NULL},
+	 { (char *)"PrimmeParams__open_monitor_stream", _wrap_PrimmeParams__open_monitor_stream, METH_VARARGS, NULL},
+	 { (char *)"PrimmeParams__pop_monitor_records", _wrap_PrimmeParams__pop_monitor_records, METH_VARARGS, NULL},
+	 { (char *)"PrimmeParams__close_monitor_stream", _wrap_PrimmeParams__close_monitor_stream, METH_VARARGS, NULL},
 	 { (char *)"disown_PrimmeParams", _wrap_disown_PrimmeParams, METH_VARARGS, NULL},
 	 { (char *)"PrimmeParams_swigregister", PrimmeParams_swigregister, METH_VARARGS, NULL},
 	 { (char *)"new_PrimmeSvdsParams", _wrap_new_PrimmeSvdsParams, METH_VARARGS, (char *)"\n"
@@ -19904,6 +21480,12 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"PrimmeSvdsParams_mon", _wrap_PrimmeSvdsParams_mon, METH_VARARGS, NULL},
 	 { (char *)"PrimmeSvdsParams_monitor_set_set", _wrap_PrimmeSvdsParams_monitor_set_set, METH_VARARGS, NULL},
 	 { (char *)"PrimmeSvdsParams_monitor_set_get", _wrap_PrimmeSvdsParams_monitor_set_get, METH_VARARGS, NULL},
+	 { (char *)"PrimmeSvdsParams_matvec_out_set_set", _wrap_PrimmeSvdsParams_matvec_out_set_set, METH_VARARGS, NULL},
+	 { (char *)"PrimmeSvdsParams_matvec_out_set_get", _wrap_PrimmeSvdsParams_matvec_out_set_get, METH_VARARGS, NULL},
+	 { (char *)"PrimmeSvdsParams__set_sparse_matrix", _wrap_PrimmeSvdsParams__set_sparse_matrix, METH_VARARGS, NULL},
+	 { (char *)"PrimmeSvdsParams__open_monitor_stream", _wrap_PrimmeSvdsParams__open_monitor_stream, METH_VARARGS, NULL},
+	 { (char *)"PrimmeSvdsParams__pop_monitor_records", _wrap_PrimmeSvdsParams__pop_monitor_records, METH_VARARGS, NULL},
+	 { (char *)"PrimmeSvdsParams__close_monitor_stream", _wrap_PrimmeSvdsParams__close_monitor_stream, METH_VARARGS, NULL},
 	 { (char *)"disown_PrimmeSvdsParams", _wrap_disown_PrimmeSvdsParams, METH_VARARGS, NULL},
 	 { (char *)"PrimmeSvdsParams_swigregister", PrimmeSvdsParams_swigregister, METH_VARARGS, NULL},
 	 { NULL, NULL, 0, NULL }
@@ -20780,6 +22362,10 @@ SWIG_init(void) {
   
   
   import_array();
+#if PY_VERSION_HEX < 0x03070000
+  /* The solver releases the GIL; see my_primme */
+  PyEval_InitThreads();
+#endif
   
   SWIG_Python_SetConstant(d, "primme_smallest",SWIG_From_int(static_cast< int >(primme_smallest)));
   SWIG_Python_SetConstant(d, "primme_largest",SWIG_From_int(static_cast< int >(primme_largest)));
@@ -20801,12 +22387,23 @@ SWIG_init(void) {
   SWIG_Python_SetConstant(d, "primme_decreasing_LTolerance",SWIG_From_int(static_cast< int >(primme_decreasing_LTolerance)));
   SWIG_Python_SetConstant(d, "primme_adaptive_ETolerance",SWIG_From_int(static_cast< int >(primme_adaptive_ETolerance)));
   SWIG_Python_SetConstant(d, "primme_adaptive",SWIG_From_int(static_cast< int >(primme_adaptive)));
+  SWIG_Python_SetConstant(d, "primme_storage_full",SWIG_From_int(static_cast< int >(primme_storage_full)));
+  SWIG_Python_SetConstant(d, "primme_storage_bf16",SWIG_From_int(static_cast< int >(primme_storage_bf16)));
+  SWIG_Python_SetConstant(d, "primme_storage_fp16",SWIG_From_int(static_cast< int >(primme_storage_fp16)));
   SWIG_Python_SetConstant(d, "primme_event_outer_iteration",SWIG_From_int(static_cast< int >(primme_event_outer_iteration)));
   SWIG_Python_SetConstant(d, "primme_event_inner_iteration",SWIG_From_int(static_cast< int >(primme_event_inner_iteration)));
   SWIG_Python_SetConstant(d, "primme_event_restart",SWIG_From_int(static_cast< int >(primme_event_restart)));
   SWIG_Python_SetConstant(d, "primme_event_reset",SWIG_From_int(static_cast< int >(primme_event_reset)));
   SWIG_Python_SetConstant(d, "primme_event_converged",SWIG_From_int(static_cast< int >(primme_event_converged)));
   SWIG_Python_SetConstant(d, "primme_event_locked",SWIG_From_int(static_cast< int >(primme_event_locked)));
+  SWIG_Python_SetConstant(d, "primme_phase_matvec",SWIG_From_int(static_cast< int >(primme_phase_matvec)));
+  SWIG_Python_SetConstant(d, "primme_phase_precond",SWIG_From_int(static_cast< int >(primme_phase_precond)));
+  SWIG_Python_SetConstant(d, "primme_phase_ortho",SWIG_From_int(static_cast< int >(primme_phase_ortho)));
+  SWIG_Python_SetConstant(d, "primme_phase_globalSum",SWIG_From_int(static_cast< int >(primme_phase_globalSum)));
+  SWIG_Python_SetConstant(d, "primme_phase_solveH",SWIG_From_int(static_cast< int >(primme_phase_solveH)));
+  SWIG_Python_SetConstant(d, "primme_phase_restart",SWIG_From_int(static_cast< int >(primme_phase_restart)));
+  SWIG_Python_SetConstant(d, "primme_phase_locking",SWIG_From_int(static_cast< int >(primme_phase_locking)));
+  SWIG_Python_SetConstant(d, "PRIMME_NUM_PHASES",SWIG_From_int(static_cast< int >(7)));
   SWIG_Python_SetConstant(d, "PRIMME_DEFAULT_METHOD",SWIG_From_int(static_cast< int >(PRIMME_DEFAULT_METHOD)));
   SWIG_Python_SetConstant(d, "PRIMME_DYNAMIC",SWIG_From_int(static_cast< int >(PRIMME_DYNAMIC)));
   SWIG_Python_SetConstant(d, "PRIMME_DEFAULT_MIN_TIME",SWIG_From_int(static_cast< int >(PRIMME_DEFAULT_MIN_TIME)));
@@ -20823,6 +22420,7 @@ SWIG_init(void) {
   SWIG_Python_SetConstant(d, "PRIMME_STEEPEST_DESCENT",SWIG_From_int(static_cast< int >(PRIMME_STEEPEST_DESCENT)));
   SWIG_Python_SetConstant(d, "PRIMME_LOBPCG_OrthoBasis",SWIG_From_int(static_cast< int >(PRIMME_LOBPCG_OrthoBasis)));
   SWIG_Python_SetConstant(d, "PRIMME_LOBPCG_OrthoBasis_Window",SWIG_From_int(static_cast< int >(PRIMME_LOBPCG_OrthoBasis_Window)));
+  SWIG_Python_SetConstant(d, "PRIMME_GD_plusK_Pipelined",SWIG_From_int(static_cast< int >(PRIMME_GD_plusK_Pipelined)));
   SWIG_Python_SetConstant(d, "primme_int",SWIG_From_int(static_cast< int >(primme_int)));
   SWIG_Python_SetConstant(d, "primme_double",SWIG_From_int(static_cast< int >(primme_double)));
   SWIG_Python_SetConstant(d, "primme_pointer",SWIG_From_int(static_cast< int >(primme_pointer)));
@@ -20859,6 +22457,8 @@ SWIG_init(void) {
   SWIG_Python_SetConstant(d, "PRIMME_preconditioner",SWIG_From_int(static_cast< int >(PRIMME_preconditioner)));
   SWIG_Python_SetConstant(d, "PRIMME_initBasisMode",SWIG_From_int(static_cast< int >(PRIMME_initBasisMode)));
   SWIG_Python_SetConstant(d, "PRIMME_projectionParams_projection",SWIG_From_int(static_cast< int >(PRIMME_projectionParams_projection)));
+  SWIG_Python_SetConstant(d, "PRIMME_projectionParams_pipeline",SWIG_From_int(static_cast< int >(PRIMME_projectionParams_pipeline)));
+  SWIG_Python_SetConstant(d, "PRIMME_projectionParams_redundantSolve",SWIG_From_int(static_cast< int >(PRIMME_projectionParams_redundantSolve)));
   SWIG_Python_SetConstant(d, "PRIMME_restartingParams_scheme",SWIG_From_int(static_cast< int >(PRIMME_restartingParams_scheme)));
   SWIG_Python_SetConstant(d, "PRIMME_restartingParams_maxPrevRetain",SWIG_From_int(static_cast< int >(PRIMME_restartingParams_maxPrevRetain)));
   SWIG_Python_SetConstant(d, "PRIMME_correctionParams_precondition",SWIG_From_int(static_cast< int >(PRIMME_correctionParams_precondition)));
@@ -20872,6 +22472,8 @@ SWIG_init(void) {
   SWIG_Python_SetConstant(d, "PRIMME_correctionParams_projectors_SkewX",SWIG_From_int(static_cast< int >(PRIMME_correctionParams_projectors_SkewX)));
   SWIG_Python_SetConstant(d, "PRIMME_correctionParams_convTest",SWIG_From_int(static_cast< int >(PRIMME_correctionParams_convTest)));
   SWIG_Python_SetConstant(d, "PRIMME_correctionParams_relTolBase",SWIG_From_int(static_cast< int >(PRIMME_correctionParams_relTolBase)));
+  SWIG_Python_SetConstant(d, "PRIMME_correctionParams_storagePrecision",SWIG_From_int(static_cast< int >(PRIMME_correctionParams_storagePrecision)));
+  SWIG_Python_SetConstant(d, "PRIMME_correctionParams_pipeline",SWIG_From_int(static_cast< int >(PRIMME_correctionParams_pipeline)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_numOuterIterations",SWIG_From_int(static_cast< int >(PRIMME_stats_numOuterIterations)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_numRestarts",SWIG_From_int(static_cast< int >(PRIMME_stats_numRestarts)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_numMatvecs",SWIG_From_int(static_cast< int >(PRIMME_stats_numMatvecs)));
@@ -20879,11 +22481,21 @@ SWIG_init(void) {
   SWIG_Python_SetConstant(d, "PRIMME_stats_numGlobalSum",SWIG_From_int(static_cast< int >(PRIMME_stats_numGlobalSum)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_volumeGlobalSum",SWIG_From_int(static_cast< int >(PRIMME_stats_volumeGlobalSum)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_numOrthoInnerProds",SWIG_From_int(static_cast< int >(PRIMME_stats_numOrthoInnerProds)));
+  SWIG_Python_SetConstant(d, "PRIMME_stats_numInnerIterations",SWIG_From_int(static_cast< int >(PRIMME_stats_numInnerIterations)));
+  SWIG_Python_SetConstant(d, "PRIMME_stats_numInnerGlobalSum",SWIG_From_int(static_cast< int >(PRIMME_stats_numInnerGlobalSum)));
+  SWIG_Python_SetConstant(d, "PRIMME_stats_volumeRestart",SWIG_From_int(static_cast< int >(PRIMME_stats_volumeRestart)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_elapsedTime",SWIG_From_int(static_cast< int >(PRIMME_stats_elapsedTime)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_timeMatvec",SWIG_From_int(static_cast< int >(PRIMME_stats_timeMatvec)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_timePrecond",SWIG_From_int(static_cast< int >(PRIMME_stats_timePrecond)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_timeOrtho",SWIG_From_int(static_cast< int >(PRIMME_stats_timeOrtho)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_timeGlobalSum",SWIG_From_int(static_cast< int >(PRIMME_stats_timeGlobalSum)));
+  SWIG_Python_SetConstant(d, "PRIMME_stats_timeSolveH",SWIG_From_int(static_cast< int >(PRIMME_stats_timeSolveH)));
+  SWIG_Python_SetConstant(d, "PRIMME_stats_timeRestart",SWIG_From_int(static_cast< int >(PRIMME_stats_timeRestart)));
+  SWIG_Python_SetConstant(d, "PRIMME_stats_timeLocking",SWIG_From_int(static_cast< int >(PRIMME_stats_timeLocking)));
+  SWIG_Python_SetConstant(d, "PRIMME_stats_hwCounters",SWIG_From_int(static_cast< int >(PRIMME_stats_hwCounters)));
+  SWIG_Python_SetConstant(d, "PRIMME_stats_hwCycles",SWIG_From_int(static_cast< int >(PRIMME_stats_hwCycles)));
+  SWIG_Python_SetConstant(d, "PRIMME_stats_hwInstructions",SWIG_From_int(static_cast< int >(PRIMME_stats_hwInstructions)));
+  SWIG_Python_SetConstant(d, "PRIMME_stats_hwCacheMisses",SWIG_From_int(static_cast< int >(PRIMME_stats_hwCacheMisses)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_estimateMinEVal",SWIG_From_int(static_cast< int >(PRIMME_stats_estimateMinEVal)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_estimateMaxEVal",SWIG_From_int(static_cast< int >(PRIMME_stats_estimateMaxEVal)));
   SWIG_Python_SetConstant(d, "PRIMME_stats_estimateLargestSVal",SWIG_From_int(static_cast< int >(PRIMME_stats_estimateLargestSVal)));
@@ -20895,6 +22507,9 @@ SWIG_init(void) {
   SWIG_Python_SetConstant(d, "PRIMME_ldOPs",SWIG_From_int(static_cast< int >(PRIMME_ldOPs)));
   SWIG_Python_SetConstant(d, "PRIMME_monitorFun",SWIG_From_int(static_cast< int >(PRIMME_monitorFun)));
   SWIG_Python_SetConstant(d, "PRIMME_monitor",SWIG_From_int(static_cast< int >(PRIMME_monitor)));
+  SWIG_Python_SetConstant(d, "PRIMME_monitorStream",SWIG_From_int(static_cast< int >(PRIMME_monitorStream)));
+  SWIG_Python_SetConstant(d, "PRIMME_convTestBlockFun",SWIG_From_int(static_cast< int >(PRIMME_convTestBlockFun)));
+  SWIG_Python_SetConstant(d, "PRIMME_dynamicSizes",SWIG_From_int(static_cast< int >(PRIMME_dynamicSizes)));
   SWIG_Python_SetConstant(d, "primme_svds_largest",SWIG_From_int(static_cast< int >(primme_svds_largest)));
   SWIG_Python_SetConstant(d, "primme_svds_smallest",SWIG_From_int(static_cast< int >(primme_svds_smallest)));
   SWIG_Python_SetConstant(d, "primme_svds_closest_abs",SWIG_From_int(static_cast< int >(primme_svds_closest_abs)));
@@ -20956,6 +22571,7 @@ SWIG_init(void) {
   SWIG_Python_SetConstant(d, "PRIMME_SVDS_stats_timeGlobalSum",SWIG_From_int(static_cast< int >(PRIMME_SVDS_stats_timeGlobalSum)));
   SWIG_Python_SetConstant(d, "PRIMME_SVDS_monitorFun",SWIG_From_int(static_cast< int >(PRIMME_SVDS_monitorFun)));
   SWIG_Python_SetConstant(d, "PRIMME_SVDS_monitor",SWIG_From_int(static_cast< int >(PRIMME_SVDS_monitor)));
+  SWIG_Python_SetConstant(d, "PRIMME_SVDS_monitorStream",SWIG_From_int(static_cast< int >(PRIMME_SVDS_monitorStream)));
 #if PY_VERSION_HEX >= 0x03000000
   return m;
 #else
@@ -20,14 +20,14 @@ class SwigDirector_PrimmeParams : public PrimmeParams, public Swig::Director {
 public:
     SwigDirector_PrimmeParams(PyObject *self);
     virtual ~SwigDirector_PrimmeParams();
-    virtual void matvec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd);
-    virtual void matvec(int len1YD, int len2YD, int ldYD, std::complex< float > *yd, int len1XD, int len2XD, int ldXD, std::complex< float > *xd);
-    virtual void matvec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd);
-    virtual void matvec(int len1YD, int len2YD, int ldYD, std::complex< double > *yd, int len1XD, int len2XD, int ldXD, std::complex< double > *xd);
-    virtual void prevec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd);
-    virtual void prevec(int len1YD, int len2YD, int ldYD, std::complex< float > *yd, int len1XD, int len2XD, int ldXD, std::complex< float > *xd);
-    virtual void prevec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd);
-    virtual void prevec(int len1YD, int len2YD, int ldYD, std::complex< double > *yd, int len1XD, int len2XD, int ldXD, std::complex< double > *xd);
+    virtual void matvec(int64_t len1YD, int len2YD, int64_t ldYD, float *yd, int64_t len1XD, int len2XD, int64_t ldXD, float *xd);
+    virtual void matvec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< float > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< float > *xd);
+    virtual void matvec(int64_t len1YD, int len2YD, int64_t ldYD, double *yd, int64_t len1XD, int len2XD, int64_t ldXD, double *xd);
+    virtual void matvec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< double > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< double > *xd);
+    virtual void prevec(int64_t len1YD, int len2YD, int64_t ldYD, float *yd, int64_t len1XD, int len2XD, int64_t ldXD, float *xd);
+    virtual void prevec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< float > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< float > *xd);
+    virtual void prevec(int64_t len1YD, int len2YD, int64_t ldYD, double *yd, int64_t len1XD, int len2XD, int64_t ldXD, double *xd);
+    virtual void prevec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< double > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< double > *xd);
     virtual void globalSum(int lenYD, float *yd, int lenXD, float *xd);
     virtual void globalSum(int lenYD, double *yd, int lenXD, double *xd);
     virtual void mon(int lenbasisEvals, float *basisEvals, int lenbasisFlags, int *basisFlags, int leniblock, int *iblock, int lenbasisNorms, float *basisNorms, int numConverged, int lenlockedEvals, float *lockedEvals, int lenlockedFlags, int *lockedFlags, int lenlockedNorms, float *lockedNorms, int inner_its, float LSRes, int event);
@@ -73,14 +73,14 @@ class SwigDirector_PrimmeSvdsParams : public PrimmeSvdsParams, public Swig::Dire
 public:
     SwigDirector_PrimmeSvdsParams(PyObject *self);
     virtual ~SwigDirector_PrimmeSvdsParams();
-    virtual void matvec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd, int transpose);
-    virtual void matvec(int len1YD, int len2YD, int ldYD, std::complex< float > *yd, int len1XD, int len2XD, int ldXD, std::complex< float > *xd, int transpose);
-    virtual void matvec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd, int transpose);
-    virtual void matvec(int len1YD, int len2YD, int ldYD, std::complex< double > *yd, int len1XD, int len2XD, int ldXD, std::complex< double > *xd, int transpose);
-    virtual void prevec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd, int mode);
-    virtual void prevec(int len1YD, int len2YD, int ldYD, std::complex< float > *yd, int len1XD, int len2XD, int ldXD, std::complex< float > *xd, int mode);
-    virtual void prevec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd, int mode);
-    virtual void prevec(int len1YD, int len2YD, int ldYD, std::complex< double > *yd, int len1XD, int len2XD, int ldXD, std::complex< double > *xd, int mode);
+    virtual void matvec(int64_t len1YD, int len2YD, int64_t ldYD, float *yd, int64_t len1XD, int len2XD, int64_t ldXD, float *xd, int transpose);
+    virtual void matvec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< float > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< float > *xd, int transpose);
+    virtual void matvec(int64_t len1YD, int len2YD, int64_t ldYD, double *yd, int64_t len1XD, int len2XD, int64_t ldXD, double *xd, int transpose);
+    virtual void matvec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< double > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< double > *xd, int transpose);
+    virtual void prevec(int64_t len1YD, int len2YD, int64_t ldYD, float *yd, int64_t len1XD, int len2XD, int64_t ldXD, float *xd, int mode);
+    virtual void prevec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< float > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< float > *xd, int mode);
+    virtual void prevec(int64_t len1YD, int len2YD, int64_t ldYD, double *yd, int64_t len1XD, int len2XD, int64_t ldXD, double *xd, int mode);
+    virtual void prevec(int64_t len1YD, int len2YD, int64_t ldYD, std::complex< double > *yd, int64_t len1XD, int len2XD, int64_t ldXD, std::complex< double > *xd, int mode);
     virtual void globalSum(int lenYD, float *yd, int lenXD, float *xd);
     virtual void globalSum(int lenYD, double *yd, int lenXD, double *xd);
     virtual void mon(int lenbasisSvals, float *basisSvals, int lenbasisFlags, int *basisFlags, int leniblock, int *iblock, int lenbasisNorms, float *basisNorms, int numConverged, int lenlockedSvals, float *lockedSvals, int lenlockedFlags, int *lockedFlags, int lenlockedNorms, float *lockedNorms, int inner_its, float LSRes, int event, int stage);
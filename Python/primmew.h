@@ -37,9 +37,124 @@
 #include <cstring>
 #include <cassert>
 #include <complex>
+#include <mutex>
+#include <vector>
 
 #include "../include/primme.h"
 
+/* Sparse matrix given by the indptr, indices and data buffers of a CSR or  */
+/* CSC scipy.sparse matrix. The buffers are owned by the Python object.     */
+
+struct SparseMatrix {
+   int format;             /* 0: not set, 1: CSR, 2: CSC */
+   PRIMME_INT m, n;        /* number of rows and columns */
+   int indexSize;          /* size in bytes of the entries of indptr and indices */
+   int dataType;           /* NumPy type code of the entries of data */
+   void *indptr, *indices, *data;
+};
+
+/* Records of the monitor stream gathered by the consumer thread of the */
+/* stream until Python pops them                                        */
+
+struct MonitorBuffer {
+   std::mutex mutex;
+   std::vector<primme_monitor_record> records;
+
+   static void sink(const primme_monitor_record *records, int n, void *ctx) {
+      MonitorBuffer *b = static_cast<MonitorBuffer*>(ctx);
+      std::lock_guard<std::mutex> lock(b->mutex);
+      b->records.insert(b->records.end(), records, records + n);
+   }
+};
+
+/* Number of vectors accumulated together in the row-wise product */
+#define SPMM_BLOCK 8
+
+template <typename T>
+static inline T conj_if(T a, bool c) { (void)c; return a; }
+template <typename T>
+static inline std::complex<T> conj_if(std::complex<T> a, bool c) { return c ? std::conj(a) : a; }
+
+/* Computes y(i,:) = sum op(data[p])*x(indices[p],:) for p in [indptr[i],   */
+/* indptr[i+1]), that is, y = A*x if A is CSR and y = A'*x if A is CSC. The */
+/* rows are independent, and up to SPMM_BLOCK vectors are accumulated while */
+/* the row is traversed once.                                               */
+
+template <typename T, typename I>
+static void spmm_gather(PRIMME_INT rows, const I *indptr, const I *indices,
+      const T *data, bool conj, int nx, const T *x, PRIMME_INT ldx, T *y,
+      PRIMME_INT ldy) {
+   PRIMME_INT i;
+
+   #ifdef _OPENMP
+   #pragma omp parallel for schedule(static) if (rows > 1000)
+   #endif
+   for (i=0; i<rows; i++) {
+      for (int j0=0; j0<nx; j0+=SPMM_BLOCK) {
+         const int nb = nx - j0 < SPMM_BLOCK ? nx - j0 : SPMM_BLOCK;
+         T acc[SPMM_BLOCK];
+         for (int j=0; j<nb; j++) acc[j] = 0.0;
+         for (I p=indptr[i]; p<indptr[i+1]; p++) {
+            const T a = conj_if(data[p], conj);
+            const T *xp = &x[ldx*j0 + indices[p]];
+            for (int j=0; j<nb; j++) acc[j] += a*xp[ldx*j];
+         }
+         for (int j=0; j<nb; j++) y[ldy*(j0+j) + i] = acc[j];
+      }
+   }
+}
+
+/* Computes y(indices[p],:) += op(data[p])*x(k,:) for p in [indptr[k],      */
+/* indptr[k+1]), that is, y = A'*x if A is CSR and y = A*x if A is CSC.     */
+/* Every vector is updated by a different thread.                           */
+
+template <typename T, typename I>
+static void spmm_scatter(PRIMME_INT cols, PRIMME_INT rows, const I *indptr,
+      const I *indices, const T *data, bool conj, int nx, const T *x,
+      PRIMME_INT ldx, T *y, PRIMME_INT ldy) {
+   int j;
+
+   #ifdef _OPENMP
+   #pragma omp parallel for schedule(static) if (nx > 1)
+   #endif
+   for (j=0; j<nx; j++) {
+      const T *xj = &x[ldx*j];
+      T *yj = &y[ldy*j];
+      for (PRIMME_INT i=0; i<rows; i++) yj[i] = 0.0;
+      for (PRIMME_INT k=0; k<cols; k++) {
+         const T xk = xj[k];
+         if (xk == T(0.0)) continue;
+         for (I p=indptr[k]; p<indptr[k+1]; p++)
+            yj[indices[p]] += conj_if(data[p], conj)*xk;
+      }
+   }
+}
+
+/* Computes y = A*x if transpose is zero, and y = A'*x otherwise */
+
+template <typename T, typename I>
+static void sparse_matvec(const SparseMatrix *A, int transpose, int nx,
+      const T *x, PRIMME_INT ldx, T *y, PRIMME_INT ldy) {
+   const PRIMME_INT nptr = A->format == 1 ? A->m : A->n;
+   const PRIMME_INT nidx = A->format == 1 ? A->n : A->m;
+   const I *indptr = (const I*)A->indptr, *indices = (const I*)A->indices;
+   const T *data = (const T*)A->data;
+
+   if ((A->format == 1) == (transpose == 0))
+      spmm_gather(nptr, indptr, indices, data, transpose != 0, nx, x, ldx, y, ldy);
+   else
+      spmm_scatter(nptr, nidx, indptr, indices, data, transpose != 0, nx, x, ldx, y, ldy);
+}
+
+template <typename T>
+static void sparse_matvec(const SparseMatrix *A, int transpose, int nx,
+      const T *x, PRIMME_INT ldx, T *y, PRIMME_INT ldy) {
+   if (A->indexSize == 4)
+      sparse_matvec<T, int32_t>(A, transpose, nx, x, ldx, y, ldy);
+   else
+      sparse_matvec<T, int64_t>(A, transpose, nx, x, ldx, y, ldy);
+}
+
 class PrimmeParams : public primme_params {
    public:
 
@@ -48,10 +163,17 @@ class PrimmeParams : public primme_params {
       correctionParams.precondition = 0;
       globalSum_set = 0;
       monitor_set = 0;
+      matvec_out_set = 0;
+      sparse.format = 0;
+      monitorBuffer = NULL;
    }
 
    virtual ~PrimmeParams() {
       if (targetShifts) delete [] targetShifts;
+      if (monitorBuffer) {
+         primme_monitor_stream_close(monitorStream, NULL);
+         delete monitorBuffer;
+      }
       primme_free(static_cast<primme_params*>(this));
    }
 
@@ -79,14 +201,14 @@ class PrimmeParams : public primme_params {
       *n = this->numTargetShifts;
    }
 
-   virtual void matvec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd)=0;
-   virtual void matvec(int len1YD, int len2YD, int ldYD, std::complex<float> *yd, int len1XD, int len2XD, int ldXD, std::complex<float> *xd)=0;
-   virtual void matvec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd)=0;
-   virtual void matvec(int len1YD, int len2YD, int ldYD, std::complex<double> *yd, int len1XD, int len2XD, int ldXD, std::complex<double> *xd)=0;
-   virtual void prevec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd)=0;
-   virtual void prevec(int len1YD, int len2YD, int ldYD, std::complex<float> *yd, int len1XD, int len2XD, int ldXD, std::complex<float> *xd)=0;
-   virtual void prevec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd)=0;
-   virtual void prevec(int len1YD, int len2YD, int ldYD, std::complex<double> *yd, int len1XD, int len2XD, int ldXD, std::complex<double> *xd)=0;
+   virtual void matvec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, float *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, float *xd)=0;
+   virtual void matvec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, std::complex<float> *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, std::complex<float> *xd)=0;
+   virtual void matvec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, double *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, double *xd)=0;
+   virtual void matvec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, std::complex<double> *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, std::complex<double> *xd)=0;
+   virtual void prevec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, float *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, float *xd)=0;
+   virtual void prevec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, std::complex<float> *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, std::complex<float> *xd)=0;
+   virtual void prevec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, double *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, double *xd)=0;
+   virtual void prevec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, std::complex<double> *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, std::complex<double> *xd)=0;
    virtual void globalSum(int lenYD, float *yd, int lenXD, float *xd)=0;
    virtual void globalSum(int lenYD, double *yd, int lenXD, double *xd)=0;
    int globalSum_set;
@@ -99,6 +221,9 @@ class PrimmeParams : public primme_params {
       int lenlockedEvals, double *lockedEvals, int lenlockedFlags, int *lockedFlags, int lenlockedNorms, double *lockedNorms,
       int inner_its, double LSRes, int event)=0;
    int monitor_set;
+   int matvec_out_set;  /* if nonzero, call matvec(X, out=Y) instead of Y=matvec(X) */
+   SparseMatrix sparse; /* if set, the products are done in C++ with this matrix */
+   MonitorBuffer *monitorBuffer; /* if set, records of monitorStream */
 };
 
 class PrimmeSvdsParams : public primme_svds_params {
@@ -109,10 +234,17 @@ class PrimmeSvdsParams : public primme_svds_params {
       precondition = 0;
       globalSum_set = 0;
       monitor_set = 0;
+      matvec_out_set = 0;
+      sparse.format = 0;
+      monitorBuffer = NULL;
    }
 
    virtual ~PrimmeSvdsParams() {
       if (targetShifts) delete [] targetShifts;
+      if (monitorBuffer) {
+         primme_monitor_stream_close(monitorStream, NULL);
+         delete monitorBuffer;
+      }
       primme_svds_free(static_cast<primme_svds_params*>(this));
    }
 
@@ -141,14 +273,14 @@ class PrimmeSvdsParams : public primme_svds_params {
       *n = this->numTargetShifts;
    }
 
-   virtual void matvec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd, int transpose)=0;
-   virtual void matvec(int len1YD, int len2YD, int ldYD, std::complex<float> *yd, int len1XD, int len2XD, int ldXD, std::complex<float> *xd, int transpose)=0;
-   virtual void matvec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd, int transpose)=0;
-   virtual void matvec(int len1YD, int len2YD, int ldYD, std::complex<double> *yd, int len1XD, int len2XD, int ldXD, std::complex<double> *xd, int transpose)=0;
-   virtual void prevec(int len1YD, int len2YD, int ldYD, float *yd, int len1XD, int len2XD, int ldXD, float *xd, int mode)=0;
-   virtual void prevec(int len1YD, int len2YD, int ldYD, std::complex<float> *yd, int len1XD, int len2XD, int ldXD, std::complex<float> *xd, int mode)=0;
-   virtual void prevec(int len1YD, int len2YD, int ldYD, double *yd, int len1XD, int len2XD, int ldXD, double *xd, int mode)=0;
-   virtual void prevec(int len1YD, int len2YD, int ldYD, std::complex<double> *yd, int len1XD, int len2XD, int ldXD, std::complex<double> *xd, int mode)=0;
+   virtual void matvec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, float *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, float *xd, int transpose)=0;
+   virtual void matvec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, std::complex<float> *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, std::complex<float> *xd, int transpose)=0;
+   virtual void matvec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, double *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, double *xd, int transpose)=0;
+   virtual void matvec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, std::complex<double> *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, std::complex<double> *xd, int transpose)=0;
+   virtual void prevec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, float *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, float *xd, int mode)=0;
+   virtual void prevec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, std::complex<float> *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, std::complex<float> *xd, int mode)=0;
+   virtual void prevec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, double *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, double *xd, int mode)=0;
+   virtual void prevec(PRIMME_INT len1YD, int len2YD, PRIMME_INT ldYD, std::complex<double> *yd, PRIMME_INT len1XD, int len2XD, PRIMME_INT ldXD, std::complex<double> *xd, int mode)=0;
    virtual void globalSum(int lenYD, float *yd, int lenXD, float *xd)=0;
    virtual void globalSum(int lenYD, double *yd, int lenXD, double *xd)=0;
    int globalSum_set;
@@ -161,4 +293,7 @@ class PrimmeSvdsParams : public primme_svds_params {
       int lenlockedSvals, double *lockedSvals, int lenlockedFlags, int *lockedFlags, int lenlockedNorms, double *lockedNorms,
       int inner_its, double LSRes, int event, int stage)=0;
    int monitor_set;
+   int matvec_out_set;  /* if nonzero, call matvec(X, transpose, out=Y) instead of Y=matvec(X, transpose) */
+   SparseMatrix sparse; /* if set, the products are done in C++ with this matrix */
+   MonitorBuffer *monitorBuffer; /* if set, records of monitorStream */
 };
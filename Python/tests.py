@@ -187,6 +187,45 @@ def test_primme_eigsh_matrix_types():
                       (MikotaPair.__name__, n, dtype, k, prec is None, which, sigma))
          yield (eigsh_check, eigsh, op(A), k, M, which, sigma, 1e-6, evals, case_desc)
 
+def eigsh_generalized_check(A, B, k, which, tol, exact_evals, case_desc):
+   """
+   Test eigsh with a mass matrix
+   """
+
+   try:
+      evals, evecs = eigsh(A, k, B, which=which, tol=tol)
+   except Exception as e:
+      raise Exception("Ups! Case %s\n%s" % (case_desc, e))
+   sol_evals = select_pairs_eigsh(k, None, which, exact_evals)
+
+   # Check eigenvalues are close enough to the exact ones
+   ANorm = np.amax(np.fabs(exact_evals))
+   assert_allclose(evals, sol_evals, atol=ANorm*tol, rtol=1, err_msg=case_desc)
+
+   # Check the residual norm of the equivalent standard problem
+   L = np.linalg.cholesky(B.toarray() if hasattr(B, "toarray") else B)
+   R = np.linalg.solve(L, A.dot(evecs) - B.dot(evecs).dot(np.diag(evals)))
+   Rnorms = np.linalg.norm(R, axis=0)
+   assert_allclose(Rnorms, np.zeros(k), atol=ANorm*tol*(k**.5), rtol=1, err_msg=case_desc)
+
+def test_primme_eigsh_generalized():
+   """
+   Test cases for Primme.eigsh with a mass matrix M.
+   """
+
+   for n in (5, 100):
+      for dtype in (np.float32, np.complex64, np.float64, np.complex128):
+         tol = np.finfo(dtype).eps**.5 * 0.1
+         for gen in (ElasticRod, MikotaPair):
+            A, B = gen(n, dtype=dtype)
+            evals = np.linalg.eigvalsh(toStandardProblem((A, B)))
+            for op in ((lambda x : x), csr_matrix):
+               for which in ('LA', 'SA'):
+                  for k in (1, 3):
+                     case_desc = ("A=%s(%d, %s), k=%d, B=%s, which=%s" %
+                           (gen.__name__, n, dtype, k, type(op(B)).__name__, which))
+                     yield (eigsh_generalized_check, A, op(B), k, which, tol, evals, case_desc)
+
 
 def select_pairs_svds(k, which, svals):
    """
@@ -279,10 +318,16 @@ def test_return_stats():
     evals, evecs, stats = Primme.eigsh(A, 3, tol=1e-6, which='LA',
             return_stats=True, return_history=True)
     assert(stats["hist"]["numMatvecs"])
+    assert(all(len(v) == len(stats["hist"]["numMatvecs"])
+               for v in stats["hist"].values()))
+    assert(stats["hist"]["numMatvecs"][-1] <= stats["numMatvecs"])
+    assert(np.all(np.diff(stats["hist"]["numMatvecs"]) >= 0))
 
     svecs_left, svals, svecs_right, stats = Primme.svds(A, 3, tol=1e-6,
             which='SM', return_stats=True, return_history=True)
     assert(stats["hist"]["numMatvecs"])
+    assert(all(len(v) == len(stats["hist"]["numMatvecs"])
+               for v in stats["hist"].values()))
 
 
 if __name__ == "__main__":
@@ -1,4 +1,8 @@
+import warnings
 import numpy as np
+import scipy.linalg
+import scipy.sparse
+import scipy.sparse.linalg
 from scipy.sparse.linalg.interface import aslinearoperator
 
 __docformat__ = "restructuredtext en"
@@ -96,6 +100,128 @@ class PrimmeSvdsError(RuntimeError):
         RuntimeError.__init__(self, "PRIMME SVDS error %d: %s" % (err, msg))
 
 
+def _matmat_out(A, dtype):
+    """
+    Return a function f(X, Y, transpose=0) that stores A*X, or A.H*X if
+    transpose is nonzero, into the preallocated array Y, or None if A is not
+    a dense array.
+
+    It is used to pass the matrix-vector product to PRIMME with the
+    out-parameter protocol (see PrimmeParams.matvec_out_set), which avoids
+    allocating and copying a new array at every call.
+    """
+
+    if isinstance(A, np.ndarray) and A.ndim == 2:
+        A = np.asarray(A, dtype=dtype)
+        AH = A.T.conj()
+        def matmat(X, Y, transpose=0):
+            np.matmul(A if transpose == 0 else AH, X, out=Y)
+        return matmat
+
+    return None
+
+def _set_sparse_matrix(pp, A, dtype):
+    """
+    If A is a sparse matrix, pass its CSR or CSC buffers to PRIMME, which
+    then computes the products with A and A.H without calling Python, and
+    return True. Otherwise return False.
+    """
+
+    if not scipy.sparse.issparse(A):
+        return False
+    if A.format not in ('csr', 'csc'):
+        A = A.tocsr()
+    indptr, indices = A.indptr, A.indices
+    if indptr.dtype != indices.dtype or indptr.dtype.type not in (np.int32, np.int64):
+        indptr, indices = indptr.astype(np.int64), indices.astype(np.int64)
+    buffers = (np.ascontiguousarray(indptr), np.ascontiguousarray(indices),
+               np.ascontiguousarray(A.data, dtype=dtype))
+    pp._set_sparse_matrix(1 if A.format == 'csr' else 2, *buffers)
+    # Keep the buffers alive as long as pp
+    pp._sparse_buffers = buffers
+    return True
+
+# Layout of primme_monitor_record (see primme_eigs.h)
+_monitor_record_dtype = np.dtype([
+    ("time", np.float64), ("value", np.float64), ("resNorm", np.float64),
+    ("LSRes", np.float64), ("numMatvecs", np.int64),
+    ("numOuterIterations", np.int64), ("event", np.int32),
+    ("index", np.int32), ("numConverged", np.int32), ("stage", np.int32)])
+
+def _monitor_stream_capacity(maxIterations, maxBlockSize):
+    """
+    Return the number of records buffered in the monitor stream: one for
+    every pair of the block at every outer iteration, between 2**12 and
+    2**20. The consumer thread empties the buffer while PRIMME runs, so the
+    buffer only fills up if the thread falls behind.
+    """
+
+    n = max(maxIterations, 1) * max(maxBlockSize, 1)
+    return int(min(max(n, 1 << 12), 1 << 20))
+
+def _monitor_history(pp, value):
+    """
+    Close the monitor stream of pp and return the history reported in the
+    stats of eigsh and svds: the first pair of the block at every outer
+    iteration.
+
+    The records are gathered by a background thread while PRIMME runs, so
+    PRIMME does not call Python or take the GIL at every iteration.
+    """
+
+    data, dropped = pp._close_monitor_stream()
+    if dropped > 0:
+        warnings.warn("the history misses %d records because the monitor "
+                      "stream was full" % dropped, RuntimeWarning)
+    r = np.frombuffer(data, dtype=_monitor_record_dtype)
+    r = r[(r["event"] == 0) & (r["index"] == 0)]
+    return {"numMatvecs": r["numMatvecs"].tolist(),
+            "elapsedTime": r["time"].tolist(),
+            "nconv": r["numConverged"].tolist(),
+            value: r["value"].tolist(),
+            "resNorm": r["resNorm"].tolist()}
+
+def _mass_factor(M, dtype):
+    """
+    Return functions (G, GH, Ginv, GHinv) that apply G, G.H, inv(G) and
+    inv(G.H) to a block of vectors, where M = G*G.H and M is Hermitian
+    positive definite.
+
+    If M is sparse, G = P.T*L*sqrt(D), from the factorization
+    P*M*P.T = L*D*L.H computed by SuperLU in symmetric mode without
+    pivoting. Otherwise G is the Cholesky factor of M.
+    """
+
+    if scipy.sparse.issparse(M):
+        lu = scipy.sparse.linalg.splu(scipy.sparse.csc_matrix(M, dtype=dtype),
+                permc_spec='MMD_AT_PLUS_A', diag_pivot_thresh=0.,
+                options=dict(SymmetricMode=True))
+        d = lu.U.diagonal()
+        if np.any(lu.perm_r != lu.perm_c) or np.any(d.real <= 0):
+            raise ValueError('M: expected a Hermitian positive definite matrix')
+        L, LH = lu.L.tocsr(), lu.L.T.conj().tocsr()
+        s = np.sqrt(d.real).astype(dtype).reshape((-1, 1))
+        p, pinv = lu.perm_c, np.argsort(lu.perm_c)
+        solve = scipy.sparse.linalg.spsolve_triangular
+        G = lambda X: L.dot(s*X)[p]
+        GH = lambda X: s*LH.dot(X[pinv])
+        Ginv = lambda X: solve(L, X[pinv], lower=True, unit_diagonal=True)/s
+        GHinv = lambda X: solve(LH, X/s, lower=False, unit_diagonal=True)[p]
+    elif isinstance(M, np.ndarray):
+        try:
+            L = scipy.linalg.cholesky(np.asarray(M, dtype=dtype), lower=True)
+        except np.linalg.LinAlgError:
+            raise ValueError('M: expected a Hermitian positive definite matrix')
+        solve = scipy.linalg.solve_triangular
+        G = lambda X: L.dot(X)
+        GH = lambda X: L.T.conj().dot(X)
+        Ginv = lambda X: solve(L, X, lower=True)
+        GHinv = lambda X: solve(L, X, lower=True, trans='C')
+    else:
+        raise ValueError('M: expected a dense or a sparse matrix')
+    return G, GH, Ginv, GHinv
+
+
 def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
           ncv=None, maxiter=None, tol=0, return_eigenvectors=True,
           Minv=None, OPinv=None, mode='normal', ortho=None,
@@ -117,18 +243,35 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     A : An N x N matrix, array, sparse matrix, or LinearOperator
         the operation A * x, where A is a real symmetric matrix or complex
         Hermitian.
+        The products with a sparse matrix are computed in C without calling
+        back to Python. The solver releases the GIL, and only the
+        callbacks to Python code acquire it.
     k : int, optional
         The number of eigenvalues and eigenvectors to be computed. Must be
         1 <= k < min(A.shape).
-    M : An N x N matrix, array, sparse matrix, or LinearOperator
-        (not supported yet)
+    M : An N x N matrix, array, or sparse matrix, optional
         the operation M * x for the generalized eigenvalue problem
 
             A * x = w * M * x.
 
-        M must represent a real, symmetric matrix if A is real, and must
-        represent a complex, Hermitian matrix if A is complex. For best
-        results, the data type of M should be the same as that of A.
+        M must represent a real, symmetric positive definite matrix if A
+        is real, and must represent a complex, Hermitian positive definite
+        matrix if A is complex. For best results, the data type of M should
+        be the same as that of A.
+        PRIMME has no support for M-inner products, so the problem is
+        solved as the standard problem
+        inv(G) * A * inv(G.H) * y = w * y, where M = G * G.H and
+        x = inv(G.H) * y. G is computed once before the solver starts:
+        the Cholesky factor of M if M is dense, which costs O(N^3) flops
+        and N^2 memory, or the LDL' factorization of SuperLU if M is sparse,
+        whose cost and memory depend on the fill-in. Every product with
+        the transformed operator also applies two triangular solves with G.
+        The returned eigenvectors are M-orthonormal and the vectors in
+        ortho should be M-orthonormal. The tolerance, the residual norms
+        in stats and the matrix-vector products counted in stats refer to
+        the transformed operator; the residual norm of a pair is
+        ||inv(G) * (A*x - w*M*x)||, the inv(M)-norm of the residual of the
+        generalized problem.
     sigma : real, optional
         Find eigenvalues near sigma.
     v0 : N x i, ndarray, optional
@@ -210,7 +353,8 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
         - "estimateMinEVal": the leftmost Ritz value seen
         - "estimateMaxEVal": the rightmost Ritz value seen
         - "estimateLargestSVal": the largest singular value seen
-        - "rnorms" : ||A*x[i] - x[i]*w[i]||
+        - "rnorms" : ||A*x[i] - x[i]*w[i]||, or
+          ||inv(G)*(A*x[i] - M*x[i]*w[i])|| if M is given (see M)
         - "hist" : (if return_history) report at every outer iteration of:
 
           - "elapsedTime": time spent up to now
@@ -258,31 +402,25 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     array([ 96.,  95.,  94.])
     """
 
-    A = aslinearoperator(A)
+    Aorig, A = A, aslinearoperator(A)
     if len(A.shape) != 2 or A.shape[0] != A.shape[1]:
         raise ValueError('A: expected square matrix (shape=%s)' % (A.shape,))
 
-    if M is not None:
-        raise ValueError('generalized problems (M != None) are not supported')
-
-    hist = {"numMatvecs": [], "elapsedTime": [], "nconv": [],
-            "eval": [], "resNorm": []}
+    if M is not None and M.shape != A.shape:
+        raise ValueError('M: expected matrix with the same shape as A (shape=%s)' % (M.shape,))
 
     class PP(PrimmeParams):
         def __init__(self):
             PrimmeParams.__init__(self)
-        def matvec(self, X):
-            return A.matmat(X)
+        def matvec(self, X, out=None):
+            if out is not None:
+                matmat_out(X, out)
+            else:
+                return A.matmat(X)
         def prevec(self, X):
+            if M is not None:
+                return GH(OPinv.matmat(G(X)))
             return OPinv.matmat(X)
-        def mon(self, basisEvals, basisFlags, iblock, basisNorms, numConverged,
-                    lockedEvals, lockedFlags, lockedNorms, inner_its, LSRes, event):
-            if event == 0 and len(iblock)>0: # event iteration
-                hist["numMatvecs"].append(self.stats.numMatvecs)
-                hist["elapsedTime"].append(self.stats.elapsedTime)
-                hist["nconv"].append(numConverged)
-                hist["eval"].append(basisEvals[iblock[0]])
-                hist["resNorm"].append(basisNorms[iblock[0]])
 
     pp = PP()
  
@@ -341,9 +479,6 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
             raise ValueError('ortho: expected matrix with the same columns as A (shape=%s)' % (ortho.shape,))
         pp.numOrthoConst = min(ortho.shape[1], pp.n)
 
-    if return_history and return_stats:
-        pp.monitor_set = 1
-
     # Set other parameters
     for dk, dv in kargs.items():
       setattr(pp, dk, dv)
@@ -352,6 +487,8 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
         dtype = np.dtype("d")
     else:
         dtype = A.dtype
+    if M is not None and M.dtype.kind == 'c':
+        dtype = np.result_type(dtype, M.dtype)
 
     if dtype.type is np.complex64:
         Xprimme = cprimme
@@ -366,17 +503,33 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
         Xprimme = zprimme
         rtype = np.dtype(np.float64)
 
+    matmat_out = None
+    if M is not None:
+        # Solve inv(G)*A*inv(G.H) * y = w * y, where M = G*G.H
+        G, GH, Ginv, GHinv = _mass_factor(M, dtype)
+        def matmat_out(X, Y):
+            np.copyto(Y, Ginv(A.matmat(GHinv(X))), casting='unsafe')
+        pp.matvec_out_set = 1
+    elif not _set_sparse_matrix(pp, Aorig, dtype):
+        matmat_out = _matmat_out(Aorig, dtype)
+        pp.matvec_out_set = 0 if matmat_out is None else 1
+
     evals = np.zeros(pp.numEvals, rtype)
     norms = np.zeros(pp.numEvals, rtype)
     evecs = np.zeros((pp.n, pp.numOrthoConst+pp.numEvals), dtype, order='F')
 
     if ortho is not None:
         np.copyto(evecs[:, 0:pp.numOrthoConst], ortho[:, 0:pp.numOrthoConst])
+        if M is not None:
+            evecs[:, 0:pp.numOrthoConst] = GH(evecs[:, 0:pp.numOrthoConst])
 
     if v0 is not None:
         pp.initSize = min(v0.shape[1], pp.numEvals)
         np.copyto(evecs[:, pp.numOrthoConst:pp.numOrthoConst+pp.initSize],
             v0[:, 0:pp.initSize])
+        if M is not None:
+            evecs[:, pp.numOrthoConst:pp.numOrthoConst+pp.initSize] = \
+                GH(evecs[:, pp.numOrthoConst:pp.numOrthoConst+pp.initSize])
 
     if maxBlockSize:
         pp.maxBlockSize = maxBlockSize
@@ -390,14 +543,23 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     if method is not None:
         pp.set_method(method)
  
+    if return_history and return_stats:
+        pp._open_monitor_stream(_monitor_stream_capacity(
+            min(pp.maxOuterIterations, pp.maxMatvecs), pp.maxBlockSize))
+
     err = Xprimme(evals, evecs, norms, pp)
 
+    if return_history and return_stats:
+        hist = _monitor_history(pp, "eval")
+
     if err != 0:
         raise PrimmeError(err)
 
     evals = evals[0:pp.initSize]
     norms = norms[0:pp.initSize]
     evecs = evecs[:, pp.numOrthoConst:pp.numOrthoConst+pp.initSize]
+    if M is not None:
+        evecs = GHinv(evecs)
 
     if return_stats:
         stats = dict((f, getattr(pp.stats, f)) for f in [
@@ -426,6 +588,9 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
     ----------
     A : {sparse matrix, LinearOperator}
         Array to compute the SVD on, of shape (M, N)
+        The products with a sparse matrix are computed in C without calling
+        back to Python. The solver releases the GIL, and only the
+        callbacks to Python code acquire it.
     k : int, optional
         Number of singular values and vectors to compute.
         Must be 1 <= k < min(A.shape).
@@ -547,7 +712,7 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
     ['5.99871', '5.99057', '6.01065']
     """
 
-    A = aslinearoperator(A)
+    Aorig, A = A, aslinearoperator(A)
 
     m, n = A.shape
 
@@ -569,15 +734,14 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
         if precAug.shape[0] != precAug.shape[1] or precAug.shape[0] != m+n:
             raise ValueError('precAug: expected square matrix with size %d' % (m+n))
 
-    hist = {"numMatvecs": [], "elapsedTime": [], "nconv": [],
-            "sval": [], "resNorm": []}
-
     class PSP(PrimmeSvdsParams):
         def __init__(self):
             PrimmeSvdsParams.__init__(self)
 
-        def matvec(self, X, transpose):
-            if transpose == 0:
+        def matvec(self, X, transpose, out=None):
+            if out is not None:
+                matmat_out(X, out, transpose)
+            elif transpose == 0:
                 return A.matmat(X)
             else:
                 return A.H.matmat(X) 
@@ -591,16 +755,6 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
                 return precAug.matmat(X) 
             return X
 
-        def mon(self, basisSvals, basisFlags, iblock, basisNorms, numConverged,
-                    lockedSvals, lockedFlags, lockedNorms, inner_its, LSRes,
-                    event, stage):
-            if event == 0 and len(iblock)>0: # event iteration
-                hist["numMatvecs"].append(self.stats.numMatvecs)
-                hist["elapsedTime"].append(self.stats.elapsedTime)
-                hist["nconv"].append(numConverged)
-                hist["sval"].append(basisSvals[iblock[0]])
-                hist["resNorm"].append(basisNorms[iblock[0]])
-
     pp = PSP()
 
     pp.m = A.shape[0]
@@ -661,9 +815,6 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
     if orthou0 is not None:
         pp.numOrthoConst = min(orthou0.shape[1], min(m,n))
 
-    if return_history and return_stats:
-        pp.monitor_set = 1
-
     # Set other parameters
     for dk, dv in kargs.items():
       setattr(pp, dk, dv)
@@ -686,6 +837,11 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
         Xprimme_svds = zprimme_svds
         rtype = np.dtype(np.float64)
 
+    matmat_out = None
+    if not _set_sparse_matrix(pp, Aorig, dtype):
+        matmat_out = _matmat_out(Aorig, dtype)
+        pp.matvec_out_set = 0 if matmat_out is None else 1
+
     svals = np.zeros(pp.numSvals, rtype)
     svecsl = np.zeros((pp.m, pp.numOrthoConst+pp.numSvals), dtype, order='F')
     svecsr = np.zeros((pp.n, pp.numOrthoConst+pp.numSvals), dtype, order='F')
@@ -709,8 +865,15 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
         if methodStage2 is None: methodStage2 = PRIMME_DEFAULT_METHOD
         pp.set_method(method, methodStage1, methodStage2)
 
+    if return_history and return_stats:
+        pp._open_monitor_stream(_monitor_stream_capacity(pp.maxMatvecs,
+            pp.maxBlockSize))
+
     err = Xprimme_svds(svals, svecsl, svecsr, norms, pp)
 
+    if return_history and return_stats:
+        hist = _monitor_history(pp, "sval")
+
     if err != 0:
         raise PrimmeSvdsError(err)
 
@@ -38,6 +38,9 @@
 #include <R.h>
 #include <Rcpp.h>
 #include <algorithm>
+#include <climits>
+#include <numeric>
+#include <vector>
 #include "primme.h"
 #include "PRIMME_types.h"
 #include <R_ext/BLAS.h> // for BLAS and F77_NAME
@@ -135,6 +138,9 @@ void xgemm(const char *transa, const char *transb, int m, int n, int k,
 
 template <typename T, typename S>
 S createMatrix(T *x, PRIMME_INT m, int n, PRIMME_INT ld) {
+   // R matrices have int dimensions
+   if (m > INT_MAX)
+      stop("vectors with more than INT_MAX rows are not supported in R");
    if (ld == m) {
       return S((int)m, (int)n, x);
    }
@@ -156,7 +162,7 @@ S createMatrix(T *x, PRIMME_INT m, int n, PRIMME_INT ld) {
 // Return: Matrix<S>
 
 template <typename S, typename T>
-void copyMatrix_raw(S *x, int m, int n, int ldx, T *y, int ldy) {
+void copyMatrix_raw(S *x, PRIMME_INT m, int n, PRIMME_INT ldx, T *y, PRIMME_INT ldy) {
    if (ldx == m && ldy == m) {
       std::copy(x, x+m*n, y);
    }
@@ -168,12 +174,12 @@ void copyMatrix_raw(S *x, int m, int n, int ldx, T *y, int ldy) {
 }
 
 template<>
-void copyMatrix_raw<Rcomplex, double>(Rcomplex *x, int m, int n, int ldx, double *y, int ldy) {
+void copyMatrix_raw<Rcomplex, double>(Rcomplex *x, PRIMME_INT m, int n, PRIMME_INT ldx, double *y, PRIMME_INT ldy) {
    stop("Unsupported to return complex values when using dprimme/dprimme_svds");
 }
 
 template<>
-void copyMatrix_raw<double, Rcomplex>(double *x, int m, int n, int ldx, Rcomplex *y, int ldy) {
+void copyMatrix_raw<double, Rcomplex>(double *x, PRIMME_INT m, int n, PRIMME_INT ldx, Rcomplex *y, PRIMME_INT ldy) {
    copyMatrix_raw(x, m, n, ldx, (PRIMME_COMPLEX_DOUBLE*)y, ldy);
 }
 
@@ -235,6 +241,131 @@ inline void checkUserInterrupt(const T* primme) {
    }
 }
 
+// Native products with CSC matrices from the Matrix package (dgCMatrix,
+// dsCMatrix, zgCMatrix and zsCMatrix). Every product is computed as
+//
+//    Y(j,:) = sum_{p=p[j]}^{p[j+1]-1} op(x[p]) * X(i[p],:), j=0,...,n-1,
+//
+// that is, gathering over the columns of a CSC matrix, so that every row of Y
+// is written by a single thread. A'*X uses the columns of A as they are
+// stored in the CHM_SP. A*X uses the columns of the transpose of A, which is
+// built once before calling PRIMME. If the matrix has symmetric storage, the
+// full Hermitian matrix is built instead and used for both products.
+
+static const int CSC_BLOCK = 8;   // number of vectors processed at a time
+
+inline double conjValue(double x) { return x; }
+inline PRIMME_COMPLEX_DOUBLE conjValue(const PRIMME_COMPLEX_DOUBLE &x) {
+   return std::conj(x);
+}
+
+template <typename T>
+struct CSCOperand {
+   PRIMME_INT n;           // number of columns (rows of Y)
+   const int *p, *i;       // column pointers and row indices
+   const T *x;             // values
+   bool conj;              // if true, op(x) = conj(x); otherwise op(x) = x
+};
+
+template <typename T>
+struct CSCMatrix {
+   CSCOperand<T> N;        // used for A*X
+   CSCOperand<T> C;        // used for A'*X
+   std::vector<int> p, i;  // transpose of A, or full A if symmetric storage
+   std::vector<T> x;
+};
+
+// Return a CSCMatrix for chm, or NULL if the native product doesn't support
+// the matrix and M_cholmod_sdmult should be used instead
+
+template <typename T>
+static CSCMatrix<T> *createCSCMatrix(const_CHM_SP chm) {
+   if (!chm->packed || chm->itype != CHOLMOD_INT ||
+         chm->dtype != CHOLMOD_DOUBLE ||
+         chm->xtype != (sizeof(T) == sizeof(double) ? CHOLMOD_REAL : CHOLMOD_COMPLEX) ||
+         (chm->stype != 0 && chm->nrow != chm->ncol))
+      return NULL;
+
+   const int *cp = (const int*)chm->p, *ci = (const int*)chm->i;
+   const T *cx = (const T*)chm->x;
+   PRIMME_INT m = chm->nrow, n = chm->ncol;
+   int stype = chm->stype;
+   CSCMatrix<T> *A = new CSCMatrix<T>;
+
+   // Count the nonzeros in every column of the transpose, or of the full
+   // matrix if symmetric storage; in the latter the entries in the triangular
+   // part not referenced are ignored, as CHOLMOD does
+
+   A->p.assign((stype ? n : m) + 1, 0);
+   for (PRIMME_INT j=0; j<n; j++) {
+      for (int k=cp[j]; k<cp[j+1]; k++) {
+         if (stype == 0) {
+            A->p[ci[k]+1]++;
+         } else if (ci[k] == j) {
+            A->p[j+1]++;
+         } else if (stype > 0 ? ci[k] < j : ci[k] > j) {
+            A->p[ci[k]+1]++;
+            A->p[j+1]++;
+         }
+      }
+   }
+   std::partial_sum(A->p.begin(), A->p.end(), A->p.begin());
+   A->i.resize(A->p.back());
+   A->x.resize(A->p.back());
+
+   // Copy the entries
+
+   std::vector<int> next(A->p.begin(), A->p.end()-1);
+   for (PRIMME_INT j=0; j<n; j++) {
+      for (int k=cp[j]; k<cp[j+1]; k++) {
+         int r = ci[k];
+         if (stype == 0) {
+            A->i[next[r]] = j, A->x[next[r]++] = cx[k];
+         } else if (r == j) {
+            A->i[next[j]] = r, A->x[next[j]++] = cx[k];
+         } else if (stype > 0 ? r < j : r > j) {
+            A->i[next[j]] = r, A->x[next[j]++] = cx[k];
+            A->i[next[r]] = j, A->x[next[r]++] = conjValue(cx[k]);
+         }
+      }
+   }
+
+   if (stype == 0) {
+      CSCOperand<T> N = {m, &A->p[0], &A->i[0], &A->x[0], false};
+      CSCOperand<T> C = {n, cp, ci, cx, true};
+      A->N = N, A->C = C;
+   } else {
+      // A(j,i) = conj(A(i,j)), so A*X also gathers over columns of A
+      CSCOperand<T> C = {n, &A->p[0], &A->i[0], &A->x[0], true};
+      A->N = A->C = C;
+   }
+   return A;
+}
+
+// Compute Y = op(A)*X as described above, blockSize vectors in X and Y
+
+template <typename T>
+static void cscMultiply(const CSCOperand<T> &A, const T *x, PRIMME_INT ldx,
+      T *y, PRIMME_INT ldy, int blockSize) {
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+   for (PRIMME_INT j=0; j<A.n; j++) {
+      for (int k0=0; k0<blockSize; k0+=CSC_BLOCK) {
+         int nk = std::min(CSC_BLOCK, blockSize-k0);
+         T s[CSC_BLOCK];
+         for (int k=0; k<nk; k++) s[k] = 0.0;
+         for (int p=A.p[j]; p<A.p[j+1]; p++) {
+            T a = A.conj ? conjValue(A.x[p]) : A.x[p];
+            const T *xi = &x[A.i[p] + ldx*k0];
+            for (int k=0; k<nk; k++) s[k] += a*xi[ldx*k];
+         }
+         for (int k=0; k<nk; k++) y[j + ldy*(k0+k)] = s[k];
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 // R wrappers around function in PRIMME
@@ -532,6 +663,13 @@ void matrixMatvecEigs_CHM_SP(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
    const_CHM_SP chm = (const_CHM_SP)((void**)primme->matrix)[0];
    ASSERT(chm->nrow == chm->ncol && (PRIMME_INT)chm->nrow == primme->nLocal);
 
+   CSCMatrix<T> *csc = (CSCMatrix<T>*)((void**)primme->matrix)[2];
+   if (csc) {
+      cscMultiply(csc->N, (const T*)x, *ldx, (T*)y, *ldy, *blockSize);
+      *ierr = 0;
+      return;
+   }
+
    cholmod_dense chx, chy;
    chx.nrow = primme->nLocal; 
    chx.ncol = *blockSize;
@@ -631,7 +769,7 @@ static List xprimme(Matrix<S> ortho, Matrix<S> init, SEXP A, SEXP B,
 
    // Set matvec and preconditioner
 
-   void *aux[2] = {NULL, NULL};
+   void *aux[3] = {NULL, NULL, NULL};
    cholmod_common chol_c;
    NumericMatrix *An = NULL;
    ComplexMatrix *Ac = NULL;
@@ -648,6 +786,7 @@ static List xprimme(Matrix<S> ortho, Matrix<S> init, SEXP A, SEXP B,
    } else if (Matrix_isclass_Csparse(A)) {
       aux[0] = AS_CHM_SP(A);
       aux[1] = &chol_c;
+      aux[2] = createCSCMatrix<T>((const_CHM_SP)aux[0]);
       M_R_cholmod_start(&chol_c);
       primme->matrix = aux;
       primme->matrixMatvec = matrixMatvecEigs_CHM_SP<T>;
@@ -686,6 +825,7 @@ static List xprimme(Matrix<S> ortho, Matrix<S> init, SEXP A, SEXP B,
    if (Af) delete Af;
    if (Matrix_isclass_Csparse(A)) {
       M_cholmod_finish(&chol_c);
+      if (aux[2]) delete (CSCMatrix<T>*)aux[2];
    }
    if (fprec) delete fprec;
    if (fconvTest) delete fconvTest;
@@ -1069,6 +1209,14 @@ static void matrixMatvecSvds_CHM_SP(void *x, PRIMME_INT *ldx, void *y, PRIMME_IN
    const_CHM_SP chm = (const_CHM_SP)((void**)primme_svds->matrix)[0];
    ASSERT((PRIMME_INT)chm->nrow == primme_svds->mLocal && (PRIMME_INT)chm->ncol == primme_svds->nLocal);
 
+   CSCMatrix<T> *csc = (CSCMatrix<T>*)((void**)primme_svds->matrix)[2];
+   if (csc) {
+      cscMultiply(*transpose ? csc->C : csc->N, (const T*)x, *ldx, (T*)y,
+            *ldy, *blockSize);
+      *ierr = 0;
+      return;
+   }
+
    cholmod_dense chx, chy;
    chx.nrow = (*transpose ? primme_svds->mLocal : primme_svds->nLocal);
    chx.ncol = *blockSize;
@@ -1151,7 +1299,7 @@ static List xprimme_svds(Matrix<S> orthol, Matrix<S> orthor, Matrix<S> initl,
 
    // Set matvec and preconditioner
 
-   void *aux[2] = {NULL, NULL};
+   void *aux[3] = {NULL, NULL, NULL};
    cholmod_common chol_c;
    Matrix<S> *Am = NULL;
    Function *Af = NULL;
@@ -1164,6 +1312,7 @@ static List xprimme_svds(Matrix<S> orthol, Matrix<S> orthor, Matrix<S> initl,
    } else if (Matrix_isclass_Csparse(A)) {
       aux[0] = AS_CHM_SP(A);
       aux[1] = &chol_c;
+      aux[2] = createCSCMatrix<T>((const_CHM_SP)aux[0]);
       M_R_cholmod_start(&chol_c);
       primme_svds->matrix = aux;
       primme_svds->matrixMatvec = matrixMatvecSvds_CHM_SP<T>;
@@ -1189,6 +1338,7 @@ static List xprimme_svds(Matrix<S> orthol, Matrix<S> orthor, Matrix<S> initl,
    if (Af) delete Af;
    if (Matrix_isclass_Csparse(A)) {
       M_cholmod_finish(&chol_c);
+      if (aux[2]) delete (CSCMatrix<T>*)aux[2];
    }
    if (fprec) delete fprec;
 
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2017, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ *
+ *  Example to compute the k largest eigenvalues in a 1-D Laplacian matrix
+ *  with the C++ front end in primme.hpp.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <vector>
+#include "primme.hpp"   /* header file for the C++ front end of primme */
+
+int main (int argc, char *argv[]) {
+
+   /* Solver arrays and parameters */
+   primme_params primme;
+                     /* PRIMME configuration struct */
+
+   /* Set default values in PRIMME configuration struct */
+   primme_initialize(&primme);
+
+   /* Set problem parameters */
+   primme.n = 100; /* set problem dimension */
+   primme.numEvals = 10;   /* Number of wanted eigenpairs */
+   primme.eps = 1e-9;      /* ||r|| <= eps * ||matrix|| */
+   primme.target = primme_smallest;
+                           /* Wanted the smallest eigenvalues */
+
+   /* Set method to solve the problem */
+   primme_set_method(PRIMME_DYNAMIC, &primme);
+
+   /* Display PRIMME configuration struct (optional) */
+   primme_display_params(primme);
+
+   /* Allocate space for converged Ritz values and residual norms */
+   std::vector<double> evals(primme.numEvals);
+   std::vector<double> evecs(primme.n*primme.numEvals);
+   std::vector<double> rnorms(primme.numEvals);
+
+   /* The matrix-vector product y = A*x, given for a single vector; the */
+   /* loop over the block is generated in primme::columnwise            */
+   const PRIMME_INT n = primme.n;
+   auto A = primme::columnwise([n](const double *x, double *y) {
+      for (PRIMME_INT i=0; i<n; i++) {
+         y[i] = 2.0*x[i];
+         if (i > 0) y[i] -= x[i-1];
+         if (i < n-1) y[i] -= x[i+1];
+      }
+   });
+
+   /* The preconditioner y = diag(A)^{-1}*x, given for a block of vectors */
+   auto P = [n](const double *x, PRIMME_INT ldx, double *y, PRIMME_INT ldy,
+                int blockSize) {
+      for (int j=0; j<blockSize; j++)
+         for (PRIMME_INT i=0; i<n; i++)
+            y[ldy*j+i] = x[ldx*j+i]/2.0;
+   };
+
+   /* Call primme; the scalar type selects dprimme */
+   int ret = primme::eigs(evals.data(), evecs.data(), rnorms.data(), primme,
+         A, P);
+
+   if (ret != 0) {
+      fprintf(primme.outputFile, 
+         "Error: primme returned with nonzero exit status: %d \n",ret);
+      return -1;
+   }
+
+   /* Reporting (optional) */
+   for (int i=0; i < primme.initSize; i++) {
+      fprintf(primme.outputFile, "Eval[%d]: %-22.15E rnorm: %-22.15E\n", i+1,
+         evals[i], rnorms[i]); 
+   }
+   fprintf(primme.outputFile, " %d eigenpairs converged\n", primme.initSize);
+   fprintf(primme.outputFile, "Tolerance : %-22.15E\n", 
+                                                         primme.aNorm*primme.eps);
+   fprintf(primme.outputFile, "Iterations: %-" PRIMME_INT_P "\n", 
+                                                 primme.stats.numOuterIterations); 
+   fprintf(primme.outputFile, "Restarts  : %-" PRIMME_INT_P "\n", primme.stats.numRestarts);
+   fprintf(primme.outputFile, "Matvecs   : %-" PRIMME_INT_P "\n", primme.stats.numMatvecs);
+   fprintf(primme.outputFile, "Preconds  : %-" PRIMME_INT_P "\n", primme.stats.numPreconds);
+
+   primme_free(&primme);
+
+  return(0);
+}
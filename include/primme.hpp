@@ -0,0 +1,382 @@
+/*******************************************************************************
+ * Copyright (c) 2017, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ * File: primme.hpp
+ *
+ * Purpose - Header-only C++11 front end to the PRIMME C interface. The
+ *           scalar type selects sprimme, cprimme, dprimme or zprimme at
+ *           compile time, and the operators are any callable object, such
+ *           as a lambda, instead of a function pointer plus a void* field.
+ *
+ *           A block operator is called as
+ *
+ *              A(const Scalar *x, PRIMME_INT ldx, Scalar *y, PRIMME_INT ldy,
+ *                int blockSize)
+ *
+ *           and the operators of svds take an extra int argument, which is
+ *           the transpose flag for the matrix and the mode for the
+ *           preconditioner (see matrixMatvec and applyPreconditioner in
+ *           primme_svds_params). Operators report errors by throwing; the
+ *           exception stops the solver and it is rethrown by eigs or svds.
+ *
+ *           Example:
+ *
+ *              primme_params primme;
+ *              primme_initialize(&primme);
+ *              primme.n = n; primme.numEvals = 10;
+ *              primme::eigs(evals, evecs, rnorms, primme,
+ *                 primme::columnwise([&](const double *x, double *y) {
+ *                    ... y = A*x ...
+ *                 }));
+ *
+ ******************************************************************************/
+
+#ifndef PRIMME_HPP
+#define PRIMME_HPP
+
+#include <complex>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include "primme.h"
+
+namespace primme {
+
+/******************************************************************************
+ * Scalar types supported by the C library. scalar_traits<Scalar> has the
+ * real type of Scalar and calls the PRIMME function for Scalar. There is no
+ * definition for other types, so they fail at compile time.
+ ******************************************************************************/
+
+template <typename Scalar> struct scalar_traits;
+
+template <> struct scalar_traits<float> {
+   typedef float real_type;
+   static int eigs(float *evals, float *evecs, float *resNorms,
+         primme_params *primme) {
+      return sprimme(evals, evecs, resNorms, primme);
+   }
+   static int svds(float *svals, float *svecs, float *resNorms,
+         primme_svds_params *primme_svds) {
+      return sprimme_svds(svals, svecs, resNorms, primme_svds);
+   }
+};
+
+template <> struct scalar_traits<std::complex<float> > {
+   typedef float real_type;
+   static int eigs(float *evals, std::complex<float> *evecs, float *resNorms,
+         primme_params *primme) {
+      return cprimme(evals, evecs, resNorms, primme);
+   }
+   static int svds(float *svals, std::complex<float> *svecs, float *resNorms,
+         primme_svds_params *primme_svds) {
+      return cprimme_svds(svals, svecs, resNorms, primme_svds);
+   }
+};
+
+template <> struct scalar_traits<double> {
+   typedef double real_type;
+   static int eigs(double *evals, double *evecs, double *resNorms,
+         primme_params *primme) {
+      return dprimme(evals, evecs, resNorms, primme);
+   }
+   static int svds(double *svals, double *svecs, double *resNorms,
+         primme_svds_params *primme_svds) {
+      return dprimme_svds(svals, svecs, resNorms, primme_svds);
+   }
+};
+
+template <> struct scalar_traits<std::complex<double> > {
+   typedef double real_type;
+   static int eigs(double *evals, std::complex<double> *evecs,
+         double *resNorms, primme_params *primme) {
+      return zprimme(evals, evecs, resNorms, primme);
+   }
+   static int svds(double *svals, std::complex<double> *svecs,
+         double *resNorms, primme_svds_params *primme_svds) {
+      return zprimme_svds(svals, svecs, resNorms, primme_svds);
+   }
+};
+
+/******************************************************************************
+ * Placeholder for an operator that is not given, e.g., no preconditioner
+ ******************************************************************************/
+
+struct no_operator {};
+
+/******************************************************************************
+ * Block operator that applies F(const Scalar *x, Scalar *y) to every vector;
+ * the loop is in the header, so F can be inlined into it.
+ ******************************************************************************/
+
+template <typename F>
+struct columnwise_operator {
+   mutable F f;
+
+   template <typename Scalar>
+   void operator()(const Scalar *x, PRIMME_INT ldx, Scalar *y,
+         PRIMME_INT ldy, int blockSize) const {
+      for (int i=0; i<blockSize; i++) f(&x[ldx*i], &y[ldy*i]);
+   }
+
+   template <typename Scalar>
+   void operator()(const Scalar *x, PRIMME_INT ldx, Scalar *y,
+         PRIMME_INT ldy, int blockSize, int mode) const {
+      for (int i=0; i<blockSize; i++) f(&x[ldx*i], &y[ldy*i], mode);
+   }
+};
+
+template <typename F>
+columnwise_operator<typename std::decay<F>::type> columnwise(F &&f) {
+   columnwise_operator<typename std::decay<F>::type> op = {std::forward<F>(f)};
+   return op;
+}
+
+namespace detail {
+
+/* Operators of a call to eigs or svds; the matrix field in primme_params */
+/* and primme_svds_params points to it while the solver runs              */
+
+struct context {
+   void *A, *P, *M;              /* matrix, preconditioner and mass matrix */
+   std::exception_ptr error;     /* first exception thrown by an operator  */
+};
+
+template <typename Op>
+void *to_pointer(Op &op) {
+   return const_cast<void*>(static_cast<const void*>(&op));
+}
+
+/* Call the operator, saving the exception if it throws */
+
+template <typename Op, typename... Args>
+void call(context *ctx, void *op, int *ierr, Args&&... args) {
+   try {
+      (*static_cast<Op*>(op))(std::forward<Args>(args)...);
+      *ierr = 0;
+   }
+   catch (...) {
+      if (!ctx->error) ctx->error = std::current_exception();
+      *ierr = -1;
+   }
+}
+
+/* Wrappers with the prototype of the function pointers in primme_params */
+/* and primme_svds_params for the operator in context field Field        */
+
+template <typename Scalar, typename Op, void *context::*Field>
+struct wrapper {
+   static void eigs(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+         int *blockSize, primme_params *primme, int *ierr) {
+      context *ctx = static_cast<context*>(primme->matrix);
+      call<Op>(ctx, ctx->*Field, ierr, static_cast<const Scalar*>(x), *ldx,
+            static_cast<Scalar*>(y), *ldy, *blockSize);
+   }
+
+   static void svds(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+         int *blockSize, int *mode, primme_svds_params *primme_svds,
+         int *ierr) {
+      context *ctx = static_cast<context*>(primme_svds->matrix);
+      call<Op>(ctx, ctx->*Field, ierr, static_cast<const Scalar*>(x), *ldx,
+            static_cast<Scalar*>(y), *ldy, *blockSize, *mode);
+   }
+
+   /* Set the function pointer F and the context field for operator op; */
+   /* return whether the operator is set                                 */
+
+   template <typename Fun>
+   static bool set_eigs(Fun &F, context &ctx, Op &op) {
+      F = eigs;
+      ctx.*Field = to_pointer(op);
+      return true;
+   }
+
+   template <typename Fun>
+   static bool set_svds(Fun &F, context &ctx, Op &op) {
+      F = svds;
+      ctx.*Field = to_pointer(op);
+      return true;
+   }
+};
+
+/* Missing operators leave the function pointers untouched */
+
+template <typename Scalar, void *context::*Field>
+struct wrapper<Scalar, no_operator, Field> {
+   template <typename Fun>
+   static bool set_eigs(Fun &, context &, no_operator &) { return false; }
+   template <typename Fun>
+   static bool set_svds(Fun &, context &, no_operator &) { return false; }
+};
+
+template <typename Scalar, void *context::*Field>
+struct wrapper<Scalar, const no_operator, Field> {
+   template <typename Fun>
+   static bool set_eigs(Fun &, context &, const no_operator &) {
+      return false;
+   }
+   template <typename Fun>
+   static bool set_svds(Fun &, context &, const no_operator &) {
+      return false;
+   }
+};
+
+} /* namespace detail */
+
+/******************************************************************************
+ * Subroutine eigs - Solve a standard or generalized Hermitian eigenproblem
+ * with the options in primme, calling xprimme for Scalar.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * primme  Options of the solver; matrixMatvec, applyPreconditioner,
+ *         massMatrixMatvec and matrix are replaced during the call
+ * A       Block operator computing y = A*x
+ * P       Block operator computing y = P^{-1}*x (optional)
+ * M       Block operator computing y = M*x (optional)
+ *
+ * OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------
+ * evals, evecs, resNorms  As in xprimme
+ *
+ * Return Value
+ * ------------
+ * The error code of xprimme; the first exception thrown by an operator is
+ * rethrown instead.
+ ******************************************************************************/
+
+template <typename Scalar,
+          typename Real = typename scalar_traits<Scalar>::real_type,
+          typename Op, typename Prec = no_operator, typename Mass = no_operator>
+int eigs(Real *evals, Scalar *evecs, Real *resNorms, primme_params &primme,
+      Op &&A, Prec &&P = Prec(), Mass &&M = Mass()) {
+
+   static_assert(std::is_same<Real,
+            typename scalar_traits<Scalar>::real_type>::value,
+         "Real should be the real type of Scalar");
+
+   typedef typename std::remove_reference<Op>::type OpT;
+   typedef typename std::remove_reference<Prec>::type PrecT;
+   typedef typename std::remove_reference<Mass>::type MassT;
+
+   /* Save the fields replaced during the call */
+
+   primme_params saved = primme;
+
+   detail::context ctx;
+   ctx.A = ctx.P = ctx.M = NULL;
+   primme.matrix = &ctx;
+   detail::wrapper<Scalar, OpT, &detail::context::A>::set_eigs(
+         primme.matrixMatvec, ctx, A);
+   if (detail::wrapper<Scalar, PrecT, &detail::context::P>::set_eigs(
+            primme.applyPreconditioner, ctx, P)) {
+      primme.correctionParams.precondition = 1;
+   }
+   detail::wrapper<Scalar, MassT, &detail::context::M>::set_eigs(
+         primme.massMatrixMatvec, ctx, M);
+
+   int ret = scalar_traits<Scalar>::eigs(evals, evecs, resNorms, &primme);
+
+   /* Restore the fields */
+
+   primme.matrix = saved.matrix;
+   primme.matrixMatvec = saved.matrixMatvec;
+   primme.applyPreconditioner = saved.applyPreconditioner;
+   primme.massMatrixMatvec = saved.massMatrixMatvec;
+   primme.correctionParams.precondition =
+      saved.correctionParams.precondition;
+
+   if (ctx.error) std::rethrow_exception(ctx.error);
+   return ret;
+}
+
+/******************************************************************************
+ * Subroutine svds - Compute singular triplets with the options in
+ * primme_svds, calling xprimme_svds for Scalar.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * primme_svds  Options of the solver; matrixMatvec, applyPreconditioner
+ *              and matrix are replaced during the call
+ * A            Block operator computing y = A*x if the last argument is
+ *              zero and y = A'*x otherwise
+ * P            Block operator applying the preconditioner given by the
+ *              last argument, a primme_svds_operator (optional)
+ *
+ * OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------
+ * svals, svecs, resNorms  As in xprimme_svds
+ *
+ * Return Value
+ * ------------
+ * The error code of xprimme_svds; the first exception thrown by an
+ * operator is rethrown instead.
+ ******************************************************************************/
+
+template <typename Scalar,
+          typename Real = typename scalar_traits<Scalar>::real_type,
+          typename Op, typename Prec = no_operator>
+int svds(Real *svals, Scalar *svecs, Real *resNorms,
+      primme_svds_params &primme_svds, Op &&A, Prec &&P = Prec()) {
+
+   static_assert(std::is_same<Real,
+            typename scalar_traits<Scalar>::real_type>::value,
+         "Real should be the real type of Scalar");
+
+   typedef typename std::remove_reference<Op>::type OpT;
+   typedef typename std::remove_reference<Prec>::type PrecT;
+
+   /* Save the fields replaced during the call */
+
+   primme_svds_params saved = primme_svds;
+
+   detail::context ctx;
+   ctx.A = ctx.P = ctx.M = NULL;
+   primme_svds.matrix = &ctx;
+   detail::wrapper<Scalar, OpT, &detail::context::A>::set_svds(
+         primme_svds.matrixMatvec, ctx, A);
+   detail::wrapper<Scalar, PrecT, &detail::context::P>::set_svds(
+         primme_svds.applyPreconditioner, ctx, P);
+
+   int ret = scalar_traits<Scalar>::svds(svals, svecs, resNorms,
+         &primme_svds);
+
+   /* Restore the fields */
+
+   primme_svds.matrix = saved.matrix;
+   primme_svds.matrixMatvec = saved.matrixMatvec;
+   primme_svds.applyPreconditioner = saved.applyPreconditioner;
+
+   if (ctx.error) std::rethrow_exception(ctx.error);
+   return ret;
+}
+
+} /* namespace primme */
+
+#endif /* PRIMME_HPP */
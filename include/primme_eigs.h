@@ -82,6 +82,12 @@ typedef enum {
    primme_adaptive
 } primme_convergencetest;
 
+typedef enum {         /* Storage of the QMR work vectors in the inner solver */
+   primme_storage_full, /* working precision                                   */
+   primme_storage_bf16, /* bfloat16, 8-bit significand                         */
+   primme_storage_fp16  /* IEEE half precision, 11-bit significand             */
+} primme_storage_precision;
+
 
 /* Identifies the type of event for which monitor is being called */
 typedef enum {
@@ -93,6 +99,41 @@ typedef enum {
    primme_event_locked              /* report new pair marked as locked       */
 } primme_event;
 
+/* Record written by the monitor stream for every event; see monitorStream */
+typedef struct primme_monitor_record {
+   double time;                  /* seconds since the solver started        */
+   double value;                 /* eigenvalue (singular value in svds)     */
+   double resNorm;               /* residual norm of the pair               */
+   double LSRes;                 /* QMR residual norm (inner iteration)     */
+   PRIMME_INT numMatvecs;
+   PRIMME_INT numOuterIterations;
+   int event;                    /* primme_event                            */
+   int index;                    /* position of the pair in the block, or   */
+                                 /* index of the locked pair, or the QMR    */
+                                 /* iteration (inner iteration), or the     */
+                                 /* basis size (restart)                    */
+   int numConverged;             /* pairs converged so far                  */
+   int stage;                    /* svds stage (1 or 2), 0 in eigs          */
+} primme_monitor_record;
+
+/* Bounded ring buffer of monitor records drained by a background thread */
+typedef struct primme_monitor_stream primme_monitor_stream;
+typedef void (*primme_monitor_sink)(const primme_monitor_record *records,
+      int n, void *ctx);
+
+/* Phases of the solver timed in primme_stats; a phase includes the time of */
+/* the phases called inside, e.g., ortho includes globalSum                  */
+typedef enum {
+   primme_phase_matvec,             /* matrixMatvec                           */
+   primme_phase_precond,            /* applyPreconditioner                    */
+   primme_phase_ortho,              /* orthogonalization                      */
+   primme_phase_globalSum,          /* globalSumReal                          */
+   primme_phase_solveH,             /* solve the projected problem            */
+   primme_phase_restart,            /* restart the basis                      */
+   primme_phase_locking             /* lock converged pairs                   */
+} primme_phase;
+#define PRIMME_NUM_PHASES 7
+
 typedef struct primme_stats {
    PRIMME_INT numOuterIterations;
    PRIMME_INT numRestarts;
@@ -101,16 +142,26 @@ typedef struct primme_stats {
    PRIMME_INT numGlobalSum;         /* times called globalSumReal */
    PRIMME_INT volumeGlobalSum;      /* number of SCALARs reduced by globalSumReal */
    double numOrthoInnerProds;       /* number of inner prods done by Ortho */
+   PRIMME_INT numInnerIterations;   /* number of QMR iterations in inner_solve */
+   PRIMME_INT numInnerGlobalSum;    /* times inner_solve called globalSumReal */
+   PRIMME_INT volumeRestart;        /* bytes of the bases read and written by restart (measure only) */
    double elapsedTime; 
    double timeMatvec;               /* time expend by matrixMatvec */
    double timePrecond;              /* time expend by applyPreconditioner */
    double timeOrtho;                /* time expend by ortho  */
    double timeGlobalSum;            /* time expend by globalSumReal  */
+   double timeSolveH;               /* time expend by solving the projected problem */
+   double timeRestart;              /* time expend by restarting the basis */
+   double timeLocking;              /* time expend by locking converged pairs */
    double estimateMinEVal;          /* the leftmost Ritz value seen */
    double estimateMaxEVal;          /* the rightmost Ritz value seen */
    double estimateLargestSVal;      /* absolute value of the farthest to zero Ritz value seen */
    double maxConvTol;               /* largest norm residual of a locked eigenpair */
    double estimateResidualError;    /* accumulated error in V and W */
+   int hwCounters;                  /* 1 if the next counters were measured */
+   double hwCycles[PRIMME_NUM_PHASES];       /* CPU cycles per phase */
+   double hwInstructions[PRIMME_NUM_PHASES]; /* instructions per phase */
+   double hwCacheMisses[PRIMME_NUM_PHASES];  /* last level cache misses per phase */
 } primme_stats;
 
 typedef struct JD_projectors {
@@ -124,6 +175,8 @@ typedef struct JD_projectors {
 
 typedef struct projection_params {
    primme_projection projection;
+   int pipeline;
+   int redundantSolve;
 } projection_params;
 
 typedef struct correction_params {
@@ -133,6 +186,8 @@ typedef struct correction_params {
    struct JD_projectors projectors;
    primme_convergencetest convTest;
    double relTolBase;
+   primme_storage_precision storagePrecision;
+   int pipeline;
 } correction_params;
 
 
@@ -178,6 +233,7 @@ typedef struct primme_params {
 
    /* the following will be given default values depending on the method */
    int dynamicMethodSwitch;
+   int dynamicSizes;
    int locking;
    int initSize;
    int numOrthoConst;
@@ -218,6 +274,10 @@ typedef struct primme_params {
       int *inner_its, void *LSRes, primme_event *event,
       struct primme_params *primme, int *err);
    void *monitor;
+   primme_monitor_stream *monitorStream;
+   void (*convTestBlockFun)(double *evals, void *evecs, PRIMME_INT *ldevecs,
+         double *rNorms, int *isconv, int *blockSize,
+         struct primme_params *primme, int *ierr);
 } primme_params;
 /*---------------------------------------------------------------------------*/
 
@@ -237,7 +297,8 @@ typedef enum {
    PRIMME_JDQMR_ETol,
    PRIMME_STEEPEST_DESCENT,
    PRIMME_LOBPCG_OrthoBasis,
-   PRIMME_LOBPCG_OrthoBasis_Window
+   PRIMME_LOBPCG_OrthoBasis_Window,
+   PRIMME_GD_plusK_Pipelined
 } primme_preset_method;
 
 typedef enum {
@@ -280,6 +341,8 @@ typedef enum {
    PRIMME_preconditioner =  30,
    PRIMME_initBasisMode =   301,
    PRIMME_projectionParams_projection =  302,
+   PRIMME_projectionParams_pipeline =  303,
+   PRIMME_projectionParams_redundantSolve =  304,
    PRIMME_restartingParams_scheme =  31,
    PRIMME_restartingParams_maxPrevRetain =  32,
    PRIMME_correctionParams_precondition =  33,
@@ -293,6 +356,8 @@ typedef enum {
    PRIMME_correctionParams_projectors_SkewX =  41,
    PRIMME_correctionParams_convTest =  42,
    PRIMME_correctionParams_relTolBase =  43,
+   PRIMME_correctionParams_storagePrecision =  431,
+   PRIMME_correctionParams_pipeline =  432,
    PRIMME_stats_numOuterIterations =  44,
    PRIMME_stats_numRestarts =  45,
    PRIMME_stats_numMatvecs =  46,
@@ -300,11 +365,21 @@ typedef enum {
    PRIMME_stats_numGlobalSum =  471,
    PRIMME_stats_volumeGlobalSum =  472,
    PRIMME_stats_numOrthoInnerProds =  473,
+   PRIMME_stats_numInnerIterations =  474,
+   PRIMME_stats_numInnerGlobalSum =  475,
+   PRIMME_stats_volumeRestart =  476,
    PRIMME_stats_elapsedTime =  48,
    PRIMME_stats_timeMatvec =  4801,
    PRIMME_stats_timePrecond =  4802,
    PRIMME_stats_timeOrtho =  4803,
    PRIMME_stats_timeGlobalSum =  4804,
+   PRIMME_stats_timeSolveH =  4805,
+   PRIMME_stats_timeRestart =  4806,
+   PRIMME_stats_timeLocking =  4807,
+   PRIMME_stats_hwCounters =  4808,
+   PRIMME_stats_hwCycles =  4809,
+   PRIMME_stats_hwInstructions =  4810,
+   PRIMME_stats_hwCacheMisses =  4811,
    PRIMME_stats_estimateMinEVal =  481,
    PRIMME_stats_estimateMaxEVal =  482,
    PRIMME_stats_estimateLargestSVal =  483,
@@ -315,7 +390,10 @@ typedef enum {
    PRIMME_ldevecs =  52,
    PRIMME_ldOPs =  53,
    PRIMME_monitorFun = 54,
-   PRIMME_monitor = 55
+   PRIMME_monitor = 55,
+   PRIMME_monitorStream = 56,
+   PRIMME_convTestBlockFun = 57,
+   PRIMME_dynamicSizes = 58
 } primme_params_label;
 
 int sprimme(float *evals, float *evecs, float *resNorms, 
@@ -337,6 +415,14 @@ int primme_set_member(primme_params *primme, primme_params_label label,
 int primme_member_info(primme_params_label *label, const char** label_name,
       primme_type *type, int *arity);
 int primme_constant_info(const char* label_name, int *value);
+int primme_monitor_stream_open(int capacity, primme_monitor_sink sink,
+      void *ctx, primme_monitor_stream **stream);
+int primme_monitor_stream_push(primme_monitor_stream *stream,
+      const primme_monitor_record *record);
+int primme_monitor_stream_close(primme_monitor_stream *stream,
+      PRIMME_INT *dropped);
+void primme_monitor_sink_file(const primme_monitor_record *records, int n,
+      void *ctx);
 
 #ifdef __cplusplus
 }
@@ -53,7 +53,8 @@ C-------------------------------------------------------
      : PRIMME_JDQMR_ETol,
      : PRIMME_STEEPEST_DESCENT,
      : PRIMME_LOBPCG_OrthoBasis,
-     : PRIMME_LOBPCG_OrthoBasis_Window
+     : PRIMME_LOBPCG_OrthoBasis_Window,
+     : PRIMME_GD_plusK_Pipelined
 
       parameter(
      : PRIMME_DEFAULT_METHOD = 0,
@@ -71,7 +72,8 @@ C-------------------------------------------------------
      : PRIMME_JDQMR_ETol = 12,
      : PRIMME_STEEPEST_DESCENT = 13,
      : PRIMME_LOBPCG_OrthoBasis = 14,
-     : PRIMME_LOBPCG_OrthoBasis_Window = 15
+     : PRIMME_LOBPCG_OrthoBasis_Window = 15,
+     : PRIMME_GD_plusK_Pipelined = 16
      :)
 
 C-------------------------------------------------------
@@ -112,6 +114,8 @@ C-------------------------------------------------------
      : PRIMME_preconditioner,
      : PRIMME_initBasisMode,
      : PRIMME_projectionParams_projection,
+     : PRIMME_projectionParams_pipeline,
+     : PRIMME_projectionParams_redundantSolve,
      : PRIMME_restartingParams_scheme,
      : PRIMME_restartingParams_maxPrevRetain,
      : PRIMME_correctionParams_precondition,
@@ -125,6 +129,8 @@ C-------------------------------------------------------
      : PRIMME_correctionParams_projectors_SkewX,
      : PRIMME_correctionParams_convTest,
      : PRIMME_correctionParams_relTolBase,
+     : PRIMME_correctionParams_storagePrecision,
+     : PRIMME_correctionParams_pipeline,
      : PRIMME_stats_numOuterIterations,
      : PRIMME_stats_numRestarts,
      : PRIMME_stats_numMatvecs,
@@ -132,11 +138,21 @@ C-------------------------------------------------------
      : PRIMME_stats_numGlobalSum,
      : PRIMME_stats_volumeGlobalSum,
      : PRIMME_stats_numOrthoInnerProds,
+     : PRIMME_stats_numInnerIterations,
+     : PRIMME_stats_numInnerGlobalSum,
+     : PRIMME_stats_volumeRestart,
      : PRIMME_stats_elapsedTime,
      : PRIMME_stats_timeMatvec,
      : PRIMME_stats_timePrecond,
      : PRIMME_stats_timeOrtho,
      : PRIMME_stats_timeGlobalSum,
+     : PRIMME_stats_timeSolveH,
+     : PRIMME_stats_timeRestart,
+     : PRIMME_stats_timeLocking,
+     : PRIMME_stats_hwCounters,
+     : PRIMME_stats_hwCycles,
+     : PRIMME_stats_hwInstructions,
+     : PRIMME_stats_hwCacheMisses,
      : PRIMME_stats_estimateMinEVal,
      : PRIMME_stats_estimateMaxEVal,
      : PRIMME_stats_estimateLargestSVal,
@@ -147,7 +163,10 @@ C-------------------------------------------------------
      : PRIMME_ldevecs,
      : PRIMME_ldOPs,
      : PRIMME_monitorFun,
-     : PRIMME_monitor
+     : PRIMME_monitor,
+     : PRIMME_monitorStream,
+     : PRIMME_convTestBlockFun,
+     : PRIMME_dynamicSizes
 
       parameter(
      : PRIMME_n = 0,
@@ -183,6 +202,8 @@ C-------------------------------------------------------
      : PRIMME_preconditioner = 30,
      : PRIMME_initBasisMode = 301,
      : PRIMME_projectionParams_projection = 302,
+     : PRIMME_projectionParams_pipeline = 303,
+     : PRIMME_projectionParams_redundantSolve = 304,
      : PRIMME_restartingParams_scheme = 31,
      : PRIMME_restartingParams_maxPrevRetain = 32,
      : PRIMME_correctionParams_precondition = 33,
@@ -196,6 +217,8 @@ C-------------------------------------------------------
      : PRIMME_correctionParams_projectors_SkewX = 41,
      : PRIMME_correctionParams_convTest = 42,
      : PRIMME_correctionParams_relTolBase = 43,
+     : PRIMME_correctionParams_storagePrecision =  431,
+     : PRIMME_correctionParams_pipeline =  432,
      : PRIMME_stats_numOuterIterations = 44,
      : PRIMME_stats_numRestarts = 45,
      : PRIMME_stats_numMatvecs = 46,
@@ -203,11 +226,21 @@ C-------------------------------------------------------
      : PRIMME_stats_numGlobalSum =  471,
      : PRIMME_stats_volumeGlobalSum =  472,
      : PRIMME_stats_numOrthoInnerProds =  473,
+     : PRIMME_stats_numInnerIterations =  474,
+     : PRIMME_stats_numInnerGlobalSum =  475,
+     : PRIMME_stats_volumeRestart =  476,
      : PRIMME_stats_elapsedTime = 48,
      : PRIMME_stats_timeMatvec =  4801,
      : PRIMME_stats_timePrecond =  4802,
      : PRIMME_stats_timeOrtho =  4803,
      : PRIMME_stats_timeGlobalSum =  4804,
+     : PRIMME_stats_timeSolveH =  4805,
+     : PRIMME_stats_timeRestart =  4806,
+     : PRIMME_stats_timeLocking =  4807,
+     : PRIMME_stats_hwCounters =  4808,
+     : PRIMME_stats_hwCycles =  4809,
+     : PRIMME_stats_hwInstructions =  4810,
+     : PRIMME_stats_hwCacheMisses =  4811,
      : PRIMME_stats_estimateMinEVal = 481,
      : PRIMME_stats_estimateMaxEVal = 482,
      : PRIMME_stats_estimateLargestSVal = 483,
@@ -218,7 +251,10 @@ C-------------------------------------------------------
      : PRIMME_ldevecs = 52,
      : PRIMME_ldOPs = 53,
      : PRIMME_monitorFun = 54,
-     : PRIMME_monitor = 55
+     : PRIMME_monitor = 55,
+     : PRIMME_monitorStream = 56,
+     : PRIMME_convTestBlockFun = 57,
+     : PRIMME_dynamicSizes = 58
      : )
 
 C-------------------------------------------------------
@@ -247,6 +283,9 @@ C-------------------------------------------------------
      : primme_decreasing_LTolerance,
      : primme_adaptive_ETolerance,
      : primme_adaptive,
+     : primme_storage_full,
+     : primme_storage_bf16,
+     : primme_storage_fp16,
      : primme_event_outer_iteration,
      : primme_event_inner_iteration,
      : primme_event_restart,
@@ -275,6 +314,9 @@ C-------------------------------------------------------
      : primme_decreasing_LTolerance = 1,
      : primme_adaptive_ETolerance = 2,
      : primme_adaptive = 3,
+     : primme_storage_full = 0,
+     : primme_storage_bf16 = 1,
+     : primme_storage_fp16 = 2,
      : primme_event_outer_iteration = 0,
      : primme_event_inner_iteration = 1,
      : primme_event_restart = 2,
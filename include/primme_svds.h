@@ -146,6 +146,7 @@ typedef struct primme_svds_params {
       int *inner_its, void *LSRes, primme_event *event, int *stage,
       struct primme_svds_params *primme_svds, int *err);
    void *monitor;
+   primme_monitor_stream *monitorStream;
 } primme_svds_params;
 
 typedef enum {
@@ -198,7 +199,8 @@ typedef enum {
    PRIMME_SVDS_stats_timeOrtho = 403,
    PRIMME_SVDS_stats_timeGlobalSum = 404,
    PRIMME_SVDS_monitorFun = 41,
-   PRIMME_SVDS_monitor = 42
+   PRIMME_SVDS_monitor = 42,
+   PRIMME_SVDS_monitorStream = 43
 } primme_svds_params_label;
 
 int sprimme_svds(float *svals, float *svecs, float *resNorms,
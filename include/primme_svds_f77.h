@@ -105,7 +105,8 @@ C-------------------------------------------------------
      : PRIMME_SVDS_stats_timeOrtho,
      : PRIMME_SVDS_stats_timeGlobalSum,
      : PRIMME_SVDS_monitorFun,
-     : PRIMME_SVDS_monitor
+     : PRIMME_SVDS_monitor,
+     : PRIMME_SVDS_monitorStream
 
       parameter(
      : PRIMME_SVDS_primme = 0,
@@ -157,7 +158,8 @@ C-------------------------------------------------------
      : PRIMME_SVDS_stats_timeOrtho = 403,
      : PRIMME_SVDS_stats_timeGlobalSum = 404,
      : PRIMME_SVDS_monitorFun = 41,
-     : PRIMME_SVDS_monitor = 42
+     : PRIMME_SVDS_monitor = 42,
+     : PRIMME_SVDS_monitorStream = 43
      :)
 
 C-------------------------------------------------------
@@ -244,12 +244,12 @@ int applyPreconditioner_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       SCALAR *W, PRIMME_INT ldW, int blockSize, primme_params *primme) {
 
    int i, ONE=1, ierr=0;
-   double t0;
+   double t0[1+PRIMME_PERF_NUM];
 
    if (blockSize <= 0) return 0;
    assert(primme->nLocal == nLocal);
 
-   t0 = primme_wTimer(0);
+   phaseBegin_Sprimme(t0, primme);
 
    if (primme->correctionParams.precondition) {
       if (primme->ldOPs == 0
@@ -271,11 +271,58 @@ int applyPreconditioner_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       Num_copy_matrix_Sprimme(V, nLocal, blockSize, ldV, W, ldW);
    }
 
-   primme->stats.timePrecond += primme_wTimer(0) - t0;
+   phaseEnd_Sprimme(t0, primme_phase_precond, primme);
 
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutines phaseBegin and phaseEnd - accumulate the wall clock time and, if
+ *    stats.hwCounters, the hardware counters spent between both calls in the
+ *    statistics of the given phase.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * mark        array of size 1+PRIMME_PERF_NUM set by phaseBegin
+ * phase       phase to accumulate on (phaseEnd only)
+ * primme      parameters structure; nothing is done if NULL
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+void phaseBegin_Sprimme(double *mark, primme_params *primme) {
+
+   mark[0] = primme_wTimer(0);
+   mark[1] = -1.0;
+   if (primme && primme->stats.hwCounters) primme_perf_read(&mark[1]);
+}
+
+TEMPLATE_PLEASE
+void phaseEnd_Sprimme(double *mark, primme_phase phase,
+      primme_params *primme) {
+
+   double t, c[PRIMME_PERF_NUM];
+
+   if (!primme) return;
+
+   t = primme_wTimer(0) - mark[0];
+   switch(phase) {
+   case primme_phase_matvec:     primme->stats.timeMatvec += t; break;
+   case primme_phase_precond:    primme->stats.timePrecond += t; break;
+   case primme_phase_ortho:      primme->stats.timeOrtho += t; break;
+   case primme_phase_globalSum:  primme->stats.timeGlobalSum += t; break;
+   case primme_phase_solveH:     primme->stats.timeSolveH += t; break;
+   case primme_phase_restart:    primme->stats.timeRestart += t; break;
+   case primme_phase_locking:    primme->stats.timeLocking += t; break;
+   }
+
+   if (primme->stats.hwCounters && mark[1] >= 0.0 && primme_perf_read(c)) {
+      primme->stats.hwCycles[phase] += c[0] - mark[1];
+      primme->stats.hwInstructions[phase] += c[1] - mark[2];
+      primme->stats.hwCacheMisses[phase] += c[2] - mark[3];
+   }
+}
+
 /*******************************************************************************
  * Subroutine convTestFun - wrapper around primme.convTestFun; evaluate if the
  *    the approximate eigenpair eval, evec with given residual norm is
@@ -296,11 +343,62 @@ TEMPLATE_PLEASE
 int convTestFun_Sprimme(REAL eval, SCALAR *evec, REAL rNorm, int *isconv, 
       struct primme_params *primme) {
 
-   int ierr=0;
+   int ierr=0, one=1;
    double evald = eval, rNormd = rNorm;
+   PRIMME_INT ldevec = primme->nLocal;
+
+   /* Use convTestBlockFun on a single pair if no scalar test is given */
+
+   if (!primme->convTestFun) {
+      CHKERRM((primme->convTestBlockFun(&evald, evec, &ldevec, &rNormd,
+                  isconv, &one, primme, &ierr), ierr), -1,
+            "Error returned by 'convTestBlockFun' %d", ierr);
+      return 0;
+   }
 
    CHKERRM((primme->convTestFun(&evald, evec, &rNormd, isconv, primme, &ierr),
             ierr), -1, "Error returned by 'convTestFun' %d", ierr);
 
    return 0;
 }
+
+/*******************************************************************************
+ * Subroutine convTestBlockFun - wrapper around primme.convTestBlockFun;
+ *    evaluate in a single call if the approximate eigenpairs evals, evecs
+ *    with given residual norms are considered as converged.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * evals     the eigenvalues
+ * evecs     the eigenvectors (may be NULL)
+ * ldevecs   the leading dimension of evecs
+ * rNorms    the residual vector norms
+ * blockSize the number of pairs
+ * rwork     workspace of at least 2*blockSize+1 doubles
+ * 
+ * OUTPUT
+ * ------
+ * isconv   if isconv[i] is non-zero, the ith pair is considered converged.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int convTestBlockFun_Sprimme(REAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
+      REAL *rNorms, int *isconv, int blockSize, SCALAR *rwork,
+      size_t rworkSize, struct primme_params *primme) {
+
+   int i, ierr=0;
+   double *evalsd = ALIGN(rwork, double);
+   double *rNormsd = evalsd + blockSize;
+
+   assert(rworkSize*sizeof(SCALAR) >= (2*(size_t)blockSize+1)*sizeof(double));
+   for (i=0; i<blockSize; i++) {
+      evalsd[i] = evals[i];
+      rNormsd[i] = rNorms[i];
+   }
+
+   CHKERRM((primme->convTestBlockFun(evalsd, evecs, &ldevecs, rNormsd, isconv,
+               &blockSize, primme, &ierr), ierr), -1,
+         "Error returned by 'convTestBlockFun' %d", ierr);
+
+   return 0;
+}
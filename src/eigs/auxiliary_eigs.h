@@ -64,6 +64,21 @@ int Num_update_VWXR_dprimme(double *V, double *W, PRIMME_INT mV, int nV,
 #endif
 int applyPreconditioner_dprimme(double *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       double *W, PRIMME_INT ldW, int blockSize, primme_params *primme);
+#if !defined(CHECK_TEMPLATE) && !defined(phaseBegin_Sprimme)
+#  define phaseBegin_Sprimme CONCAT(phaseBegin_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(phaseBegin_Rprimme)
+#  define phaseBegin_Rprimme CONCAT(phaseBegin_,REAL_SUF)
+#endif
+void phaseBegin_dprimme(double *mark, primme_params *primme);
+#if !defined(CHECK_TEMPLATE) && !defined(phaseEnd_Sprimme)
+#  define phaseEnd_Sprimme CONCAT(phaseEnd_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(phaseEnd_Rprimme)
+#  define phaseEnd_Rprimme CONCAT(phaseEnd_,REAL_SUF)
+#endif
+void phaseEnd_dprimme(double *mark, primme_phase phase,
+      primme_params *primme);
 #if !defined(CHECK_TEMPLATE) && !defined(convTestFun_Sprimme)
 #  define convTestFun_Sprimme CONCAT(convTestFun_,SCALAR_SUF)
 #endif
@@ -72,6 +87,15 @@ int applyPreconditioner_dprimme(double *V, PRIMME_INT nLocal, PRIMME_INT ldV,
 #endif
 int convTestFun_dprimme(double eval, double *evec, double rNorm, int *isconv,
       struct primme_params *primme);
+#if !defined(CHECK_TEMPLATE) && !defined(convTestBlockFun_Sprimme)
+#  define convTestBlockFun_Sprimme CONCAT(convTestBlockFun_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestBlockFun_Rprimme)
+#  define convTestBlockFun_Rprimme CONCAT(convTestBlockFun_,REAL_SUF)
+#endif
+int convTestBlockFun_dprimme(double *evals, double *evecs, PRIMME_INT ldevecs,
+      double *rNorms, int *isconv, int blockSize, double *rwork,
+      size_t rworkSize, struct primme_params *primme);
 void Num_compute_residual_zprimme(PRIMME_INT n, PRIMME_COMPLEX_DOUBLE eval, PRIMME_COMPLEX_DOUBLE *x,
    PRIMME_COMPLEX_DOUBLE *Ax, PRIMME_COMPLEX_DOUBLE *r);
 int Num_update_VWXR_zprimme(PRIMME_COMPLEX_DOUBLE *V, PRIMME_COMPLEX_DOUBLE *W, PRIMME_INT mV, int nV,
@@ -85,8 +109,14 @@ int Num_update_VWXR_zprimme(PRIMME_COMPLEX_DOUBLE *V, PRIMME_COMPLEX_DOUBLE *W,
       PRIMME_COMPLEX_DOUBLE *rwork, size_t lrwork, primme_params *primme);
 int applyPreconditioner_zprimme(PRIMME_COMPLEX_DOUBLE *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       PRIMME_COMPLEX_DOUBLE *W, PRIMME_INT ldW, int blockSize, primme_params *primme);
+void phaseBegin_zprimme(double *mark, primme_params *primme);
+void phaseEnd_zprimme(double *mark, primme_phase phase,
+      primme_params *primme);
 int convTestFun_zprimme(double eval, PRIMME_COMPLEX_DOUBLE *evec, double rNorm, int *isconv,
       struct primme_params *primme);
+int convTestBlockFun_zprimme(double *evals, PRIMME_COMPLEX_DOUBLE *evecs, PRIMME_INT ldevecs,
+      double *rNorms, int *isconv, int blockSize, PRIMME_COMPLEX_DOUBLE *rwork,
+      size_t rworkSize, struct primme_params *primme);
 void Num_compute_residual_sprimme(PRIMME_INT n, float eval, float *x,
    float *Ax, float *r);
 int Num_update_VWXR_sprimme(float *V, float *W, PRIMME_INT mV, int nV,
@@ -100,8 +130,14 @@ int Num_update_VWXR_sprimme(float *V, float *W, PRIMME_INT mV, int nV,
       float *rwork, size_t lrwork, primme_params *primme);
 int applyPreconditioner_sprimme(float *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       float *W, PRIMME_INT ldW, int blockSize, primme_params *primme);
+void phaseBegin_sprimme(double *mark, primme_params *primme);
+void phaseEnd_sprimme(double *mark, primme_phase phase,
+      primme_params *primme);
 int convTestFun_sprimme(float eval, float *evec, float rNorm, int *isconv,
       struct primme_params *primme);
+int convTestBlockFun_sprimme(float *evals, float *evecs, PRIMME_INT ldevecs,
+      float *rNorms, int *isconv, int blockSize, float *rwork,
+      size_t rworkSize, struct primme_params *primme);
 void Num_compute_residual_cprimme(PRIMME_INT n, PRIMME_COMPLEX_FLOAT eval, PRIMME_COMPLEX_FLOAT *x,
    PRIMME_COMPLEX_FLOAT *Ax, PRIMME_COMPLEX_FLOAT *r);
 int Num_update_VWXR_cprimme(PRIMME_COMPLEX_FLOAT *V, PRIMME_COMPLEX_FLOAT *W, PRIMME_INT mV, int nV,
@@ -115,6 +151,12 @@ int Num_update_VWXR_cprimme(PRIMME_COMPLEX_FLOAT *V, PRIMME_COMPLEX_FLOAT *W, PR
       PRIMME_COMPLEX_FLOAT *rwork, size_t lrwork, primme_params *primme);
 int applyPreconditioner_cprimme(PRIMME_COMPLEX_FLOAT *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       PRIMME_COMPLEX_FLOAT *W, PRIMME_INT ldW, int blockSize, primme_params *primme);
+void phaseBegin_cprimme(double *mark, primme_params *primme);
+void phaseEnd_cprimme(double *mark, primme_phase phase,
+      primme_params *primme);
 int convTestFun_cprimme(float eval, PRIMME_COMPLEX_FLOAT *evec, float rNorm, int *isconv,
       struct primme_params *primme);
+int convTestBlockFun_cprimme(float *evals, PRIMME_COMPLEX_FLOAT *evecs, PRIMME_INT ldevecs,
+      float *rNorms, int *isconv, int blockSize, PRIMME_COMPLEX_FLOAT *rwork,
+      size_t rworkSize, struct primme_params *primme);
 #endif
@@ -91,6 +91,7 @@ int check_convergence_Sprimme(SCALAR *X, PRIMME_INT nLocal, PRIMME_INT ldX,
    double tol;             /* Residual tolerance                                 */
    double attainableTol=0; /* Used in locking to check near convergence problem  */
    int isConv;             /* return of convTestFun                              */
+   int *isConvBlock;       /* return of convTestBlockFun for pairs from left     */
    double targetShift;     /* target shift */
 
    /* -------------------------- */
@@ -101,11 +102,18 @@ int check_convergence_Sprimme(SCALAR *X, PRIMME_INT nLocal, PRIMME_INT ldX,
       CHKERR(check_practical_convergence(NULL, 0, 0, NULL, numLocked, 0, left,
             NULL, right-left, NULL, NULL, 0, NULL, rworkSize, primme), -1);
       *iwork = max(*iwork, right-left); /* for toProject */
+      if (primme->convTestBlockFun) {
+         /* for isConvBlock, and evals and norms in double for the user */
+         *iwork = max(*iwork, 2*(right-left));
+         *rworkSize = max(*rworkSize, ((2*(size_t)(right-left)+1)
+                  *sizeof(double) + sizeof(SCALAR) - 1)/sizeof(SCALAR));
+      }
       return 0;
    }
  
-   /* Check enough space for toProject */
-   assert(iworkSize >= right-left);
+   /* Check enough space for toProject and isConvBlock */
+   assert(iworkSize >= (primme->convTestBlockFun?2:1)*(right-left));
+   isConvBlock = toProject + (right-left);
 
    targetShift = primme->numTargetShifts > 0 ?
       primme->targetShifts[min(primme->initSize, primme->numTargetShifts-1)] : 0.0;
@@ -124,15 +132,28 @@ int check_convergence_Sprimme(SCALAR *X, PRIMME_INT nLocal, PRIMME_INT ldX,
       attainableTol = sqrt((double)(primme->numOrthoConst+numLocked))*tol;
    }
 
+   /* Don't trust any residual norm below estimateResidualError */
+
+   for (i=left; i < right; i++) {
+      blockNorms[i-left] = max(blockNorms[i-left], primme->stats.estimateResidualError);
+   }
+
+   /* ------------------------------------------------------------------ */
+   /* If the user provides convTestBlockFun, test all pairs in one call, */
+   /* so that any communication in the test is done once per block.      */
+   /* ------------------------------------------------------------------ */
+
+   if (primme->convTestBlockFun && right > left) {
+      CHKERR(convTestBlockFun_Sprimme(&hVals[left], X, ldX, blockNorms,
+               isConvBlock, right-left, rwork, *rworkSize, primme), -1);
+   }
+
    /* ----------------------------------------------------------------- */
    /* Determine which Ritz vectors have converged < tol and flag them.  */
    /* ----------------------------------------------------------------- */
 
    numToProject = 0;
    for (i=left; i < right; i++) {
-       
-      /* Don't trust any residual norm below estimateResidualError */
-      blockNorms[i-left] = max(blockNorms[i-left], primme->stats.estimateResidualError);
 
       /* Refine doesn't order the pairs considering closest_leq/gep. */
       /* Then ignore values so that value +-residual is completely   */
@@ -146,8 +167,13 @@ int check_convergence_Sprimme(SCALAR *X, PRIMME_INT nLocal, PRIMME_INT ldX,
          continue;
       }
 
-      CHKERR(convTestFun_Sprimme(hVals[i], X?&X[ldX*(i-left)]:NULL,
-               blockNorms[i-left], &isConv, primme), -1);
+      if (primme->convTestBlockFun) {
+         isConv = isConvBlock[i-left];
+      }
+      else {
+         CHKERR(convTestFun_Sprimme(hVals[i], X?&X[ldX*(i-left)]:NULL,
+                  blockNorms[i-left], &isConv, primme), -1);
+      }
 
       if (isConv) {
          flags[i] = CONVERGED;
@@ -108,8 +108,9 @@ static int setup_JD_projectors(SCALAR *x, SCALAR *evecs, PRIMME_INT ldevecs,
  *                        *----------------------------------------------------*
  *                        | The following are optional and mutually exclusive: |
  *                        *------------------------------+                     |
- *                + 4*primme->nLocal + primme->nLocal    | For QMR work and sol|
+ *                + inner_solve query + primme->nLocal   | For QMR work and sol|
  *                + primme->nLocal*primme->maxBlockSize  | OLSEN for Kinvx     |
+ *                + 4*primme->maxBlockSize               | and x'*Kinvx        |
  *                                                       *---------------------*
  *
  * rworkSize      the size of rwork. If less than needed, func returns needed.
@@ -171,11 +172,13 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
 
    SCALAR *r, *x, *sol;  /* Residual, Ritz vector, and correction.         */
    SCALAR *linSolverRWork;/* Workspace needed by linear solver.            */
+   SCALAR *spare;         /* Free column of W for the linear solver.        */
    REAL *sortedRitzVals; /* Sorted array of current and converged Ritz     */
                            /* values.  Size of array is numLocked+basisSize. */
    double *blockOfShifts;  /* Shifts for (A-shiftI) or (if needed) (K-shiftI)*/
    REAL *approxOlsenEps; /* Shifts for approximate Olsen implementation    */
    SCALAR *Kinvx;         /* Workspace to store K^{-1}x                     */
+   SCALAR *xKinvxBlock=NULL; /* x_i'*K^{-1}x_i for all block vectors (JDQMR)*/
    SCALAR *Lprojector;   /* Q pointer for (I-Q*Q'). Usually points to evecs*/
    SCALAR *RprojectorQ;  /* May point to evecs/evecsHat depending on skewQ */
    SCALAR *RprojectorX;  /* May point to x/Kinvx depending on skewX        */
@@ -199,36 +202,42 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
    if (primme->correctionParams.projectors.RightX &&  
        primme->correctionParams.projectors.SkewX ) { 
 
-      /* OLSEN's method requires a block, but JDQMR is vector by vector */
+      /* Both OLSEN's method and the JDQMR skew projector work on the block */
       if (primme->correctionParams.maxInnerIterations == 0) {    
-         sol = Kinvx + primme->ldOPs*blockSize;
-         neededRsize = neededRsize + primme->ldOPs*blockSize;
+         sol = Kinvx + primme->ldOPs*blockSize + 4*blockSize;
+         neededRsize = neededRsize + primme->ldOPs*blockSize + 4*blockSize;
       }
       else {
-         sol = Kinvx + primme->nLocal;
-         neededRsize = neededRsize + primme->nLocal;
+         xKinvxBlock = Kinvx + primme->nLocal*blockSize;
+         sol = xKinvxBlock + 2*blockSize;
+         neededRsize = neededRsize + primme->nLocal*blockSize + 2*blockSize;
       }
    }
    else {
       sol = Kinvx + 0;
    }
    if (primme->correctionParams.maxInnerIterations == 0) {    
-      linSolverRWork = sol + 0;                   /* sol not needed for GD */
+      sortedRitzVals = (REAL *)(sol + 0);         /* sol not needed for GD */
       linSolverRWorkSize = 0;                     /* No inner solver used  */
    }
    else {
-      linSolverRWork = sol + primme->nLocal;      /* sol needed in innerJD */
+      sortedRitzVals = (REAL *)(sol + primme->nLocal); /* sol needed in innerJD */
       neededRsize = neededRsize + primme->nLocal;
-      linSolverRWorkSize =                        /* Inner solver worksize */
-              4*primme->nLocal + 2*(primme->numOrthoConst+primme->numEvals);
+      linSolverRWorkSize = 0;                     /* Inner solver worksize */
+      CHKERR(inner_solve_Sprimme(NULL, NULL, NULL, NULL, 0, NULL, NULL, NULL,
+               NULL, 0, NULL, 0, NULL, 0, 0, 0, 0, NULL, 0.0, 0.0, NULL, 0.0,
+               NULL, NULL, &linSolverRWorkSize, primme), -1);
       neededRsize = neededRsize + linSolverRWorkSize;
    }
-   sortedRitzVals = (REAL *)(linSolverRWork + linSolverRWorkSize);
    blockOfShifts  = ALIGN(sortedRitzVals + (numLocked+basisSize), double);
    approxOlsenEps = ALIGN(blockOfShifts  + blockSize, REAL);
    neededRsize = neededRsize + numLocked+basisSize
       + blockSize*(1+sizeof(double)/sizeof(REAL)) + 2;
 
+   /* The inner solver gets the rest, so it can use more than it needs */
+   linSolverRWork = ALIGN(approxOlsenEps + blockSize, SCALAR);
+   neededRsize = neededRsize + 2;
+
    /* Return memory requirements */
    if (V == NULL) {
       *rworkSize = max(*rworkSize, neededRsize);
@@ -236,6 +245,9 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
       return 0;
    }
    assert(neededRsize <= *rworkSize);
+   if (primme->correctionParams.maxInnerIterations != 0) {
+      linSolverRWorkSize = *rworkSize - (size_t)(linSolverRWork - rwork);
+   }
 
    /* Subdivide also the integer work space */
    ilev = iwork;       /* of size blockSize */
@@ -393,7 +405,8 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
            /* Compute exact Olsen's projected preconditioner. This is */
           /* expensive and rarely improves anything! Included for completeness*/
           
-          Olsen_preconditioner_block(r, ldW, x, ldV, blockSize, Kinvx, primme);
+          CHKERR(Olsen_preconditioner_block(r, ldW, x, ldV, blockSize, Kinvx,
+                   primme), -1);
       }
       else {
          if ( primme->correctionParams.projectors.RightX ) {   
@@ -418,6 +431,26 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
    /* ------------------------------------------------------------ */
    else {  /* maxInnerIterations > 0  We perform inner-outer JDQMR */
       int touch0 = *touch;
+      int skewX = primme->correctionParams.precondition
+         && primme->correctionParams.projectors.RightX
+         && primme->correctionParams.projectors.SkewX;
+
+      /* If the right projector with x is skewed, compute K^{-1}x_i and    */
+      /* x_i'*K^{-1}x_i for all block vectors at once, with a single call  */
+      /* to the preconditioner and a single reduction. Each vector uses    */
+      /* its own column of Kinvx and its own shift in the preconditioner.  */
+
+      if (skewX) {
+         x = &V[ldV*basisSize];
+         CHKERR(applyPreconditioner_Sprimme(x, primme->nLocal, ldV, Kinvx,
+                  primme->nLocal, blockSize, primme), -1);
+         for (blockIndex = 0; blockIndex < blockSize; blockIndex++) {
+            xKinvxBlock[blockSize+blockIndex] = Num_dot_Sprimme(primme->nLocal,
+                  &x[ldV*blockIndex], 1, &Kinvx[primme->nLocal*blockIndex], 1);
+         }
+         CHKERR(globalSum_Sprimme(&xKinvxBlock[blockSize], xKinvxBlock,
+                  blockSize, primme), -1);
+      }
 
       /* Solve the correction for each block vector. */
 
@@ -430,8 +463,10 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
          /* The pointers Lprojector, Rprojector(Q/X) point to the   */
          /* appropriate arrays for use in the projection step       */
 
+         if (skewX) xKinvx = xKinvxBlock[blockIndex];
          CHKERR(setup_JD_projectors(x, evecs, ldevecs, evecsHat, ldevecsHat,
-                  Kinvx, &xKinvx, &Lprojector, &ldLprojector, &RprojectorQ,
+                  skewX ? &Kinvx[primme->nLocal*blockIndex] : NULL, &xKinvx,
+                  &Lprojector, &ldLprojector, &RprojectorQ,
                   &ldRprojectorQ, &RprojectorX, &ldRprojectorX, &sizeLprojector,
                   &sizeRprojectorQ, &sizeRprojectorX, numLocked,
                   numConvergedStored, primme), -1);
@@ -448,12 +483,25 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
          /* value that takes for all inner_solve calls                        */
          int touch1 = touch0;
 
+         /* The residual of the previous block vector and the columns after */
+         /* the block in W are not used until W is updated with the new V   */
+
+         if (blockIndex > 0) {
+            spare = &W[ldW*(basisSize+blockIndex-1)];
+         }
+         else if (basisSize+blockSize < primme->maxBasisSize) {
+            spare = &W[ldW*(basisSize+blockSize)];
+         }
+         else {
+            spare = NULL;
+         }
+
          CHKERR(inner_solve_Sprimme(x, r, &blockNorms[blockIndex], evecs,
                   ldevecs, UDU, ipivot, &xKinvx,
                   Lprojector, ldLprojector, RprojectorQ, ldRprojectorQ,
                   RprojectorX, ldRprojectorX, sizeLprojector, sizeRprojectorQ,
                   sizeRprojectorX, sol, ritzVals[ritzIndex], shift, &touch1,
-                  machEps, linSolverRWork, linSolverRWorkSize,
+                  machEps, spare, linSolverRWork, &linSolverRWorkSize,
                   primme), -1);
          *touch = max(*touch, touch1);
 
@@ -770,6 +818,8 @@ static int Olsen_preconditioner_block(SCALAR *r, PRIMME_INT ldr, SCALAR *x,
  *   x                The Ritz vector
  *   evecs            Converged locked eigenvectors (denoted as Q herein)
  *   evecsHat         K^{-1}*evecs
+ *   Kinvx            K^{-1}x, computed by the caller if the skew projector
+ *                    with x is used
  *   numLocked        Number of locked eigenvectors (if locking)
  *   numConverged     Number of converged e-vectors copied in evecs (no locking)
  *   primme           The main data structures that contains the choices for
@@ -781,9 +831,13 @@ static int Olsen_preconditioner_block(SCALAR *r, PRIMME_INT ldr, SCALAR *x,
  *       primme->SkewQ  : evecs in the right one, should be skewed
  *       primme->SkewX  : x in the right one, should be skewed
  *                   
+ *  INPUT/OUTPUT
+ *  ------------
+ *  *xKinvx           On input, x'*K^{-1}x if the skew projector with x is
+ *                    used; otherwise it is set to 1 on output
+ *
  *  OUTPUT
  *  ------
- *  *Kinvx            The result of K^{-1}x (if needed, otherwise NULL)
  * **Lprojector       Pointer to the left projector for [Q x] (could be NULL)
  * **RprojectorQ      Pointer to the right projector for Q (could be NULL)
  * **RprojectorX      Pointer to the right projector for X (could be NULL)
@@ -845,7 +899,6 @@ static int setup_JD_projectors(SCALAR *x, SCALAR *evecs, PRIMME_INT ldevecs,
       primme_params *primme) {
 
    int n, sizeEvecs;
-   SCALAR xKinvx_local;
 
    *sizeLprojector  = 0;
    *sizeRprojectorQ = 0;
@@ -919,12 +972,9 @@ static int setup_JD_projectors(SCALAR *x, SCALAR *evecs, PRIMME_INT ldevecs,
    
       if (primme->correctionParams.precondition   &&
           primme->correctionParams.projectors.SkewX) {
-         CHKERR(applyPreconditioner_Sprimme(x, primme->nLocal, primme->nLocal,
-                  Kinvx, primme->nLocal, 1, primme), -1);
-         primme->stats.numPreconds += 1;
+         /* K^{-1}x and x'*K^{-1}x are computed for the whole block */
+         /* by solve_correction                                     */
          *RprojectorX  = Kinvx;
-         xKinvx_local = Num_dot_Sprimme(primme->nLocal, x, 1, Kinvx, 1);
-         CHKERR(globalSum_Sprimme(&xKinvx_local, xKinvx, 1, primme), -1);
       }      
       else {
          *RprojectorX = x;
@@ -35,6 +35,7 @@
 
 #include "numerical.h"
 #include "globalsum.h"
+#include "auxiliary_eigs.h"
 #include "wtime.h"
 
 TEMPLATE_PLEASE
@@ -42,10 +43,10 @@ int globalSum_Sprimme(SCALAR *sendBuf, SCALAR *recvBuf, int count,
       primme_params *primme) {
 
    int ierr;
-   double t0=0.0;
+   double t0[1+PRIMME_PERF_NUM];
 
    if (primme && primme->globalSumReal) {
-      t0 = primme_wTimer(0);
+      phaseBegin_Sprimme(t0, primme);
 
       /* If it is a complex type, count real and imaginary part */
 #ifdef USE_COMPLEX
@@ -55,7 +56,8 @@ int globalSum_Sprimme(SCALAR *sendBuf, SCALAR *recvBuf, int count,
                ierr), -1,
             "Error returned by 'globalSumReal' %d", ierr);
 
-      primme->stats.timeGlobalSum += primme_wTimer(0) - t0;
+      phaseEnd_Sprimme(t0, primme_phase_globalSum, primme);
+      primme->stats.numGlobalSum++;
       primme->stats.volumeGlobalSum += count;
    }
    else {
@@ -63,12 +63,30 @@ static int apply_projected_matrix(SCALAR *v, REAL shift, SCALAR *Q,
 static int apply_projector(SCALAR *Q, PRIMME_INT ldQ, int numCols, SCALAR *v, 
    SCALAR *rwork, primme_params *primme);
 
+static int apply_projected_matrix_dots(SCALAR *v, REAL shift, SCALAR *Q,
+      PRIMME_INT ldQ, int dimQ, SCALAR *g, SCALAR *sol, SCALAR *delta,
+      SCALAR *result, REAL *dots, SCALAR *rwork, primme_params *primme);
+
+static int apply_projected_preconditioner_dot(SCALAR *v, SCALAR *Q,
+      PRIMME_INT ldQ, SCALAR *RprojectorQ, PRIMME_INT ldRprojectorQ, SCALAR *x,
+      SCALAR *RprojectorX,  PRIMME_INT ldRprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, SCALAR *xKinvx, SCALAR *UDU, int *ipivot,
+      SCALAR *result, REAL *rho, SCALAR *rwork, primme_params *primme);
+
 static int dist_dot(SCALAR *x, int incx,
    SCALAR *y, int incy, primme_params *primme, SCALAR *result);
 
 static int dist_dot_real(SCALAR *x, int incx,
    SCALAR *y, int incy, primme_params *primme, REAL *result);
 
+static void update_packed_delta(primme_storage_precision storage, PRIMME_INT n,
+      REAL gamma, REAL eta, REAL *d, void *delta, REAL *sol);
+
+static void unpack_delta(primme_storage_precision storage, PRIMME_INT n,
+      void *delta, SCALAR *full);
+
+static size_t packed_delta_size(PRIMME_INT n);
+
 
 /*******************************************************************************
  * Function inner_solve - This subroutine solves the correction equation
@@ -124,10 +142,18 @@ static int dist_dot_real(SCALAR *x, int incx,
  *
  * machEps     machine precision
  *
+ * spare       Vector of size nLocal not used by the caller, or NULL. With a
+ *             16-bit storagePrecision, delta is moved there in working
+ *             precision if the guards ask for it and rwork has no room
+ *
  * rwork       Real workspace of size 
- *             4*primme->nLocal + 2*(primme->numOrthoConst+primme->numEvals)
+ *             4*primme->nLocal + 2*(primme->numOrthoConst+primme->numEvals),
+ *             plus 5*(primme->numOrthoConst+primme->numEvals)+30 if
+ *             correctionParams.pipeline. With a 16-bit storagePrecision,
+ *             2*primme->nLocal and the packed delta instead of 4*nLocal
  *
- * rworkSize   Size of the rwork array
+ * rworkSize   Size of the rwork array. If r is NULL, it returns the
+ *             size of rwork needed
  *
  * primme      Structure containing various solver parameters
  *
@@ -135,7 +161,7 @@ static int dist_dot_real(SCALAR *x, int incx,
  * Input/Output parameters
  * -----------------------
  * r       The residual with respect to the Ritz vector.  May be altered upon
- *         return.
+ *         return; with a 16-bit storagePrecision it holds the QMR residual g.
  * rnorm   On input, the 2 norm of r. No need to recompute it initially.
  *         On output, the estimated 2 norm of the updated eigenvalue residual
  * touch   Parameter used in inner solve stopping criteria
@@ -157,8 +183,8 @@ int inner_solve_Sprimme(SCALAR *x, SCALAR *r, REAL *rnorm, SCALAR *evecs,
       SCALAR *Lprojector, PRIMME_INT ldLprojector, SCALAR *RprojectorQ,
       PRIMME_INT ldRprojectorQ, SCALAR *RprojectorX, PRIMME_INT ldRprojectorX,
       int sizeLprojector, int sizeRprojectorQ, int sizeRprojectorX, SCALAR *sol,
-      REAL eval, REAL shift, int *touch, double machEps, SCALAR *rwork,
-      size_t rworkSize, primme_params *primme) {
+      REAL eval, REAL shift, int *touch, double machEps, SCALAR *spare,
+      SCALAR *rwork, size_t *rworkSize, primme_params *primme) {
 
    int i;             /* loop variable                                       */
    int numIts;        /* Number of inner iterations                          */
@@ -184,17 +210,88 @@ int inner_solve_Sprimme(SCALAR *x, SCALAR *r, REAL *rnorm, SCALAR *evecs,
    int isConv;
    double aNorm;
 
+   /* Pipelined QMR, see correctionParams.pipeline */
+   int pipeline;        /* if nonzero, fuse the inner products of each step */
+   int solDots;         /* if the products with sol are in dots */
+   int noRightOps;      /* if the projected preconditioner is the identity */
+   REAL dots[11];       /* inner products from apply_projected_matrix_dots */
+   REAL gg;             /* g'g */
+   PRIMME_INT numGlobalSum0 = primme->stats.numGlobalSum;
+
+   /* Storage of delta, see correctionParams.storagePrecision */
+   primme_storage_precision storage;
+   PRIMME_INT nReals;   /* number of real values in a vector */
+   REAL storageEps;     /* unit roundoff of the storage format */
+   size_t workSpaceSize;/* size of workSpace */
+   SCALAR *fullDelta;   /* where to unpack delta, or NULL if no room */
+   int stopPacked=0;    /* if the rounding of delta stops the iterations */
+
+   /* --------------------------------------------------------*/
+   /* Set up the storage of delta                             */
+   /* --------------------------------------------------------*/
+
+   /* delta is only read and written in the recurrence that updates sol, so */
+   /* it can be kept in 16 bits (see update_packed_delta). d and w are      */
+   /* passed to the matrix-vector product and the preconditioner, so they   */
+   /* are kept in working precision.                                        */
+
+   nReals = primme->nLocal*(PRIMME_INT)(sizeof(SCALAR)/sizeof(REAL));
+   storage = primme->correctionParams.storagePrecision;
+   if (storage == primme_storage_bf16) {
+      storageEps = ldexp(1.0, -8);
+   }
+   else if (storage == primme_storage_fp16) {
+      storageEps = ldexp(1.0, -11);
+   }
+   else {
+      storage = primme_storage_full;
+      storageEps = 0.0;
+   }
+   if (packed_delta_size(nReals) >= (size_t)primme->nLocal) {
+      storage = primme_storage_full;  /* nothing to save for short vectors */
+   }
+
+   pipeline = primme->correctionParams.pipeline;
+   workSpaceSize = 2*(primme->numOrthoConst+primme->numEvals)
+      + (pipeline ? 5*(primme->numOrthoConst+primme->numEvals)+30 : 0);
+
+   /* Return memory requirement */
+   if (r == NULL) {
+      *rworkSize = max(*rworkSize, workSpaceSize + (
+               storage == primme_storage_full ? (size_t)primme->nLocal*4 :
+               (size_t)primme->nLocal*2 + packed_delta_size(nReals)));
+      return 0;
+   }
+
    /* -------------------------------------------*/
    /* Subdivide the workspace into needed arrays */
    /* -------------------------------------------*/
 
-   g      = rwork;
-   d      = g + primme->nLocal;
-   delta  = d + primme->nLocal;
-   w      = delta + primme->nLocal;
-   workSpace = w + primme->nLocal; /* This needs at least 2*numOrth+NumEvals) */
-   assert(rworkSize >= (size_t)primme->nLocal*4
-                       + 2*(primme->numOrthoConst+primme->numEvals));
+   if (storage == primme_storage_full) {
+      g      = rwork;
+      d      = g + primme->nLocal;
+      delta  = d + primme->nLocal;
+      w      = delta + primme->nLocal;
+      workSpace = w + primme->nLocal;
+      fullDelta = NULL;
+      assert(*rworkSize >= (size_t)primme->nLocal*4 + workSpaceSize);
+   }
+   else {
+      /* r is not needed after g = r, so g takes its place. delta goes last */
+      /* to be unpacked in place if there is room for the full vector, or   */
+      /* else in spare.                                                     */
+      g      = r;
+      d      = rwork;
+      w      = d + primme->nLocal;
+      workSpace = w + primme->nLocal;
+      delta  = workSpace + workSpaceSize;
+      fullDelta = *rworkSize >= (size_t)primme->nLocal*3 + workSpaceSize ?
+         delta : spare;
+      assert(*rworkSize >= (size_t)primme->nLocal*2 + workSpaceSize
+            + packed_delta_size(nReals));
+   }
+   noRightOps = !primme->correctionParams.precondition && sizeRprojectorQ == 0
+      && sizeRprojectorX == 0;
 
    /* -----------------------------------------*/
    /* Set up convergence criteria by Tolerance */
@@ -264,24 +361,40 @@ int inner_solve_Sprimme(SCALAR *x, SCALAR *r, REAL *rnorm, SCALAR *evecs,
    /* --------------------------------------------------------*/
 
    /* Assume zero initial guess */
-   Num_copy_Sprimme(primme->nLocal, r, 1, g, 1);
+   if (g != r) Num_copy_Sprimme(primme->nLocal, r, 1, g, 1);
 
-   CHKERR(apply_projected_preconditioner(g, evecs, ldevecs, RprojectorQ,
-           ldRprojectorQ, x, RprojectorX, ldRprojectorX, sizeRprojectorQ,
-           sizeRprojectorX, xKinvx, UDU, ipivot, d, workSpace, primme), -1);
+   if (pipeline) {
+      CHKERR(apply_projected_preconditioner_dot(g, evecs, ldevecs,
+               RprojectorQ, ldRprojectorQ, x, RprojectorX, ldRprojectorX,
+               sizeRprojectorQ, sizeRprojectorX, xKinvx, UDU, ipivot, d,
+               &rho_prev, workSpace, primme), -1);
+   }
+   else {
+      CHKERR(apply_projected_preconditioner(g, evecs, ldevecs, RprojectorQ,
+              ldRprojectorQ, x, RprojectorX, ldRprojectorX, sizeRprojectorQ,
+              sizeRprojectorX, xKinvx, UDU, ipivot, d, workSpace, primme), -1);
+      CHKERR(dist_dot_real(g, 1, d, 1, primme, &rho_prev), -1);
+   }
 
    Theta_prev = 0.0L;
    eval_prev = eval;
-   CHKERR(dist_dot_real(g, 1, d, 1, primme, &rho_prev), -1);
 
    /* Initialize recurrences used to dynamically update the eigenpair */
 
    Beta_prev = Delta_prev = Psi_prev = 0.0L;
    Gamma_prev = Phi_prev = 0.0L;
 
-   /* other initializations */
+   /* other initializations; zero is also a valid packed delta */
+   if (storage == primme_storage_full) {
+      for (i = 0; i < primme->nLocal; i++) {
+         delta[i] = 0.0;
+      }
+   }
+   else {
+      Num_zero_matrix_Sprimme(delta, packed_delta_size(nReals), 1,
+            packed_delta_size(nReals));
+   }
    for (i = 0; i < primme->nLocal; i++) {
-      delta[i] = 0.0;
       sol[i] = 0.0;
    }
 
@@ -293,9 +406,22 @@ int inner_solve_Sprimme(SCALAR *x, SCALAR *r, REAL *rnorm, SCALAR *evecs,
 
    while (numIts < maxIterations) {
 
-      CHKERR(apply_projected_matrix(d, shift, Lprojector, ldLprojector,
-               sizeLprojector, w, workSpace, primme), -1);
-      CHKERR(dist_dot_real(d, 1, w, 1, primme, &sigma_prev), -1);
+      if (pipeline) {
+         /* Get the products with sol for the adaptive stopping criteria */
+         /* only when delta is stored in working precision                */
+         solDots = (ETolerance > 0.0 || ETolerance_factor > 0.0)
+            && storage == primme_storage_full;
+         CHKERR(apply_projected_matrix_dots(d, shift, Lprojector,
+                  ldLprojector, sizeLprojector, g, solDots ? sol : NULL,
+                  delta, w, dots, workSpace, primme), -1);
+         sigma_prev = dots[0];
+      }
+      else {
+         solDots = 0;
+         CHKERR(apply_projected_matrix(d, shift, Lprojector, ldLprojector,
+                  sizeLprojector, w, workSpace, primme), -1);
+         CHKERR(dist_dot_real(d, 1, w, 1, primme, &sigma_prev), -1);
+      }
 
       if (sigma_prev == 0.0L) {
          if (primme->printLevel >= 5 && primme->procID == 0) {
@@ -322,7 +448,19 @@ int inner_solve_Sprimme(SCALAR *x, SCALAR *r, REAL *rnorm, SCALAR *evecs,
 
       Num_axpy_Sprimme(primme->nLocal, -alpha_prev, w, 1, g, 1);
 
-      CHKERR(dist_dot_real(g, 1, g, 1, primme, &Theta), -1);
+      if (pipeline) {
+         /* g'g = g_prev'g_prev - 2*alpha*g_prev'w + alpha^2*w'w. Compute it */
+         /* again if the expansion lost most of its digits.                 */
+         gg = dots[3] - 2.0L*alpha_prev*dots[1]
+            + alpha_prev*alpha_prev*dots[2];
+         if (gg <= 1e-2*(dots[3] + alpha_prev*alpha_prev*dots[4])) {
+            CHKERR(dist_dot_real(g, 1, g, 1, primme, &gg), -1);
+         }
+         Theta = gg;
+      }
+      else {
+         CHKERR(dist_dot_real(g, 1, g, 1, primme, &Theta), -1);
+      }
       Theta = sqrt(Theta);
       Theta = Theta/tau_prev;
       c = 1.0L/sqrt(1+Theta*Theta);
@@ -330,12 +468,46 @@ int inner_solve_Sprimme(SCALAR *x, SCALAR *r, REAL *rnorm, SCALAR *evecs,
 
       gamma = c*c*Theta_prev*Theta_prev;
       eta = alpha_prev*c*c;
-      for (i = 0; i < primme->nLocal; i++) {
-          delta[i] = gamma*delta[i] + eta*d[i];
-          sol[i] = delta[i]+sol[i];
+      if (storage == primme_storage_full) {
+         for (i = 0; i < primme->nLocal; i++) {
+             delta[i] = gamma*delta[i] + eta*d[i];
+             sol[i] = delta[i]+sol[i];
+         }
+      }
+      else {
+         update_packed_delta(storage, nReals, gamma, eta, (REAL*)d, delta,
+               (REAL*)sol);
+
+         /* The rounding of delta limits the relative accuracy of sol to  */
+         /* about storageEps. Go back to working precision before QMR     */
+         /* asks for more than that, or stop if there is no room for it.  */
+
+         if (tau <= 4.0*storageEps*tau_init) {
+            if (fullDelta) {
+               if (primme->printLevel >= 5 && primme->procID == 0) {
+                  fprintf(primme->outputFile,
+                        "Storing delta in working precision; tau %e\n", tau);
+               }
+               unpack_delta(storage, nReals, delta, fullDelta);
+               delta = fullDelta;
+               storage = primme_storage_full;
+            }
+            else {
+               stopPacked = 1;
+            }
+         }
       }
       numIts++;
 
+      if (stopPacked) {
+         if (primme->printLevel >= 5 && primme->procID == 0) {
+            fprintf(primme->outputFile,
+                  "Exiting because tau %e reached the storage precision\n",
+                  tau);
+         }
+         break;
+      }
+
       if (fabs(rho_prev) == 0.0L ) {
          if (primme->printLevel >= 5 && primme->procID == 0) {
             fprintf(primme->outputFile,"Exiting because abs(rho) %e\n",
@@ -367,7 +539,20 @@ int inner_solve_Sprimme(SCALAR *x, SCALAR *r, REAL *rnorm, SCALAR *evecs,
          /* Perform the update: update the eigenvalue and the square of the  */
          /* residual norm.                                                   */
          
-         CHKERR(dist_dot_real(sol, 1, sol, 1, primme, &dot_sol), -1);
+         if (solDots) {
+            /* sol'sol = (sol_prev + delta)'(sol_prev + delta), where     */
+            /* delta = gamma*delta_prev + eta*d                           */
+            REAL sol_delta = gamma*dots[6] + eta*dots[7];
+            REAL delta_delta = gamma*gamma*dots[8] + 2.0L*gamma*eta*dots[9]
+               + eta*eta*dots[10];
+            dot_sol = dots[5] + 2.0L*sol_delta + delta_delta;
+            if (dot_sol <= 1e-2*(dots[5] + delta_delta)) {
+               CHKERR(dist_dot_real(sol, 1, sol, 1, primme, &dot_sol), -1);
+            }
+         }
+         else {
+            CHKERR(dist_dot_real(sol, 1, sol, 1, primme, &dot_sol), -1);
+         }
          eval_updated = shift + (eval - shift + 2*Beta + Gamma)/(1 + dot_sol);
          eres2_updated = (tau*tau)/(1 + dot_sol) + 
             ((eval - shift + Beta)*(eval - shift + Beta))/(1 + dot_sol) - 
@@ -381,6 +566,32 @@ int inner_solve_Sprimme(SCALAR *x, SCALAR *r, REAL *rnorm, SCALAR *evecs,
          else 
             eres_updated = sqrt(eres2_updated);
 
+         /* If the estimate stalls above the error of the residual norms   */
+         /* (stats.estimateResidualError) while delta is packed, the       */
+         /* rounding of delta may be the cause; continue in working        */
+         /* precision, or stop if there is no room for it                  */
+
+         if (storage != primme_storage_full && numIts > 1
+               && eres_updated >= eres_prev
+               && eres_updated > primme->stats.estimateResidualError) {
+            if (!fullDelta) {
+               if (primme->printLevel >= 5 && primme->procID == 0) {
+                  fprintf(primme->outputFile,
+                        "Exiting because eres %e stalled with packed delta\n",
+                        eres_updated);
+               }
+               break;
+            }
+            if (primme->printLevel >= 5 && primme->procID == 0) {
+               fprintf(primme->outputFile,
+                     "Storing delta in working precision; eres %e\n",
+                     eres_updated);
+            }
+            unpack_delta(storage, nReals, delta, fullDelta);
+            delta = fullDelta;
+            storage = primme_storage_full;
+         }
+
          /* --------------------------------------------------------*/
          /* Stopping criteria                                       */
          /* --------------------------------------------------------*/
@@ -487,11 +698,23 @@ int inner_solve_Sprimme(SCALAR *x, SCALAR *r, REAL *rnorm, SCALAR *evecs,
 
       if (numIts < maxIterations) {
 
-         CHKERR(apply_projected_preconditioner(g, evecs, ldevecs, RprojectorQ, 
-            ldRprojectorQ, x, RprojectorX, ldRprojectorX, sizeRprojectorQ,
-            sizeRprojectorX, xKinvx, UDU, ipivot, w, workSpace, primme), -1);
-
-         CHKERR(dist_dot_real(g, 1, w, 1, primme, &rho), -1);
+         if (pipeline && noRightOps) {
+            Num_copy_Sprimme(primme->nLocal, g, 1, w, 1);
+            rho = gg;
+         }
+         else if (pipeline) {
+            CHKERR(apply_projected_preconditioner_dot(g, evecs, ldevecs,
+                     RprojectorQ, ldRprojectorQ, x, RprojectorX,
+                     ldRprojectorX, sizeRprojectorQ, sizeRprojectorX, xKinvx,
+                     UDU, ipivot, w, &rho, workSpace, primme), -1);
+         }
+         else {
+            CHKERR(apply_projected_preconditioner(g, evecs, ldevecs,
+                     RprojectorQ, ldRprojectorQ, x, RprojectorX,
+                     ldRprojectorX, sizeRprojectorQ, sizeRprojectorX, xKinvx,
+                     UDU, ipivot, w, workSpace, primme), -1);
+            CHKERR(dist_dot_real(g, 1, w, 1, primme, &rho), -1);
+         }
          beta = rho/rho_prev;
          Num_axpy_Sprimme(primme->nLocal, beta, d, 1, w, 1);
          /* Alternate between w and d buffers in successive iterations
@@ -513,6 +736,10 @@ int inner_solve_Sprimme(SCALAR *x, SCALAR *r, REAL *rnorm, SCALAR *evecs,
    } /* End of QMR main while loop                              */
      /* --------------------------------------------------------*/
 
+   primme->stats.numInnerIterations += numIts;
+   primme->stats.numInnerGlobalSum +=
+      primme->stats.numGlobalSum - numGlobalSum0;
+
    *rnorm = eres_updated;
    return 0;
 }
@@ -754,6 +981,209 @@ static int apply_projector(SCALAR *Q, PRIMME_INT ldQ, int numCols, SCALAR *v,
 }
 
 
+/*******************************************************************************
+ * Function apply_projected_matrix_dots - Applies the projected matrix as
+ *    apply_projected_matrix does, and returns the inner products needed in a
+ *    pipelined QMR iteration. The overlaps of the projector and the inner
+ *    products are computed in a single global reduction.
+ *
+ *    With u = (A-shift*I)v and c = Q'u, the result is w = u - Q*c, and
+ *
+ *       v'w = v'u - (v'Q)*c,   g'w = g'u - (g'Q)*c,   w'w = u'u - c'*c.
+ *
+ * Input Parameters
+ * ----------------
+ * v, shift, Q, ldQ, dimQ  As in apply_projected_matrix
+ *
+ * g       The QMR residual
+ *
+ * sol     The current solution. If NULL, the products with sol and delta
+ *         are not computed
+ *
+ * delta   The last update of sol
+ *
+ * rwork   Workspace of size 2*(3*dimQ+10)
+ *
+ * primme  Structure containing various solver parameters
+ *
+ * Output Parameters
+ * -----------------
+ * result  The result of the application
+ *
+ * dots    The real part of v'w, g'w, w'w, g'g, u'u; and if sol is given,
+ *         of sol'sol, sol'delta, sol'v, delta'delta, delta'v, v'v
+ *
+ ******************************************************************************/
+
+static int apply_projected_matrix_dots(SCALAR *v, REAL shift, SCALAR *Q,
+      PRIMME_INT ldQ, int dimQ, SCALAR *g, SCALAR *sol, SCALAR *delta,
+      SCALAR *result, REAL *dots, SCALAR *rwork, primme_params *primme) {
+
+   int i;
+   PRIMME_INT n = primme->nLocal;
+   int count = 3*dimQ + (sol ? 10 : 4); /* number of values reduced */
+   SCALAR *local = rwork;               /* local products */
+   SCALAR *c = rwork + count;           /* Q'u, Q'v, Q'g and the products */
+   SCALAR *s = c + 3*dimQ;              /* global inner products */
+   SCALAR vQc, gQc;
+   REAL cc;
+
+   CHKERR(matrixMatvec_Sprimme(v, n, n, result, n, 0, 1, primme), -1);
+   Num_axpy_Sprimme(n, -shift, v, 1, result, 1);
+
+   if (dimQ > 0) {
+      Num_gemv_Sprimme("C", n, dimQ, 1.0, Q, ldQ, result, 1, 0.0, local, 1);
+      Num_gemv_Sprimme("C", n, dimQ, 1.0, Q, ldQ, v, 1, 0.0, &local[dimQ],
+            1);
+      Num_gemv_Sprimme("C", n, dimQ, 1.0, Q, ldQ, g, 1, 0.0, &local[2*dimQ],
+            1);
+   }
+   i = 3*dimQ;
+   local[i++] = Num_dot_Sprimme(n, v, 1, result, 1);
+   local[i++] = Num_dot_Sprimme(n, g, 1, result, 1);
+   local[i++] = Num_dot_Sprimme(n, result, 1, result, 1);
+   local[i++] = Num_dot_Sprimme(n, g, 1, g, 1);
+   if (sol) {
+      local[i++] = Num_dot_Sprimme(n, sol, 1, sol, 1);
+      local[i++] = Num_dot_Sprimme(n, sol, 1, delta, 1);
+      local[i++] = Num_dot_Sprimme(n, sol, 1, v, 1);
+      local[i++] = Num_dot_Sprimme(n, delta, 1, delta, 1);
+      local[i++] = Num_dot_Sprimme(n, delta, 1, v, 1);
+      local[i++] = Num_dot_Sprimme(n, v, 1, v, 1);
+   }
+   CHKERR(globalSum_Sprimme(local, c, count, primme), -1);
+
+   /* result = u - Q*c */
+
+   if (dimQ > 0) {
+      Num_gemv_Sprimme("N", n, dimQ, -1.0, Q, ldQ, c, 1, 1.0, result, 1);
+   }
+   vQc = Num_dot_Sprimme(dimQ, &c[dimQ], 1, c, 1);
+   gQc = Num_dot_Sprimme(dimQ, &c[2*dimQ], 1, c, 1);
+   cc = REAL_PART(Num_dot_Sprimme(dimQ, c, 1, c, 1));
+
+   dots[0] = REAL_PART(s[0] - vQc);
+   dots[1] = REAL_PART(s[1] - gQc);
+   dots[2] = max(0.0, REAL_PART(s[2]) - cc);
+   dots[3] = REAL_PART(s[3]);
+   dots[4] = REAL_PART(s[2]);
+   for (i=4; i<count-3*dimQ; i++) {
+      dots[i+1] = REAL_PART(s[i]);
+   }
+
+   /* If v'w lost most of its digits in the subtraction, compute it again */
+
+   if (fabs(dots[0]) <= 1e-2*(ABS(s[0]) + ABS(vQc))) {
+      CHKERR(dist_dot_real(v, 1, result, 1, primme, &dots[0]), -1);
+   }
+
+   return 0;
+}
+
+
+/*******************************************************************************
+ * Function apply_projected_preconditioner_dot - Applies the projected
+ *    preconditioner as apply_projected_preconditioner does, and also returns
+ *    rho = v'*result. The overlaps of both skew projectors and rho are
+ *    computed in a single global reduction.
+ *
+ *    With y = K^{-1}v, z = (Q'Qhat)^{-1}Q'y and t = x'(y - Qhat*z)/xKinvx,
+ *
+ *       result = y - Qhat*z - Kinvx*t,
+ *       rho    = v'y - (v'Qhat)*z - (v'Kinvx)*t.
+ *
+ * Input Parameters
+ * ----------------
+ * The same as apply_projected_preconditioner, with rwork of size
+ * 7*sizeRprojectorQ+6
+ *
+ * Output Parameters
+ * -----------------
+ * result  The result of the application
+ *
+ * rho     The real part of v'*result
+ *
+ ******************************************************************************/
+
+static int apply_projected_preconditioner_dot(SCALAR *v, SCALAR *Q,
+      PRIMME_INT ldQ, SCALAR *RprojectorQ, PRIMME_INT ldRprojectorQ, SCALAR *x,
+      SCALAR *RprojectorX,  PRIMME_INT ldRprojectorX, int sizeRprojectorQ,
+      int sizeRprojectorX, SCALAR *xKinvx, SCALAR *UDU, int *ipivot,
+      SCALAR *result, REAL *rho, SCALAR *rwork, primme_params *primme) {
+
+   PRIMME_INT n = primme->nLocal;
+   int nQ = sizeRprojectorQ, nX = sizeRprojectorX;
+   int count = 2*nQ + nX*(nQ+2) + 1;  /* number of values reduced */
+   SCALAR *local = rwork;             /* local products */
+   SCALAR *Qy = rwork + count;        /* Q'y, Qhat'v, Qhat'x, x'y, Kinvx'v */
+   SCALAR *Qhatv = Qy + nQ;
+   SCALAR *Qhatx = Qhatv + nQ;
+   SCALAR *xy = Qhatx + nX*nQ;
+   SCALAR *Kinvxv = xy + nX;
+   SCALAR *vy = Kinvxv + nX;          /* v'y */
+   SCALAR *z = vy + 1;                /* (Q'Qhat)^{-1}Q'y */
+   SCALAR vQhatz = 0.0, t = 0.0;
+   REAL scale;
+
+   /* Place K^{-1}v in result */
+   CHKERR(applyPreconditioner_Sprimme(v, n, n, result, n, 1, primme), -1);
+
+   if (nQ > 0) {
+      Num_gemv_Sprimme("C", n, nQ, 1.0, Q, ldQ, result, 1, 0.0, local, 1);
+      Num_gemv_Sprimme("C", n, nQ, 1.0, RprojectorQ, ldRprojectorQ, v, 1,
+            0.0, &local[nQ], 1);
+   }
+   if (nX > 0) {
+      if (nQ > 0) {
+         Num_gemv_Sprimme("C", n, nQ, 1.0, RprojectorQ, ldRprojectorQ, x, 1,
+               0.0, &local[2*nQ], 1);
+      }
+      local[3*nQ] = Num_dot_Sprimme(n, x, 1, result, 1);
+      local[3*nQ+1] = Num_dot_Sprimme(n, RprojectorX, 1, v, 1);
+   }
+   local[count-1] = Num_dot_Sprimme(n, v, 1, result, 1);
+   CHKERR(globalSum_Sprimme(local, Qy, count, primme), -1);
+
+   /* result = y - Qhat*z */
+
+   if (nQ > 0) {
+      if (UDU != NULL) {
+         CHKERRM(nQ == 1 && ABS(UDU[0]) == 0.0, -1,
+               "Failure factorizing UDU.");
+         CHKERR(UDUSolve_Sprimme(UDU, ipivot, nQ, Qy, z, primme), -1);
+      }
+      else {
+         Num_copy_Sprimme(nQ, Qy, 1, z, 1);
+      }
+      Num_gemv_Sprimme("N", n, nQ, -1.0, RprojectorQ, ldRprojectorQ, z, 1,
+            1.0, result, 1);
+      vQhatz = Num_dot_Sprimme(nQ, Qhatv, 1, z, 1);
+   }
+
+   /* result = result - Kinvx*t */
+
+   if (nX > 0) {
+      t = *xy - Num_dot_Sprimme(nQ, Qhatx, 1, z, 1);
+      if (xKinvx != NULL) {
+         CHKERRM(ABS(xKinvx[0]) == 0.0, -1, "Failure factorizing UDU.");
+         t = t/xKinvx[0];
+      }
+      Num_axpy_Sprimme(n, -t, RprojectorX, 1, result, 1);
+   }
+
+   *rho = REAL_PART(*vy - vQhatz - CONJ(*Kinvxv)*t);
+
+   /* If rho lost most of its digits in the subtraction, compute it again */
+
+   scale = ABS(*vy) + ABS(vQhatz) + ABS(CONJ(*Kinvxv)*t);
+   if (fabs(*rho) <= 1e-2*scale) {
+      CHKERR(dist_dot_real(v, 1, result, 1, primme, rho), -1);
+   }
+
+   return 0;
+}
+
+
 /*******************************************************************************
  * Function dist_dot - Computes dot products in parallel.
  *
@@ -817,3 +1247,194 @@ static int dist_dot_real(SCALAR *x, int incx,
 
    return 0;
 }
+
+
+/*******************************************************************************
+ * Functions to convert between float and the 16-bit formats, rounding to the
+ * nearest value (ties to even). bfloat16 keeps the exponent range of float;
+ * values beyond the range of IEEE half precision become infinity.
+ ******************************************************************************/
+
+static uint16_t float_to_bf16(float x) {
+   union {float f; uint32_t u;} v;
+
+   v.f = x;
+   if ((v.u & 0x7fffffffu) > 0x7f800000u) {
+      return (uint16_t)((v.u >> 16) | 0x40u);    /* quiet NaN */
+   }
+   return (uint16_t)((v.u + 0x7fffu + ((v.u >> 16) & 1u)) >> 16);
+}
+
+static float bf16_to_float(uint16_t h) {
+   union {float f; uint32_t u;} v;
+
+   v.u = (uint32_t)h << 16;
+   return v.f;
+}
+
+static uint16_t float_to_fp16(float x) {
+   union {float f; uint32_t u;} v, t;
+   uint32_t sign, a;
+
+   v.f = x;
+   sign = (v.u >> 16) & 0x8000u;
+   a = v.u & 0x7fffffffu;
+   if (a > 0x7f800000u) {                        /* NaN */
+      return (uint16_t)(sign | 0x7e00u);
+   }
+   if (a >= 0x477ff000u) {                       /* |x| >= 65520 or inf */
+      return (uint16_t)(sign | 0x7c00u);
+   }
+   if (a < 0x38800000u) {                        /* |x| < 2^-14 */
+      /* The spacing of floats in [0.5,1) is 2^-24, the smallest half */
+      t.u = a;
+      t.f += 0.5f;
+      return (uint16_t)(sign | (t.u - 0x3f000000u));
+   }
+   a += ((uint32_t)(15 - 127) << 23) + 0xfffu + ((a >> 13) & 1u);
+   return (uint16_t)(sign | (a >> 13));
+}
+
+static float fp16_to_float(uint16_t h) {
+   union {float f; uint32_t u;} v;
+   uint32_t sign = (uint32_t)(h & 0x8000u) << 16;
+   uint32_t e = (h >> 10) & 0x1fu, m = h & 0x3ffu;
+
+   if (e == 0x1fu) {
+      v.u = sign | 0x7f800000u | (m << 13);
+   }
+   else if (e == 0) {
+      v.f = (float)m*5.9604644775390625e-8f;    /* m*2^-24 */
+      v.u |= sign;
+   }
+   else {
+      v.u = sign | ((e + 112) << 23) | (m << 13);
+   }
+   return v.f;
+}
+
+/* Number of values that share a scale in a packed vector */
+#define PACKED_BLOCK 64
+
+/*******************************************************************************
+ * Function update_packed_delta - Computes delta = gamma*delta + eta*d and
+ *    sol = sol + delta, where delta is stored in a 16-bit format.
+ *
+ *    The packed delta is a sequence of blocks, each one made of a REAL scale
+ *    followed by PACKED_BLOCK 16-bit values. The scale is the power of two
+ *    above the largest value in the block, so the packed values are in
+ *    [-1, 1] and tiny corrections do not underflow in IEEE half precision.
+ *    The packed vector takes packed_delta_size(n) SCALARs.
+ *
+ * Input Parameters
+ * ----------------
+ * storage     Format of delta, primme_storage_bf16 or primme_storage_fp16
+ *
+ * n           Number of real values in delta, d and sol
+ *
+ * gamma, eta  Coefficients of the recurrence
+ *
+ * d           Real view of the QMR search direction
+ *
+ * Input/Output Parameters
+ * -----------------------
+ * delta       The packed vector
+ *
+ * sol         Real view of the solution
+ *
+ ******************************************************************************/
+
+static void update_packed_delta(primme_storage_precision storage, PRIMME_INT n,
+      REAL gamma, REAL eta, REAL *d, void *delta, REAL *sol) {
+
+   PRIMME_INT i0;
+   char *block;
+   REAL buf[PACKED_BLOCK];
+
+   for (i0=0, block=(char*)delta; i0 < n; i0 += PACKED_BLOCK,
+         block += sizeof(REAL) + sizeof(uint16_t)*PACKED_BLOCK) {
+      int j, m = (int)min(PACKED_BLOCK, n-i0), e;
+      REAL *scale = (REAL*)block;
+      uint16_t *h = (uint16_t*)(block + sizeof(REAL));
+      REAL maxAbs = 0.0;
+
+      for (j=0; j < m; j++) {
+         REAL old = storage == primme_storage_fp16 ?
+            fp16_to_float(h[j]) : bf16_to_float(h[j]);
+         buf[j] = gamma*(*scale)*old + eta*d[i0+j];
+         sol[i0+j] += buf[j];
+         maxAbs = max(maxAbs, fabs(buf[j]));
+      }
+
+      if (maxAbs > 0.0) {
+         frexp(maxAbs, &e);
+         *scale = ldexp(1.0, e);
+      }
+      else {
+         *scale = 1.0;
+      }
+
+      for (j=0; j < m; j++) {
+         float x = (float)(buf[j]/(*scale));
+         h[j] = storage == primme_storage_fp16 ?
+            float_to_fp16(x) : float_to_bf16(x);
+      }
+   }
+}
+
+/*******************************************************************************
+ * Function unpack_delta - Converts a packed delta into a vector of n REAL
+ *    values, which may start at the same address as delta.
+ *
+ *    The blocks are converted from the last one, so that the full values of a
+ *    block never overwrite a block not yet converted.
+ *
+ * Input Parameters
+ * ----------------
+ * storage     Format of delta, primme_storage_bf16 or primme_storage_fp16
+ *
+ * n           Number of real values in delta
+ *
+ * delta       The packed vector
+ *
+ * Output Parameters
+ * -----------------
+ * full        The full vector
+ *
+ ******************************************************************************/
+
+static void unpack_delta(primme_storage_precision storage, PRIMME_INT n,
+      void *delta, SCALAR *full) {
+
+   PRIMME_INT b, nb = (n + PACKED_BLOCK - 1)/PACKED_BLOCK;
+   REAL buf[PACKED_BLOCK];
+
+   for (b=nb-1; b >= 0; b--) {
+      char *block = (char*)delta
+         + b*(PRIMME_INT)(sizeof(REAL) + sizeof(uint16_t)*PACKED_BLOCK);
+      REAL scale = *(REAL*)block;
+      uint16_t *h = (uint16_t*)(block + sizeof(REAL));
+      int j, m = (int)min(PACKED_BLOCK, n - b*PACKED_BLOCK);
+
+      for (j=0; j < m; j++) {
+         buf[j] = scale*(storage == primme_storage_fp16 ?
+               fp16_to_float(h[j]) : bf16_to_float(h[j]));
+      }
+      for (j=0; j < m; j++) {
+         ((REAL*)full)[b*PACKED_BLOCK+j] = buf[j];
+      }
+   }
+}
+
+/*******************************************************************************
+ * Function packed_delta_size - Returns the number of SCALARs taken by a
+ *    packed delta of n real values (see update_packed_delta). It is about
+ *    a fourth of the full vector in double precision and a half in single.
+ ******************************************************************************/
+
+static size_t packed_delta_size(PRIMME_INT n) {
+   size_t nb = (size_t)(n + PACKED_BLOCK - 1)/PACKED_BLOCK;
+   size_t bytes = nb*(sizeof(REAL) + sizeof(uint16_t)*PACKED_BLOCK);
+
+   return (bytes + sizeof(SCALAR) - 1)/sizeof(SCALAR);
+}
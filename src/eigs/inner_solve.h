@@ -44,27 +44,27 @@ int inner_solve_dprimme(double *x, double *r, double *rnorm, double *evecs,
       double *Lprojector, PRIMME_INT ldLprojector, double *RprojectorQ,
       PRIMME_INT ldRprojectorQ, double *RprojectorX, PRIMME_INT ldRprojectorX,
       int sizeLprojector, int sizeRprojectorQ, int sizeRprojectorX, double *sol,
-      double eval, double shift, int *touch, double machEps, double *rwork,
-      size_t rworkSize, primme_params *primme);
+      double eval, double shift, int *touch, double machEps, double *spare,
+      double *rwork, size_t *rworkSize, primme_params *primme);
 int inner_solve_zprimme(PRIMME_COMPLEX_DOUBLE *x, PRIMME_COMPLEX_DOUBLE *r, double *rnorm, PRIMME_COMPLEX_DOUBLE *evecs,
       PRIMME_INT ldevecs, PRIMME_COMPLEX_DOUBLE *UDU, int *ipivot, PRIMME_COMPLEX_DOUBLE *xKinvx,
       PRIMME_COMPLEX_DOUBLE *Lprojector, PRIMME_INT ldLprojector, PRIMME_COMPLEX_DOUBLE *RprojectorQ,
       PRIMME_INT ldRprojectorQ, PRIMME_COMPLEX_DOUBLE *RprojectorX, PRIMME_INT ldRprojectorX,
       int sizeLprojector, int sizeRprojectorQ, int sizeRprojectorX, PRIMME_COMPLEX_DOUBLE *sol,
-      double eval, double shift, int *touch, double machEps, PRIMME_COMPLEX_DOUBLE *rwork,
-      size_t rworkSize, primme_params *primme);
+      double eval, double shift, int *touch, double machEps, PRIMME_COMPLEX_DOUBLE *spare,
+      PRIMME_COMPLEX_DOUBLE *rwork, size_t *rworkSize, primme_params *primme);
 int inner_solve_sprimme(float *x, float *r, float *rnorm, float *evecs,
       PRIMME_INT ldevecs, float *UDU, int *ipivot, float *xKinvx,
       float *Lprojector, PRIMME_INT ldLprojector, float *RprojectorQ,
       PRIMME_INT ldRprojectorQ, float *RprojectorX, PRIMME_INT ldRprojectorX,
       int sizeLprojector, int sizeRprojectorQ, int sizeRprojectorX, float *sol,
-      float eval, float shift, int *touch, double machEps, float *rwork,
-      size_t rworkSize, primme_params *primme);
+      float eval, float shift, int *touch, double machEps, float *spare,
+      float *rwork, size_t *rworkSize, primme_params *primme);
 int inner_solve_cprimme(PRIMME_COMPLEX_FLOAT *x, PRIMME_COMPLEX_FLOAT *r, float *rnorm, PRIMME_COMPLEX_FLOAT *evecs,
       PRIMME_INT ldevecs, PRIMME_COMPLEX_FLOAT *UDU, int *ipivot, PRIMME_COMPLEX_FLOAT *xKinvx,
       PRIMME_COMPLEX_FLOAT *Lprojector, PRIMME_INT ldLprojector, PRIMME_COMPLEX_FLOAT *RprojectorQ,
       PRIMME_INT ldRprojectorQ, PRIMME_COMPLEX_FLOAT *RprojectorX, PRIMME_INT ldRprojectorX,
       int sizeLprojector, int sizeRprojectorQ, int sizeRprojectorX, PRIMME_COMPLEX_FLOAT *sol,
-      float eval, float shift, int *touch, double machEps, PRIMME_COMPLEX_FLOAT *rwork,
-      size_t rworkSize, primme_params *primme);
+      float eval, float shift, int *touch, double machEps, PRIMME_COMPLEX_FLOAT *spare,
+      PRIMME_COMPLEX_FLOAT *rwork, size_t *rworkSize, primme_params *primme);
 #endif
@@ -48,6 +48,10 @@ static void insertionSort(REAL newVal, REAL *evals, REAL newNorm,
    REAL *resNorms, int newFlag, int *flags, int *perm, int numLocked,
    primme_params *primme);
 
+static void mergeLocked(REAL *evals, REAL *resNorms, int *flags, int *perm,
+   int numLocked0, int numLocked, REAL *rwork, int *iwork,
+   primme_params *primme);
+
 static int compute_residual_columns(PRIMME_INT m, REAL *evals, SCALAR *x,
       int n, int *p, PRIMME_INT ldx, SCALAR *Ax, PRIMME_INT ldAx,
       SCALAR *xo, int no, PRIMME_INT ldxo, int io0, SCALAR *ro, PRIMME_INT ldro,
@@ -189,6 +193,7 @@ int restart_locking_Sprimme(int *restartSize, SCALAR *V, SCALAR *W,
    int numLocked0 = *numLocked; /* aux variables                         */
    REAL *blockNorms0;
    size_t rworkSize0 = *rworkSize;
+   double t0[1+PRIMME_PERF_NUM];
 
    /* Return memory requirement */
    if (V == NULL) {
@@ -217,6 +222,8 @@ int restart_locking_Sprimme(int *restartSize, SCALAR *V, SCALAR *W,
       return 0;
    }
 
+   phaseBegin_Sprimme(t0, primme);
+
    overbooking = (*numConverged > primme->numEvals);
 
    /* -------------------------------------------------------------- */
@@ -329,17 +336,11 @@ int restart_locking_Sprimme(int *restartSize, SCALAR *V, SCALAR *W,
             machEps, rwork, &rworkSize0, iwork, iworkSize, primme), -1);
 
    /* -------------------------------------------------------------- */
-   /* Copy the values for the converged values into evals, and in    */
-   /* case of overbooking also the converged vectors into evecs.     */
+   /* Copy the values for the converged values into evals            */
    /* -------------------------------------------------------------- */
 
    for (i=left, j=0; i < left+numPacked; i++) {
       if (flags[i] != UNCONVERGED && *numLocked+j < primme->numEvals) {
-         if (overbooking) {
-            Num_copy_matrix_Sprimme(&V[i*ldV], nLocal, 1, ldV,
-                  &evecs[(*numLocked+primme->numOrthoConst+j)*ldevecs],
-                  ldevecs);
-         }
          evals[*numLocked+j++] = hVals[i];
       }
       else {
@@ -362,6 +363,14 @@ int restart_locking_Sprimme(int *restartSize, SCALAR *V, SCALAR *W,
    for (i=left, j=0; i < left+numPacked; i++)
       if (flags[i] != UNCONVERGED) ifailed[failed+j++] = i-left;
 
+   /* In case of overbooking, copy the converged vectors into evecs  */
+
+   if (overbooking) {
+      Num_compact_vecs_Sprimme(&V[left*ldV], nLocal, numPacked-failed, ldV,
+            &ifailed[failed],
+            &evecs[(*numLocked+primme->numOrthoConst)*ldevecs], ldevecs, 0);
+   }
+
    if (1 /* Put zero to disable the new feature */) {
       /* New feature: the pairs that failed to be locked are         */
       /* rearranged with the rest of the restarted vectors and they  */
@@ -467,19 +476,23 @@ int restart_locking_Sprimme(int *restartSize, SCALAR *V, SCALAR *W,
    *R = &W[(left+failed)*ldV];
 
    /* Pack those Ritz vectors that are actually converged from */
-   /* those that have been copied into evecs. Also insertSort  */
-   /* the converged Ritz value within the evals array.         */ 
+   /* those that have been copied into evecs.                  */
+
+   if (!overbooking) {
+      Num_compact_vecs_Sprimme(
+            &evecs[(numLocked0+primme->numOrthoConst)*ldevecs], nLocal,
+            numPacked-failed, ldevecs, &ifailed[failed],
+            &evecs[(numLocked0+primme->numOrthoConst)*ldevecs], ldevecs, 0);
+   }
+
+   /* Append the converged pairs to the locked ones, and merge them */
+   /* into the sorted evals array after all have been reported.     */
 
    for (i=left; i < left+numPacked; i++) {
        if (flags[i] != UNCONVERGED && *numLocked < primme->numEvals) {
          REAL resNorm = resNorms[*numLocked] = lockedResNorms[i-left];
-         REAL eval = evals[*numLocked];
-         if (!overbooking) {
-            Num_copy_matrix_Sprimme(
-                  &evecs[(numLocked0+i-left+primme->numOrthoConst)*ldevecs],
-                  nLocal, 1, ldevecs,
-                  &evecs[(*numLocked+primme->numOrthoConst)*ldevecs], ldevecs);
-         }
+         lockedFlags[*numLocked] = flags[i];
+         evecsperm[*numLocked] = *numLocked;
 
          (*numLocked)++;
 
@@ -488,7 +501,6 @@ int restart_locking_Sprimme(int *restartSize, SCALAR *V, SCALAR *W,
          if (primme->monitorFun) {
             primme_event EVENT_LOCKED = primme_event_locked;
             int err;
-            lockedFlags[*numLocked-1] = flags[i];
             primme->stats.elapsedTime = primme_wTimer(0);
             CHKERRM((primme->monitorFun(NULL, NULL, NULL, NULL, NULL, NULL,
                         NULL, evals, numLocked, lockedFlags, resNorms, NULL, NULL,
@@ -496,9 +508,6 @@ int restart_locking_Sprimme(int *restartSize, SCALAR *V, SCALAR *W,
                   "Error returned by monitorFun: %d", err);
          }
 
-         insertionSort(eval, evals, resNorm, resNorms, flags[i], lockedFlags,
-               evecsperm, *numLocked-1, primme);
-
          /* Update maxConvTol if it wasn't practically converged */
          if (flags[i] == CONVERGED) {
             primme->stats.maxConvTol = max(primme->stats.maxConvTol, resNorm);
@@ -506,6 +515,11 @@ int restart_locking_Sprimme(int *restartSize, SCALAR *V, SCALAR *W,
       }
    }
 
+   assert(rworkSize0 >= (size_t)(2*(*numLocked-numLocked0))
+         && iworkSize >= 2*(*numLocked-numLocked0));
+   mergeLocked(evals, resNorms, lockedFlags, evecsperm, numLocked0,
+         *numLocked, (REAL*)rwork, iwork, primme);
+
    *restartSize = left + failed;
    *ievSize = min(maxBlockSize, sizeBlockNorms+failed);
    *numConverged = *numLocked;
@@ -517,6 +531,8 @@ int restart_locking_Sprimme(int *restartSize, SCALAR *V, SCALAR *W,
    
    for (i=0; i<basisSize; i++) flags[i] = UNCONVERGED;
 
+   phaseEnd_Sprimme(t0, primme_phase_locking, primme);
+
    return 0;
 }
 
@@ -643,6 +659,130 @@ static void insertionSort(REAL newVal, REAL *evals, REAL newNorm,
 
 }
 
+/******************************************************************************
+ * Function lockedKey - Return the value that sorts the locked Ritz values in
+ *    ascending order as insertionSort does, for the given shift.
+ ******************************************************************************/
+
+static REAL lockedKey(REAL val, REAL shift, primme_params *primme) {
+
+   switch(primme->target) {
+   case primme_smallest:      return val;
+   case primme_largest:       return -val;
+   case primme_closest_geq:   return val-shift;
+   case primme_closest_leq:   return shift-val;
+   case primme_closest_abs:   return fabs(val-shift);
+   case primme_largest_abs:   return -fabs(val-shift);
+   default:
+      /* This should never happen */
+      assert(0);
+      return 0.0;
+   }
+}
+
+/******************************************************************************
+ * Subroutine mergeLocked -- This subroutine sorts the Ritz values appended
+ *   after the first numLocked0 locked values, and merges them into the sorted
+ *   evals array as successive calls to insertionSort would do, but without
+ *   shifting the array for every new value.
+ *
+ *   For interior targets the values locked for different shifts are not
+ *   reordered. If the new values are not all locked for the same shift, it
+ *   falls back to insertionSort.
+ *
+ *
+ * Input parameters
+ * ----------------
+ * numLocked0  The number of locked values already sorted
+ *
+ * numLocked   The total number of locked values
+ *
+ * rwork       Workspace of size 2*(numLocked-numLocked0)
+ *
+ * iwork       Workspace of size 2*(numLocked-numLocked0)
+ *
+ * primme      Structure containing various solver parameters
+ *
+ *
+ * Input/Output parameters
+ * -----------------------
+ * evals    The list of locked Ritz values
+ *
+ * resNorms The residual norms corresponding to the locked Ritz values
+ *
+ * flags    The flags of the locked pairs
+ *
+ * perm     The permutation array indicating each Ritz values original
+ *          unsorted position.
+ *
+ ******************************************************************************/
+
+static void mergeLocked(REAL *evals, REAL *resNorms, int *flags, int *perm,
+   int numLocked0, int numLocked, REAL *rwork, int *iwork,
+   primme_params *primme) {
+
+   int i, j, k, lo, n = numLocked-numLocked0;
+   REAL shift = 0.0, key;
+   REAL *newVals = rwork, *newNorms = rwork+n;
+   int *newFlags = iwork, *newPerm = iwork+n;
+
+   if (n <= 0) return;
+
+   /* For interior targets, new values locked for different shifts    */
+   /* are inserted one by one; otherwise only the tail of the locked  */
+   /* values with the same shift as the new ones is merged.           */
+
+   lo = 0;
+   if (primme->target != primme_smallest && primme->target != primme_largest) {
+      if (numLocked0 < primme->numTargetShifts-1) {
+         for (i=numLocked0; i<numLocked; i++) {
+            insertionSort(evals[i], evals, resNorms[i], resNorms, flags[i],
+                  flags, perm, i, primme);
+         }
+         return;
+      }
+      shift = primme->targetShifts[primme->numTargetShifts-1];
+      for (lo=numLocked0; lo > 0 && primme->targetShifts[
+            min(primme->numTargetShifts-1, lo-1)] == shift; lo--);
+   }
+
+   /* Sort the new values, keeping the order of the ones with the same key */
+
+   for (i=0; i<n; i++) {
+      key = lockedKey(evals[numLocked0+i], shift, primme);
+      for (j=i; j > 0 && lockedKey(newVals[j-1], shift, primme) > key; j--) {
+         newVals[j] = newVals[j-1];
+         newNorms[j] = newNorms[j-1];
+         newFlags[j] = newFlags[j-1];
+         newPerm[j] = newPerm[j-1];
+      }
+      newVals[j] = evals[numLocked0+i];
+      newNorms[j] = resNorms[numLocked0+i];
+      newFlags[j] = flags[numLocked0+i];
+      newPerm[j] = perm[numLocked0+i];
+   }
+
+   /* Merge from the end; old values go first among the same key */
+
+   for (i=numLocked0-1, j=n-1, k=numLocked-1; j >= 0; k--) {
+      if (i >= lo && lockedKey(evals[i], shift, primme)
+            > lockedKey(newVals[j], shift, primme)) {
+         evals[k] = evals[i];
+         resNorms[k] = resNorms[i];
+         flags[k] = flags[i];
+         perm[k] = perm[i];
+         i--;
+      }
+      else {
+         evals[k] = newVals[j];
+         resNorms[k] = newNorms[j];
+         flags[k] = newFlags[j];
+         perm[k] = newPerm[j];
+         j--;
+      }
+   }
+}
+
 /******************************************************************************
  * Function compute_residual_columns - This subroutine performs the next
  *    operations in a cache-friendly way:
@@ -158,6 +158,8 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
                             /* based restarting.                             */
    int numArbitraryVecs;    /* Columns in hVecs computed with RR instead of  */
                             /* the current extraction method.                */
+   int numSpeculative=0;    /* Extra candidates computed by prepare_candidates*/
+                            /* in its first pass                             */
    int maxEvecsSize;        /* Maximum capacity of evecs array               */
    size_t rworkSize;        /* Size of rwork array                           */
    int iworkSize;           /* Size of iwork array                           */
@@ -205,6 +207,9 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
    double smallestResNorm;  /* the smallest residual norm in the block       */
    int reset=0;             /* Flag to reset V and W                         */
    int restartsSinceReset=0;/* Restart since last reset of V and W           */
+   int pipelined;           /* Expand the basis with a single reduction      */
+   double pipelineError=0.0;/* Error added to W by the pipelined expansions  */
+                            /* since the last reset of W                     */
    int wholeSpace=0;        /* search subspace reach max size                */
 
    /* Runtime measurement variables for dynamic method switching             */
@@ -212,6 +217,9 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
                             /* the parameters of the model.Only visible here */
    double tstart=0.0;       /* Timing variable for accumulative time spent   */
 
+   /* Runtime measurements for dynamic block and restart sizes               */
+   primme_SizeModel SizeModel = {0};
+
    /* -------------------------------------------------------------- */
    /* Subdivide the workspace                                        */
    /* -------------------------------------------------------------- */
@@ -266,7 +274,7 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
       hSVals     = (REAL *)rwork; rwork += TO_REAL(primme->maxBasisSize);
    }
    prevRitzVals  = (REAL *)rwork; rwork += TO_REAL(primme->maxBasisSize+primme->numEvals);
-   blockNorms    = (REAL *)rwork; rwork += TO_REAL(primme->maxBlockSize);
+   blockNorms    = (REAL *)rwork; rwork += TO_REAL(2*primme->maxBlockSize);
    basisNorms    = (REAL *)rwork; rwork += TO_REAL(primme->maxBasisSize);
    #undef TO_REAL
 
@@ -280,7 +288,7 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
       lockedFlags = iwork; iwork += primme->numEvals; iworkSize -= primme->numEvals;
    }
    flags = iwork; iwork += primme->maxBasisSize; iworkSize -= primme->maxBasisSize;
-   iev = iwork; iwork += primme->maxBlockSize; iworkSize -= primme->maxBlockSize;
+   iev = iwork; iwork += 2*primme->maxBlockSize; iworkSize -= 2*primme->maxBlockSize;
    ipivot = iwork; iwork += maxEvecsSize; iworkSize -= maxEvecsSize;
 
    /* -------------------------------------------------------------- */
@@ -294,11 +302,22 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
    primme->stats.numGlobalSum                  = 0;
    primme->stats.volumeGlobalSum               = 0;
    primme->stats.numOrthoInnerProds            = 0.0;
+   primme->stats.numInnerIterations            = 0;
+   primme->stats.numInnerGlobalSum             = 0;
+   primme->stats.volumeRestart                 = 0;
    primme->stats.elapsedTime                   = 0.0;
    primme->stats.timeMatvec                    = 0.0;
    primme->stats.timePrecond                   = 0.0;
    primme->stats.timeOrtho                     = 0.0;
    primme->stats.timeGlobalSum                 = 0.0;
+   primme->stats.timeSolveH                    = 0.0;
+   primme->stats.timeRestart                   = 0.0;
+   primme->stats.timeLocking                   = 0.0;
+   for (i=0; i<PRIMME_NUM_PHASES; i++) {
+      primme->stats.hwCycles[i]                = 0.0;
+      primme->stats.hwInstructions[i]          = 0.0;
+      primme->stats.hwCacheMisses[i]           = 0.0;
+   }
    primme->stats.estimateMinEVal               = HUGE_VAL;
    primme->stats.estimateMaxEVal               = -HUGE_VAL;
    primme->stats.estimateLargestSVal           = -HUGE_VAL;
@@ -375,6 +394,14 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
       primme->correctionParams.maxInnerIterations = 0; 
    }
 
+   /* --------------------------------------------------------------- */
+   /* Dynamic sizes means that maxBlockSize and minRestartSize change */
+   /* at every restart based on runtime timing measurements           */
+   /* --------------------------------------------------------------- */
+   if (primme->dynamicSizes > 0) {
+      initializeSizeModel(&SizeModel, primme);
+   }
+
    /* ---------------------------------------------------------------------- */
    /* Outer most loop                                                        */
    /* Without locking, restarting can cause converged Ritz values to become  */
@@ -474,7 +501,9 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
                   &V[basisSize*ldV], &W[basisSize*ldW],
                   hVecs, basisSize, hVals, hSVals, flags,
                   maxRecentlyConverged, blockNorms, blockSize,
-                  availableBlockSize, evecs, numLocked, ldevecs, evals,
+                  availableBlockSize, min(2*primme->maxBlockSize,
+                     primme->maxBasisSize-basisSize), &numSpeculative,
+                  evecs, numLocked, ldevecs, evals,
                   resNorms, targetShiftIndex, machEps, iev, &blockSize,
                   &recentlyConverged, &numArbitraryVecs, &smallestResNorm,
                   hVecsRot, primme->maxBasisSize, numConverged, basisNorms,
@@ -542,10 +571,15 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
             /* We zero out the V(AvailableBlockSize), avoid any correction   */
             /* and let ortho create the random vectors.                      */
 
+            pipelined = primme->projectionParams.pipeline && H && !Q
+               && !QtV && primme->numOrthoConst+numLocked == 0
+               && !primme->massMatrixMatvec;
+
             if (blockSize == 0) {
                blockSize = availableBlockSize;
                Num_scal_Sprimme(blockSize*primme->nLocal, 0.0,
                   &V[ldV*basisSize], 1);
+               pipelined = 0;
             }
             else {
 
@@ -598,17 +632,60 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
               
             } /* end of else blocksize=0 */
 
-            /* Orthogonalize the corrections with respect to each other */
-            /* and the current basis.                                   */
-            CHKERR(ortho_Sprimme(V, ldV, NULL, 0, basisSize, 
-               basisSize+blockSize-1, evecs, ldevecs, 
-               primme->numOrthoConst+numLocked, primme->nLocal, primme->iseed, 
-               machEps, rwork, &rworkSize, primme), -1);
+            /* ------------------------------------------------------------ */
+            /* Pipelined expansion: compute W = A*V for the raw corrections */
+            /* and then orthogonalize V and W and extend H at once, with a  */
+            /* single reduction per pass instead of the reductions done by  */
+            /* ortho and update_projection. A second pass restores the      */
+            /* orthogonality when the corrections were close to the basis.  */
+            /* The error added to W is accounted in estimateResidualError,  */
+            /* so check_convergence asks for resetting W when it matters.   */
+            /* If the block is almost linearly dependent, fall back to the  */
+            /* regular path; the matvec is done again in that case.         */
+            /* ------------------------------------------------------------ */
 
-            /* Compute W = A*V for the orthogonalized corrections */
+            if (pipelined) {
+               double aNorm = max(primme->aNorm,
+                     primme->stats.estimateLargestSVal);
+               REAL rho;
+
+               CHKERR(matrixMatvec_Sprimme(V, primme->nLocal, ldV, W, ldW,
+                        basisSize, blockSize, primme), -1);
+
+               pipelined = 0;
+               for (i=0; i<2; i++) {
+                  CHKERR(update_projection_pipelined_Sprimme(V, ldV, W, ldW,
+                           H, primme->maxBasisSize, primme->nLocal, basisSize,
+                           blockSize, &rho, rwork, &rworkSize, primme), -1);
+                  if (rho < sqrt(machEps)) break;
+                  primme->stats.estimateResidualError += machEps*aNorm/sqrt(rho);
+                  pipelineError += machEps*aNorm/sqrt(rho);
+                  if (rho >= 0.5) {
+                     pipelined = 1;
+                     break;
+                  }
+               }
 
-            CHKERR(matrixMatvec_Sprimme(V, primme->nLocal, ldV, W, ldW,
-                     basisSize, blockSize, primme), -1);
+               if (!pipelined && primme->printLevel >= 5 && primme->procID == 0) {
+                  fprintf(primme->outputFile, 
+                        "Pipelined expansion rejected: rho = %g.\n", (double)rho);
+                  fflush(primme->outputFile);
+               }
+            }
+
+            if (!pipelined) {
+               /* Orthogonalize the corrections with respect to each other */
+               /* and the current basis.                                   */
+               CHKERR(ortho_Sprimme(V, ldV, NULL, 0, basisSize, 
+                  basisSize+blockSize-1, evecs, ldevecs, 
+                  primme->numOrthoConst+numLocked, primme->nLocal, primme->iseed, 
+                  machEps, rwork, &rworkSize, primme), -1);
+
+               /* Compute W = A*V for the orthogonalized corrections */
+
+               CHKERR(matrixMatvec_Sprimme(V, primme->nLocal, ldV, W, ldW,
+                        basisSize, blockSize, primme), -1);
+            }
 
             if (Q) CHKERR(update_Q_Sprimme(V, primme->nLocal, ldV, W, ldW, Q,
                      ldQ, R, primme->maxBasisSize,
@@ -618,9 +695,9 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
             /* Extend H by blockSize columns and rows and solve the */
             /* eigenproblem for the new H.                          */
 
-            if (H) CHKERR(update_projection_Sprimme(V, ldV, W, ldW, H,
-                     primme->maxBasisSize, primme->nLocal, basisSize, blockSize,
-                     rwork, &rworkSize, 1/*symmetric*/, primme), -1);
+            if (H && !pipelined) CHKERR(update_projection_Sprimme(V, ldV, W,
+                     ldW, H, primme->maxBasisSize, primme->nLocal, basisSize,
+                     blockSize, rwork, &rworkSize, 1/*symmetric*/, primme), -1);
 
             if (QtV) CHKERR(update_projection_Sprimme(Q, ldQ, V, ldV, QtV,
                      primme->maxBasisSize, primme->nLocal, basisSize, blockSize,
@@ -756,7 +833,8 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
                   NULL, NULL,
                   hVecs, basisSize, hVals, hSVals, flags,
                   maxRecentlyConverged, blockNorms, blockSize,
-                  availableBlockSize, evecs, numLocked, ldevecs, evals,
+                  availableBlockSize, 2*primme->maxBlockSize, &numSpeculative,
+                  evecs, numLocked, ldevecs, evals,
                   resNorms, targetShiftIndex, machEps, iev, &blockSize,
                   &recentlyConverged, &numArbitraryVecs, dummySmallestResNorm,
                   hVecsRot, primme->maxBasisSize, numConverged, basisNorms,
@@ -820,6 +898,15 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
             }
          }
 
+         /* ------------------------------------------------------ */
+         /* If dynamic sizes, choose maxBlockSize and              */
+         /* minRestartSize for this restart and the next iterations */
+         /* ------------------------------------------------------ */
+
+         if (primme->dynamicSizes > 0) {
+            CHKERR(update_sizes(&SizeModel, numConverged, primme), -1);
+         }
+
          /* ------------------ */
          /* Restart the basis  */
          /* ------------------ */
@@ -838,6 +925,11 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
                primme->maxBasisSize, &restartsSinceReset, &reset, machEps,
                rwork, &rworkSize, iwork, iworkSize, primme);
 
+         /* W keeps the error of the pipelined expansions until it is reset */
+
+         if (restartsSinceReset == 0) pipelineError = 0.0;
+         primme->stats.estimateResidualError += pipelineError;
+
          /* If there are any initial guesses remaining, then copy it */
          /* into the basis.                                          */
 
@@ -902,6 +994,19 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
 
          primme->initSize = numConverged;
 
+         /* Report the sizes chosen for the next cycle */
+
+         if (primme->monitorFun && primme->dynamicSizes > 0) {
+            primme_event EVENT_RESTART = primme_event_restart;
+            primme->stats.elapsedTime = primme_wTimer(0);
+            int err;
+            CHKERRM((primme->monitorFun(hVals, &basisSize, flags, iev,
+                        &blockSize, basisNorms, &numConverged, evals,
+                        &numLocked, lockedFlags, resNorms, NULL, NULL,
+                        &EVENT_RESTART, primme, &err),
+                     err), -1, "Error returned by monitorFun: %d", err);
+         }
+
          /* ------------------------------------------------------------- */
          /* If dynamic method switching == 1, update model parameters and */
          /* evaluate whether to switch from GD+k to JDQMR. This is after  */
@@ -1052,6 +1157,7 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
             restartsSinceReset = 0;
             reset = 0;
             primme->stats.estimateResidualError = 0.0;
+            pipelineError = 0.0;
 
            /* ------------------------------------------------------------ */
          } /* End of elseif(!converged). Restart and recompute all epairs
@@ -1079,6 +1185,12 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
  * Subroutine prepare_candidates - This subroutine puts into the block the first
  *    unconverged Ritz pairs, up to maxBlockSize. If needed, compute residuals
  *    and rearrange the coefficient vectors in hVecs.
+ *
+ *    Every group of candidates costs a pass over V and W and a reduction. If
+ *    some pairs converge, the block is not full after the first group and
+ *    another pass is needed. So the first group also includes numSpeculative
+ *    extra candidates, as many as were examined beyond maxBlockSize in the
+ *    previous call, up to maxWindowSize in total.
  * 
  * INPUT ARRAYS AND PARAMETERS
  * ---------------------------
@@ -1096,6 +1208,8 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
  * remainedEvals  Remained number of eigenpairs that the user wants computed
  * blockNormsSize Number of already computed residuals
  * maxBlockSize   maximum allowed size of the block
+ * maxWindowSize  maximum number of candidates computed at once; X, R, iev and
+ *                blockNorms should have space for that many columns
  * evecs          Converged eigenvectors
  * evecsSize      The size of evecs
  * numLocked      The number of vectors currently locked (if locking)
@@ -1112,6 +1226,7 @@ int main_iter_Sprimme(REAL *evals, int *perm, SCALAR *evecs, PRIMME_INT ldevecs,
  * blockNorms    Residual norms of the Ritz vectors being computed during the
  *               current iteration
  * blockSize     Dimension of the block
+ * numSpeculative Number of extra candidates computed in the first pass
  *
  * OUTPUT ARRAYS AND PARAMETERS
  * ----------------------------
@@ -1125,7 +1240,8 @@ int prepare_candidates_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
       PRIMME_INT ldW, PRIMME_INT nLocal, SCALAR *H, int ldH, int basisSize,
       SCALAR *X, SCALAR *R, SCALAR *hVecs, int ldhVecs, REAL *hVals,
       REAL *hSVals, int *flags, int remainedEvals, REAL *blockNorms,
-      int blockNormsSize, int maxBlockSize, SCALAR *evecs, int numLocked,
+      int blockNormsSize, int maxBlockSize, int maxWindowSize,
+      int *numSpeculative, SCALAR *evecs, int numLocked,
       PRIMME_INT ldevecs, REAL *evals, REAL *resNorms, int targetShiftIndex,
       double machEps, int *iev, int *blockSize, int *recentlyConverged,
       int *numArbitraryVecs, double *smallestResNorm, SCALAR *hVecsRot,
@@ -1142,6 +1258,8 @@ int prepare_candidates_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
    double targetShift;  /* current target shift */
    size_t rworkSize0;   /* current size of rwork */
    int lasti;           /* last tested pair */
+   int windowSize;      /* number of candidates in the block plus the extra */
+   int numTested;       /* number of pairs tested to fill the block */
 
    /* -------------------------- */
    /* Return memory requirements */
@@ -1165,27 +1283,30 @@ int prepare_candidates_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
                &t, basisSize-maxBlockSize, basisSize, 0, &d,
                NULL, 0, 0,
                NULL, 0, primme));
-      CHKERR(prepare_vecs_Sprimme(basisSize, 0, maxBlockSize, NULL, 0,
+      CHKERR(prepare_vecs_Sprimme(basisSize, 0, maxWindowSize, NULL, 0,
                NULL, NULL, NULL, 0, 0, NULL, 0.0, NULL, 0, NULL, 0, 0.0, &lrw,
                NULL, 0, &liw, primme), -1);
       *rworkSize = max(*rworkSize,
-            (size_t)maxBlockSize+(size_t)maxBlockSize*(size_t)basisSize+lrw);
-      *iwork = max(*iwork, liw + basisSize);
+            (size_t)maxWindowSize+(size_t)maxWindowSize*(size_t)basisSize+lrw);
+      *iwork = max(*iwork, liw + max(basisSize, maxWindowSize));
       return 0;
    }
 
+   assert(maxWindowSize >= maxBlockSize);
    *blockSize = 0;
    hValsBlock0 = (REAL*)rwork;
-   hVecsBlock0 = &rwork[maxBlockSize];
-   rwork += maxBlockSize + ldhVecs*maxBlockSize;
-   assert(*rworkSize >= (size_t)(maxBlockSize + ldhVecs*maxBlockSize));
-   rworkSize0 = *rworkSize - maxBlockSize - ldhVecs*maxBlockSize;
+   hVecsBlock0 = &rwork[maxWindowSize];
+   rwork += maxWindowSize + ldhVecs*maxWindowSize;
+   assert(*rworkSize >= (size_t)(maxWindowSize + ldhVecs*maxWindowSize));
+   rworkSize0 = *rworkSize - maxWindowSize - ldhVecs*maxWindowSize;
    flagsBlock = iwork;
-   iwork += maxBlockSize;
-   iworkSize -= maxBlockSize;
+   iwork += maxWindowSize;
+   iworkSize -= maxWindowSize;
    assert(iworkSize >= 0);
    targetShift = primme->targetShifts ? primme->targetShifts[targetShiftIndex] : 0.0;
    lasti = -1;
+   windowSize = min(maxWindowSize, maxBlockSize + max(0, *numSpeculative));
+   numTested = 0;
 
    /* Pack hVals for already computed residual pairs */
 
@@ -1284,20 +1405,25 @@ int prepare_candidates_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
          }
 
          lasti = iev[blki];
+         numTested++;
       }
 
+      /* Don't look for extra candidates if the block is full */
+
+      if (*blockSize >= maxBlockSize) windowSize = maxBlockSize;
+
       /* Generate well conditioned coefficient vectors; start from the last   */
       /* position visited (variable i)                                        */
 
       blki = *blockSize;
-      prepare_vecs_Sprimme(basisSize, lasti+1, maxBlockSize-blki, H, ldH, hVals,
+      prepare_vecs_Sprimme(basisSize, lasti+1, windowSize-blki, H, ldH, hVals,
             hSVals, hVecs, ldhVecs, targetShiftIndex, numArbitraryVecs,
             *smallestResNorm, flags, 1, hVecsRot, ldhVecsRot, machEps,
             &rworkSize0, rwork, iworkSize, iwork, primme);
 
       /* Find next candidates, starting from iev(*blockSize)+1 */
 
-      for (i=lasti+1; i<basisSize && blki < maxBlockSize; i++)
+      for (i=lasti+1; i<basisSize && blki < windowSize; i++)
          if (flags[i] == UNCONVERGED) iev[blki++] = i;
 
       /* If no new candidates or all required solutions converged yet, go out */
@@ -1329,6 +1455,11 @@ int prepare_candidates_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
                rwork, rworkSize0, primme), -1);
    }
 
+   /* Compute in the next call as many extra candidates as pairs were tested */
+   /* beyond the block in this one                                           */
+
+   *numSpeculative = max(0, numTested - maxBlockSize);
+
    return 0;
 }
 
@@ -1955,6 +2086,141 @@ static void initializeModel(primme_CostModel *model, primme_params *primme) {
    model->accum_jdq_gdk  = 1.0L;
 }
 
+/******************************************************************************
+ * Function initializeSizeModel - Initializes the model for dynamic sizes
+ ******************************************************************************/
+
+static void initializeSizeModel(primme_SizeModel *model,
+      primme_params *primme) {
+   model->maxBlockSize    = primme->maxBlockSize;
+   model->minRestartSize  = primme->minRestartSize;
+   model->timeMatvec_0    = primme->stats.timeMatvec;
+   model->timeOrtho_0     = primme->stats.timeOrtho;
+   model->timeGlobalSum_0 = primme->stats.timeGlobalSum;
+   model->timer_0         = primme_wTimer(0);
+   model->numConverged_0  = 0;
+   model->rate_0          = -1.0;
+   model->direction       = 0;
+}
+
+/******************************************************************************
+ * Function update_sizes - 
+ *    If primme->dynamicSizes > 0, choose maxBlockSize and minRestartSize for
+ *    the next restart cycle from runtime measurements. The sizes are never
+ *    larger than the ones set by the user, which the workspace is sized for.
+ *    maxBasisSize is not changed because it is the leading dimension of H
+ *    and the other projected matrices.
+ *
+ *    The block size is the user's maxBlockSize while the global reductions
+ *    take more than half the time of the matvecs plus the orthogonalization
+ *    since the previous call, because larger blocks need fewer reductions
+ *    per vector. Otherwise, it is not larger than the number of pairs left
+ *    to converge, which saves the matvecs on vectors that are not needed.
+ *
+ *    The restart size is tuned by measuring the pairs converged per second,
+ *    except with GD+k, whose previous vectors assume a steady restart size.
+ *    It changes every time some pair converges, by a quarter of its range:
+ *    in the same direction as the previous change if the throughput improved,
+ *    and in the opposite one otherwise. The first change shrinks it if the
+ *    orthogonalization takes longer than the matvecs (a smaller basis on
+ *    average is cheaper) and grows it otherwise (keeping more of the basis
+ *    speeds up the convergence). It stays between half the user's
+ *    minRestartSize (half the way to numEvals without locking, because the
+ *    converged pairs stay in the basis) and the user's minRestartSize.
+ *
+ *    The decision is the same in all processes: the times are averaged among
+ *    them.
+ *
+ * INPUT
+ * -----
+ * numConverged The number of converged pairs
+ *
+ * INPUT/OUTPUT
+ * ------------
+ * model        The measurements at the previous calls
+ * primme       The solver parameters (maxBlockSize and minRestartSize changed)
+ *
+ ******************************************************************************/
+
+static int update_sizes(primme_SizeModel *model, int numConverged,
+      primme_params *primme) {
+
+   int i;
+   double t[4], t0[4];    /* matvec, ortho and globalSum time since last call */
+                          /* and time since the restart size changed          */
+   double rate;           /* pairs converged per second                       */
+   int remaining, blockSize, restartSize, lo, hi, step;
+
+   t[0] = primme->stats.timeMatvec - model->timeMatvec_0;
+   t[1] = primme->stats.timeOrtho - model->timeOrtho_0;
+   t[2] = primme->stats.timeGlobalSum - model->timeGlobalSum_0;
+   t[3] = primme_wTimer(0) - model->timer_0;
+
+   /* If more than one proc, make sure that all have the same times */
+
+   if (primme->numProcs > 1) {
+      CHKERR(globalSum_dprimme(t, t0, 4, primme), -1);
+      for (i=0; i<4; i++) t[i] = t0[i]/primme->numProcs;
+   }
+
+   model->timeMatvec_0    = primme->stats.timeMatvec;
+   model->timeOrtho_0     = primme->stats.timeOrtho;
+   model->timeGlobalSum_0 = primme->stats.timeGlobalSum;
+
+   /* Choose the block size */
+
+   remaining = max(1, primme->numEvals - numConverged);
+   if (t[2] > 0.5*(t[0] + t[1])) {
+      blockSize = model->maxBlockSize;
+   }
+   else {
+      blockSize = min(model->maxBlockSize, remaining);
+   }
+
+   /* Choose the restart size if some pair converged since the last change */
+
+   restartSize = primme->minRestartSize;
+   if ((primme->restartingParams.maxPrevRetain == 0
+            || primme->correctionParams.maxInnerIterations != 0)
+         && numConverged > model->numConverged_0 && t[3] > 0.0) {
+      lo = model->minRestartSize - (model->minRestartSize
+            - (primme->locking ? 0 : min(primme->numEvals,
+                  model->minRestartSize)))/2;
+      hi = model->minRestartSize;
+      step = max(1, (hi - lo)/4);
+      rate = (numConverged - model->numConverged_0)/t[3];
+
+      if (model->direction == 0) {
+         model->direction = t[1] > t[0] ? -1 : 1;
+      }
+      else if (rate < model->rate_0) {
+         model->direction = -model->direction;
+      }
+      restartSize = min(hi, max(lo, restartSize + model->direction*step));
+
+      model->rate_0 = rate;
+      model->timer_0 = primme_wTimer(0);
+      model->numConverged_0 = numConverged;
+   }
+   else if (numConverged < model->numConverged_0) {
+      model->numConverged_0 = numConverged;
+   }
+
+   if (primme->printLevel >= 5 && primme->procID == 0) {
+      fprintf(primme->outputFile,
+            "Sizes: MV %e ortho %e globalSum %e maxBlockSize %d -> %d "
+            "minRestartSize %d -> %d\n", t[0], t[1], t[2],
+            primme->maxBlockSize, blockSize, primme->minRestartSize,
+            restartSize);
+      fflush(primme->outputFile);
+   }
+
+   primme->maxBlockSize = blockSize;
+   primme->minRestartSize = restartSize;
+
+   return 0;
+}
+
 #if 0
 /******************************************************************************
  *
@@ -52,7 +52,8 @@ int prepare_candidates_dprimme(double *V, PRIMME_INT ldV, double *W,
       PRIMME_INT ldW, PRIMME_INT nLocal, double *H, int ldH, int basisSize,
       double *X, double *R, double *hVecs, int ldhVecs, double *hVals,
       double *hSVals, int *flags, int remainedEvals, double *blockNorms,
-      int blockNormsSize, int maxBlockSize, double *evecs, int numLocked,
+      int blockNormsSize, int maxBlockSize, int maxWindowSize,
+      int *numSpeculative, double *evecs, int numLocked,
       PRIMME_INT ldevecs, double *evals, double *resNorms, int targetShiftIndex,
       double machEps, int *iev, int *blockSize, int *recentlyConverged,
       int *numArbitraryVecs, double *smallestResNorm, double *hVecsRot,
@@ -66,7 +67,8 @@ int prepare_candidates_zprimme(PRIMME_COMPLEX_DOUBLE *V, PRIMME_INT ldV, PRIMME_
       PRIMME_INT ldW, PRIMME_INT nLocal, PRIMME_COMPLEX_DOUBLE *H, int ldH, int basisSize,
       PRIMME_COMPLEX_DOUBLE *X, PRIMME_COMPLEX_DOUBLE *R, PRIMME_COMPLEX_DOUBLE *hVecs, int ldhVecs, double *hVals,
       double *hSVals, int *flags, int remainedEvals, double *blockNorms,
-      int blockNormsSize, int maxBlockSize, PRIMME_COMPLEX_DOUBLE *evecs, int numLocked,
+      int blockNormsSize, int maxBlockSize, int maxWindowSize,
+      int *numSpeculative, PRIMME_COMPLEX_DOUBLE *evecs, int numLocked,
       PRIMME_INT ldevecs, double *evals, double *resNorms, int targetShiftIndex,
       double machEps, int *iev, int *blockSize, int *recentlyConverged,
       int *numArbitraryVecs, double *smallestResNorm, PRIMME_COMPLEX_DOUBLE *hVecsRot,
@@ -80,7 +82,8 @@ int prepare_candidates_sprimme(float *V, PRIMME_INT ldV, float *W,
       PRIMME_INT ldW, PRIMME_INT nLocal, float *H, int ldH, int basisSize,
       float *X, float *R, float *hVecs, int ldhVecs, float *hVals,
       float *hSVals, int *flags, int remainedEvals, float *blockNorms,
-      int blockNormsSize, int maxBlockSize, float *evecs, int numLocked,
+      int blockNormsSize, int maxBlockSize, int maxWindowSize,
+      int *numSpeculative, float *evecs, int numLocked,
       PRIMME_INT ldevecs, float *evals, float *resNorms, int targetShiftIndex,
       double machEps, int *iev, int *blockSize, int *recentlyConverged,
       int *numArbitraryVecs, double *smallestResNorm, float *hVecsRot,
@@ -94,7 +97,8 @@ int prepare_candidates_cprimme(PRIMME_COMPLEX_FLOAT *V, PRIMME_INT ldV, PRIMME_C
       PRIMME_INT ldW, PRIMME_INT nLocal, PRIMME_COMPLEX_FLOAT *H, int ldH, int basisSize,
       PRIMME_COMPLEX_FLOAT *X, PRIMME_COMPLEX_FLOAT *R, PRIMME_COMPLEX_FLOAT *hVecs, int ldhVecs, float *hVals,
       float *hSVals, int *flags, int remainedEvals, float *blockNorms,
-      int blockNormsSize, int maxBlockSize, PRIMME_COMPLEX_FLOAT *evecs, int numLocked,
+      int blockNormsSize, int maxBlockSize, int maxWindowSize,
+      int *numSpeculative, PRIMME_COMPLEX_FLOAT *evecs, int numLocked,
       PRIMME_INT ldevecs, float *evals, float *resNorms, int targetShiftIndex,
       double machEps, int *iev, int *blockSize, int *recentlyConverged,
       int *numArbitraryVecs, double *smallestResNorm, PRIMME_COMPLEX_FLOAT *hVecsRot,
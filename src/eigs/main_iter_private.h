@@ -99,4 +99,29 @@ static void update_slowdown(primme_CostModel *model);
 static void displayModel(primme_CostModel *model);
 #endif
 
+/*----------------------------------------------------------------------------*
+ * The following are needed for the dynamic block and restart sizes
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+   int maxBlockSize;      /* maxBlockSize and minRestartSize set by the user; */
+   int minRestartSize;    /*   the workspace is allocated for them            */
+
+   /* Measurements at the previous call to update_sizes                       */
+   double timeMatvec_0;
+   double timeOrtho_0;
+   double timeGlobalSum_0;
+
+   /* Throughput since the restart size was changed the last time             */
+   double timer_0;        /* Time when the restart size was changed           */
+   int numConverged_0;    /* Converged pairs when the restart size was changed*/
+   double rate_0;         /* Pairs converged per second before that change    */
+   int direction;         /* +1 if minRestartSize is growing, -1 if shrinking */
+} primme_SizeModel;
+
+static void initializeSizeModel(primme_SizeModel *model,
+      primme_params *primme);
+static int update_sizes(primme_SizeModel *model, int numConverged,
+      primme_params *primme);
+
 #endif
@@ -71,6 +71,7 @@
 #include "const.h"
 #include "globalsum.h"
 #include "wtime.h"
+#include "auxiliary_eigs.h"
  
 
 /**********************************************************************
@@ -126,6 +127,10 @@ int ortho_Sprimme(SCALAR *basis, PRIMME_INT ldBasis, SCALAR *R,
               
    int i, j;                /* Loop indices */
    size_t minWorkSize;         
+   size_t blockWorkSize=0;  /* Workspace to project locked out of the block */
+   int blockLocked;         /* If locked was projected out of the block */
+   int nLocked;             /* Number of locked vectors in the current pass */
+   REAL *norms0=NULL;       /* Norms of the block before projecting locked */
    int nOrth, reorth;
    int randomizations;
    int updateR;             /* update factor R */
@@ -140,16 +145,24 @@ int ortho_Sprimme(SCALAR *basis, PRIMME_INT ldBasis, SCALAR *R,
    REAL s0=0.0, s02=0.0, s1=0.0, s12=0.0;
    REAL temp;
    SCALAR *overlaps;
-   double t0;
+   double t0[1+PRIMME_PERF_NUM];
 
    messages = (primme && primme->procID == 0 && primme->printLevel >= 3
          && primme->outputFile);
 
    minWorkSize = 2*(numLocked + b2 + 1);
 
+   /* Optional workspace to project out locked from all vectors at once */
+   if (numLocked > 0 && b2 > b1 && primme) {
+      CHKERR(ortho_single_iteration_Sprimme(NULL, nLocal, numLocked, 0, NULL,
+               NULL, b2-b1+1, 0, NULL, NULL, NULL, &blockWorkSize, primme),
+            -1);
+      blockWorkSize += 3*(b2-b1+1); /* for norms0 and the norms */
+   }
+
    /* Return memory requirement */
    if (basis == NULL) {
-      *rworkSize = max(*rworkSize, minWorkSize);
+      *rworkSize = max(*rworkSize, minWorkSize + blockWorkSize);
       return 0;
    }
 
@@ -168,11 +181,38 @@ int ortho_Sprimme(SCALAR *basis, PRIMME_INT ldBasis, SCALAR *R,
          for (j=0; j <= i; j++)
             R[ldR*i+j] = 0.0;
 
+   /* ------------------------------------------------------------------ */
+   /* If there is room, do the first pass of the projection against       */
+   /* locked for the whole block at once with a GEMM, instead of two      */
+   /* GEMVs per vector and one global sum for the overlaps and the norms. */
+   /* Then the first pass in the loop below only deals with the basis;    */
+   /* reorthogonalizations still include locked. norms0 keeps the norms   */
+   /* before the projection for the Daniel et al. test.                   */
+   /* ------------------------------------------------------------------ */
+
+   blockLocked = blockWorkSize > 0
+      && *rworkSize >= minWorkSize + blockWorkSize;
+   if (blockLocked) {
+      int nX = b2-b1+1;
+      REAL *overlaps0, *norms1;
+      size_t rworkSize0 = blockWorkSize - 3*nX;
+
+      norms0 = (REAL*)&rwork[minWorkSize];
+      overlaps0 = norms0 + nX;
+      norms1 = overlaps0 + nX;
+      CHKERR(ortho_single_iteration_Sprimme(locked, nLocal, numLocked,
+               ldLocked, &basis[ldBasis*b1], NULL, nX, ldBasis, overlaps0,
+               norms1, &rwork[minWorkSize+3*nX], &rworkSize0, primme), -1);
+      for (j=0; j<nX; j++) {
+         norms0[j] = sqrt(overlaps0[j]*overlaps0[j] + norms1[j]*norms1[j]);
+      }
+   }
+
    /*---------------------------------------------------*/
    /* main loop to orthogonalize new vectors one by one */
    /*---------------------------------------------------*/
 
-   t0 = primme_wTimer(0);
+   phaseBegin_Sprimme(t0, primme);
 
    for(i=b1; i <= b2; i++) {
     
@@ -207,6 +247,11 @@ int ortho_Sprimme(SCALAR *basis, PRIMME_INT ldBasis, SCALAR *R,
 
          nOrth++;
 
+         /* Locked was projected out already in the first pass, except */
+         /* for random vectors                                          */
+         nLocked = (blockLocked && nOrth == 1 && randomizations == 0) ?
+            0 : numLocked;
+
          if (nOrth == 1) {
             s02 = REAL_PART(Num_dot_Sprimme(nLocal, &basis[ldBasis*i], 1, 
                      &basis[ldBasis*i], 1));
@@ -219,25 +264,25 @@ int ortho_Sprimme(SCALAR *basis, PRIMME_INT ldBasis, SCALAR *R,
             if (primme) primme->stats.numOrthoInnerProds += i;
          }
 
-         if (numLocked > 0) {
-            Num_gemv_Sprimme("C", nLocal, numLocked, 1.0, locked, ldLocked,
+         if (nLocked > 0) {
+            Num_gemv_Sprimme("C", nLocal, nLocked, 1.0, locked, ldLocked,
                &basis[ldBasis*i], 1, 0.0, &rwork[i], 1);
-            if (primme) primme->stats.numOrthoInnerProds += numLocked;
+            if (primme) primme->stats.numOrthoInnerProds += nLocked;
          }
 
-         rwork[i+numLocked] = s02;
-         overlaps = &rwork[i+numLocked+1];
-         CHKERR(globalSum_Sprimme(rwork, overlaps, i + numLocked + 1,
+         rwork[i+nLocked] = s02;
+         overlaps = &rwork[i+nLocked+1];
+         CHKERR(globalSum_Sprimme(rwork, overlaps, i + nLocked + 1,
                   primme), -1);
 
          if (updateR) {
              Num_axpy_Sprimme(i, 1.0, overlaps, 1, &R[ldR*i], 1);
          }
 
-         if (numLocked > 0) { /* locked array most recently accessed */
-            Num_gemv_Sprimme("N", nLocal, numLocked, -1.0, locked, ldLocked, 
+         if (nLocked > 0) { /* locked array most recently accessed */
+            Num_gemv_Sprimme("N", nLocal, nLocked, -1.0, locked, ldLocked, 
                &overlaps[i], 1, 1.0, &basis[ldBasis*i], 1); 
-            if (primme) primme->stats.numOrthoInnerProds += numLocked;
+            if (primme) primme->stats.numOrthoInnerProds += nLocked;
          }
 
          if (i > 0) {
@@ -247,12 +292,13 @@ int ortho_Sprimme(SCALAR *basis, PRIMME_INT ldBasis, SCALAR *R,
          }
  
          if (nOrth == 1) {
-            s0 = sqrt(s02 = REAL_PART(overlaps[i+numLocked]));
+            s0 = sqrt(s02 = REAL_PART(overlaps[i+nLocked]));
+            if (nLocked < numLocked) s0 = norms0[i-b1];
          }
 
          /* Compute the norm of the resulting vector implicitly */
          
-         temp = REAL_PART(Num_dot_Sprimme(i+numLocked,overlaps,1,overlaps,1));
+         temp = REAL_PART(Num_dot_Sprimme(i+nLocked,overlaps,1,overlaps,1));
          s1 = sqrt(s12 = max(0.0L, s02-temp));
          
          /* s1 decreased too much. Numerical problems expected   */
@@ -297,7 +343,7 @@ int ortho_Sprimme(SCALAR *basis, PRIMME_INT ldBasis, SCALAR *R,
       }
    }
 
-   if (primme) primme->stats.timeOrtho += primme_wTimer(0) - t0;
+   phaseEnd_Sprimme(t0, primme_phase_ortho, primme);
 
    /* Check orthogonality */
    /*
@@ -339,6 +385,10 @@ int ortho_Sprimme(SCALAR *basis, PRIMME_INT ldBasis, SCALAR *R,
  * Function ortho_single_iteration -- This function orthogonalizes
  *    applies ones the projector (I-QQ') on X. Optionally returns
  *    the norms ||Q'X(i)|| and ||(I-QQ')X(i)||.
+ *
+ *    All inner products go in a single global sum. The norms of
+ *    (I-QQ')X(i) are computed implicitly as sqrt(||X(i)||^2-||Q'X(i)||^2),
+ *    so they have no relative accuracy if X(i) is nearly in span(Q).
  *   
  * ARRAYS AND PARAMETERS
  * ----------------
@@ -363,23 +413,24 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, PRIMME_INT mQ, PRIMME_INT nQ,
 
    int i, j, M=PRIMME_BLOCK_SIZE, m=min(M, mQ);
    SCALAR *y, *y0, *X0;
-   REAL *norms0;
+   int ny;                  /* Number of values in the global sum */
+   double t0[1+PRIMME_PERF_NUM];
 
    /* Return memory requirement */
    if (Q == NULL) {
-      *lrwork = max(*lrwork, (size_t)nQ*nX*2 + (size_t)M*nX);
+      *lrwork = max(*lrwork, (size_t)(nQ+1)*nX*2 + (size_t)M*nX);
       return 0;
    }
 
-   double t0 = primme_wTimer(0);
+   phaseBegin_Sprimme(t0, primme);
 
-   assert((size_t)nQ*nX*2 + (size_t)m*nX <= *lrwork);
+   /* y has Q'*X followed by the squared norms of X if asked for norms */
+   ny = nQ*nX + (norms ? nX : 0);
+   assert((size_t)ny*2 + (size_t)m*nX <= *lrwork);
 
-   /* Warning: norms0 and y overlap, so don't use them at the same time */
-   norms0 = (REAL*)rwork;
    y = rwork;
-   y0 = y + nQ*nX;
-   X0 = y0 + nQ*nX;
+   y0 = y + ny;
+   X0 = y0 + ny;
 
    /* Check if the indices of inX are contiguous */
 
@@ -405,17 +456,26 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, PRIMME_INT mQ, PRIMME_INT nQ,
    }
    primme->stats.numOrthoInnerProds += nQ*nX;
 
+   /* y(nQ*nX+i) = norm(X(i))^2 */
+   if (norms) {
+      for (i=0; i<nX; i++) {
+         SCALAR *v = &X[ldX*(inX ? inX[i] : i)];
+         y[nQ*nX+i] = Num_dot_Sprimme(mQ, v, 1, v, 1);
+      }
+      primme->stats.numOrthoInnerProds += nX;
+   }
+
    /* Store the reduction of y in y0 */
-   CHKERR(globalSum_Sprimme(y, y0, nQ*nX, primme), -1);
+   CHKERR(globalSum_Sprimme(y, y0, ny, primme), -1);
    
-   /* overlaps(i) = norm(y0(:,i))^2 */
+   /* overlaps(i) = norm(y0(:,i)); norms(i) = norm((I-QQ')X(i)) */
    for (i=0; i<nX; i++) {
-      overlaps[i] =
-         sqrt(REAL_PART(Num_dot_Sprimme(nQ, &y0[nQ*i], 1, &y0[nQ*i], 1)));
+      REAL o2 = REAL_PART(Num_dot_Sprimme(nQ, &y0[nQ*i], 1, &y0[nQ*i], 1));
+      overlaps[i] = sqrt(o2);
+      if (norms) norms[i] = sqrt(max(0.0, REAL_PART(y0[nQ*nX+i]) - o2));
    }
 
-   /* X = X - Q*y0; norms0(i) = norms(X(i))^2 */
-   if (norms) for (i=0; i<nX; i++) norms0[i] = 0.0;
+   /* X = X - Q*y0 */
    for (i=0, m=min(M,mQ); i < mQ; i+=m, m=min(m,mQ-i)) {
       if (inX) {
          Num_copy_matrix_columns_Sprimme(&X[i], m, inX, nX, ldX, X0, NULL, m);
@@ -425,21 +485,9 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, PRIMME_INT mQ, PRIMME_INT nQ,
       if (inX) {
          Num_copy_matrix_columns_Sprimme(X0, m, NULL, nX, m, &X[i], inX, ldX);
       }
-      if (norms) for (j=0; j<nX; j++) {
-         SCALAR *v = inX ? &X0[j*m] : &X[j*ldX+i];
-         norms0[j] += REAL_PART(Num_dot_Sprimme(m, v, 1, v, 1));
-      }
-   }
-
-   if (norms) {
-      /* Store the reduction of norms0 in norms */
-      CHKERR(globalSum_Rprimme(norms0, norms, nX, primme), -1);
- 
-      for (i=0; i<nX; i++) norms[i] = sqrt(norms[i]);
-      primme->stats.numOrthoInnerProds += nX;
    }
 
-   primme->stats.timeOrtho += primme_wTimer(0) - t0;
+   phaseEnd_Sprimme(t0, primme_phase_ortho, primme);
 
    return 0;
 }
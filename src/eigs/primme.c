@@ -82,6 +82,11 @@ static void default_monitor(void *basisEvals, int *basisSize, int *basisFlags,
       void *lockedEvals, int *numLocked, int *lockedFlags, void *lockedNorms,
       int *inner_its, void *LSRes, primme_event *event, primme_params *primme,
       int *err);
+static void stream_monitor(void *basisEvals, int *basisSize, int *basisFlags,
+      int *iblock, int *blockSize, void *basisNorms, int *numConverged,
+      void *lockedEvals, int *numLocked, int *lockedFlags, void *lockedNorms,
+      int *inner_its, void *LSRes, primme_event *event, primme_params *primme,
+      int *err);
 
 
 /*******************************************************************************
@@ -166,7 +171,7 @@ int Sprimme(REAL *evals, SCALAR *evecs, REAL *resNorms,
    /* Set default convTetFun  */
    /* ----------------------- */
 
-   if (!primme->convTestFun) {
+   if (!primme->convTestFun && !primme->convTestBlockFun) {
       primme->convTestFun = convTestFunAbsolute;
       if (primme->eps == 0.0) {
          primme->eps = machEps*1e4;
@@ -178,7 +183,8 @@ int Sprimme(REAL *evals, SCALAR *evecs, REAL *resNorms,
    /* ----------------------- */
 
    if (!primme->monitorFun) {
-      primme->monitorFun = default_monitor;
+      primme->monitorFun =
+         primme->monitorStream ? stream_monitor : default_monitor;
    }
 
    /* ------------------------------------------------------- */
@@ -199,12 +205,24 @@ int Sprimme(REAL *evals, SCALAR *evecs, REAL *resNorms,
    CHKERRNOABORT(MALLOC_PRIMME(primme->numEvals, &perm), MALLOC_FAILURE);
 
    /*----------------------------------------------------------------------*/
-   /* Call the solver                                                      */
+   /* Call the solver. With printLevel >= 3 also read hardware counters,   */
+   /* if they are available                                                */
    /*----------------------------------------------------------------------*/
 
-   CHKERRNOABORT(main_iter_Sprimme(evals, perm, evecs, primme->ldevecs,
-            resNorms, machEps, primme->intWork, primme->realWork, primme),
-         MAIN_ITER_FAILURE);
+   /* main_iter may change maxBlockSize and minRestartSize if dynamicSizes; */
+   /* restore the values set by the user after it returns                   */
+
+   int maxBlockSize0 = primme->maxBlockSize;
+   int minRestartSize0 = primme->minRestartSize;
+
+   primme->stats.hwCounters =
+      (primme->printLevel >= 3) ? primme_perf_open() : 0;
+   ret = main_iter_Sprimme(evals, perm, evecs, primme->ldevecs, resNorms,
+         machEps, primme->intWork, primme->realWork, primme);
+   if (primme->printLevel >= 3) primme_perf_close();
+   primme->maxBlockSize = maxBlockSize0;
+   primme->minRestartSize = minRestartSize0;
+   CHKERRNOABORT(ret, MAIN_ITER_FAILURE);
 
    /*----------------------------------------------------------------------*/
    /* If locking is engaged, the converged Ritz vectors are stored in the  */
@@ -370,10 +388,16 @@ static int allocate_workspace(primme_params *primme, int allocate) {
    CHKERR(update_projection_Sprimme(NULL, 0, NULL, 0, NULL, 0, 0, 0,
             primme->maxBasisSize, NULL, &realWorkSize, 0, primme), -1);
 
+   if (primme->projectionParams.pipeline) {
+      CHKERR(update_projection_pipelined_Sprimme(NULL, 0, NULL, 0, NULL, 0, 0,
+               primme->maxBasisSize, primme->maxBlockSize, NULL, NULL,
+               &realWorkSize, primme), -1);
+   }
+
    CHKERR(prepare_candidates_Sprimme(NULL, 0, NULL, 0, primme->nLocal, NULL, 0,
             primme->maxBasisSize, NULL, NULL, NULL, 0, NULL, NULL, NULL,
             primme->numEvals, NULL, 0, primme->maxBlockSize,
-            NULL, primme->numEvals, 0, NULL, NULL, 0, 0.0, NULL,
+            2*primme->maxBlockSize, NULL, NULL, primme->numEvals, 0, NULL, NULL, 0, 0.0, NULL,
             &primme->maxBlockSize, NULL, NULL, NULL, NULL, 0, 0, NULL, NULL,
             NULL, &realWorkSize, &intWorkSize, 0, primme), -1);
 
@@ -394,7 +418,7 @@ static int allocate_workspace(primme_params *primme, int allocate) {
    doubleSize += 4     /* padding cause by TO_REAL aligning them to SCALAR */
       + primme->maxBasisSize                       /* Size of hVals        */
       + primme->numEvals+primme->maxBasisSize      /* Size of prevRitzVals */
-      + primme->maxBlockSize                       /* Size of blockNorms   */
+      + 2*primme->maxBlockSize                     /* Size of blockNorms   */
       + primme->maxBasisSize;                      /* Size of basisNorms   */
 
    /*----------------------------------------------------------------------*/
@@ -402,7 +426,9 @@ static int allocate_workspace(primme_params *primme, int allocate) {
    /*----------------------------------------------------------------------*/
 
    intWorkSize += primme->maxBasisSize /* Size of flag               */
-      + 2*primme->maxBlockSize         /* Size of iev and ilev       */
+      + 3*primme->maxBlockSize         /* Size of iev (twice the     */
+                                       /* block, see prepare_        */
+                                       /* candidates) and ilev       */
       + maxEvecsSize;                  /* Size of ipivot             */
    if (primme->locking) {
       intWorkSize += primme->numEvals; /* Size of lockedFlags        */
@@ -683,6 +709,16 @@ static void default_monitor(void *basisEvals_, int *basisSize, int *basisFlags,
                   (double)basisNorms[iblock[0]]);
          }
         break;
+      case primme_event_restart:
+         assert(basisSize && numConverged);
+         if (primme->printLevel >= 3) {
+            fprintf(primme->outputFile,
+                  "RES MV %" PRIMME_INT_P " Sec %E basis %d conv %d maxBlockSize %d minRestartSize %d bytes %" PRIMME_INT_P "\n",
+                  primme->stats.numMatvecs, primme_wTimer(0), *basisSize,
+                  *numConverged, primme->maxBlockSize,
+                  primme->minRestartSize, primme->stats.volumeRestart);
+         }
+         break;
       case primme_event_converged:
          assert(numConverged && iblock && basisEvals && basisNorms);
          if ((!primme->locking && primme->printLevel >= 2)
@@ -709,3 +745,86 @@ static void default_monitor(void *basisEvals_, int *basisSize, int *basisFlags,
    }
    *err = 0;
 }
+
+
+/*******************************************************************************
+ * Subroutine stream_monitor - push a primme_monitor_record into
+ *    primme->monitorStream for every event, and for every pair in the block
+ *    at outer iterations. It is the default monitor if monitorStream is set.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * See default_monitor
+ *
+ * OUTPUT
+ * ------
+ * err          Error code
+ * 
+ ******************************************************************************/
+
+static void stream_monitor(void *basisEvals_, int *basisSize, int *basisFlags,
+      int *iblock, int *blockSize, void *basisNorms_, int *numConverged,
+      void *lockedEvals_, int *numLocked, int *lockedFlags, void *lockedNorms_,
+      int *inner_its, void *LSRes_, primme_event *event, primme_params *primme,
+      int *err)
+{
+   REAL *basisEvals = (REAL*)basisEvals_, *basisNorms = (REAL*)basisNorms_,
+        *lockedEvals = (REAL*)lockedEvals_, *lockedNorms = (REAL*)lockedNorms_,
+        *LSRes = (REAL*)LSRes_;
+   primme_monitor_record r;
+   int i;
+   assert(event != NULL && primme != NULL);
+   (void)basisSize; (void)basisFlags; (void)lockedFlags;
+
+   *err = 0;
+
+   /* Only report if this is proc zero */
+   if (primme->procID != 0) return;
+
+   r.time = primme_wTimer(0);
+   r.value = r.resNorm = r.LSRes = 0.0;
+   r.numMatvecs = primme->stats.numMatvecs;
+   r.numOuterIterations = primme->stats.numOuterIterations;
+   r.event = (int)*event;
+   r.index = 0;
+   r.numConverged = numConverged ? *numConverged : 0;
+   r.stage = 0;
+
+   switch(*event) {
+   case primme_event_outer_iteration:
+      assert(basisEvals && iblock && blockSize && basisNorms);
+      for (i=0; i < *blockSize; i++) {
+         r.index = i;
+         r.value = basisEvals[iblock[i]];
+         r.resNorm = basisNorms[iblock[i]];
+         primme_monitor_stream_push(primme->monitorStream, &r);
+      }
+      return;
+   case primme_event_inner_iteration:
+      assert(basisEvals && iblock && basisNorms && inner_its && LSRes);
+      r.index = *inner_its;
+      r.value = basisEvals[iblock[0]];
+      r.resNorm = basisNorms[iblock[0]];
+      r.LSRes = *LSRes;
+      break;
+   case primme_event_restart:
+      assert(basisSize);
+      r.index = *basisSize;
+      break;
+   case primme_event_converged:
+      assert(iblock && basisEvals && basisNorms);
+      r.index = iblock[0];
+      r.value = basisEvals[iblock[0]];
+      r.resNorm = basisNorms[iblock[0]];
+      break;
+   case primme_event_locked:
+      assert(numLocked && lockedEvals && lockedNorms);
+      r.index = *numLocked-1;
+      r.value = lockedEvals[*numLocked-1];
+      r.resNorm = lockedNorms[*numLocked-1];
+      break;
+   default:
+      break;
+   }
+   primme_monitor_stream_push(primme->monitorStream, &r);
+}
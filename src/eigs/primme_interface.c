@@ -63,6 +63,8 @@
 
 void primme_initialize(primme_params *primme) {
 
+   int i;
+
    /* Essential parameters */
    primme->n                       = 0;
    primme->numEvals                = 1;
@@ -91,12 +93,15 @@ void primme_initialize(primme_params *primme) {
    primme->numOrthoConst           = 0;
 
    primme->projectionParams.projection = primme_proj_default;
+   primme->projectionParams.pipeline   = 0;
+   primme->projectionParams.redundantSolve = 0;
 
    primme->initBasisMode                       = primme_init_default;
 
    /* Eigensolver parameters (outer) */
    primme->locking                             = -1;
    primme->dynamicMethodSwitch                 = -1;
+   primme->dynamicSizes                        = 0;
    primme->maxBasisSize                        = 0;
    primme->minRestartSize                      = 0;
    primme->maxBlockSize                        = 0;
@@ -117,6 +122,8 @@ void primme_initialize(primme_params *primme) {
    primme->correctionParams.projectors.SkewX   = 0;
    primme->correctionParams.relTolBase         = 0;
    primme->correctionParams.convTest           = primme_adaptive_ETolerance;
+   primme->correctionParams.storagePrecision   = primme_storage_full;
+   primme->correctionParams.pipeline           = 0;
 
    /* Printing and reporting */
    primme->outputFile                          = stdout;
@@ -128,16 +135,28 @@ void primme_initialize(primme_params *primme) {
    primme->stats.numGlobalSum                  = 0;
    primme->stats.volumeGlobalSum               = 0;
    primme->stats.numOrthoInnerProds            = 0.0;
+   primme->stats.numInnerIterations            = 0;
+   primme->stats.numInnerGlobalSum             = 0;
+   primme->stats.volumeRestart                 = 0;
    primme->stats.elapsedTime                   = 0.0;
    primme->stats.timeMatvec                    = 0.0;
    primme->stats.timePrecond                   = 0.0;
    primme->stats.timeOrtho                     = 0.0;
    primme->stats.timeGlobalSum                 = 0.0;
+   primme->stats.timeSolveH                    = 0.0;
+   primme->stats.timeRestart                   = 0.0;
+   primme->stats.timeLocking                   = 0.0;
    primme->stats.estimateMinEVal               = -HUGE_VAL;
    primme->stats.estimateMaxEVal               = HUGE_VAL;
    primme->stats.estimateLargestSVal           = -HUGE_VAL;
    primme->stats.maxConvTol                    = 0.0;
    primme->stats.estimateResidualError         = 0.0;
+   primme->stats.hwCounters                    = 0;
+   for (i=0; i<PRIMME_NUM_PHASES; i++) {
+      primme->stats.hwCycles[i]                = 0.0;
+      primme->stats.hwInstructions[i]          = 0.0;
+      primme->stats.hwCacheMisses[i]           = 0.0;
+   }
 
    /* Optional user defined structures */
    primme->matrix                  = NULL;
@@ -158,6 +177,8 @@ void primme_initialize(primme_params *primme) {
    primme->ldOPs                   = 0;
    primme->monitorFun              = NULL;
    primme->monitor                 = NULL;
+   primme->monitorStream           = NULL;
+   primme->convTestBlockFun        = NULL;
 }
 
 /*******************************************************************************
@@ -222,6 +243,7 @@ void primme_free(primme_params *primme) {
  *        STEEPEST_DESCENT,      : equiv. to GD(block,2*block)
  *        LOBPCG_OrthoBasis,       : equiv. to GD(nev,3*nev)+nev
  *        LOBPCG_OrthoBasis_Window : equiv. to GD(block,3*block)+block nev>block
+ *        GD_plusK_Pipelined       : GD+k with one reduction per block expansion
  *
  *
  * INPUT/OUTPUT
@@ -304,6 +326,20 @@ int primme_set_method(primme_preset_method method, primme_params *primme) {
       primme->correctionParams.projectors.RightX  = 0;
       primme->correctionParams.projectors.SkewX   = 0;
    }
+   else if (method == PRIMME_GD_plusK_Pipelined) {
+      if (primme->restartingParams.maxPrevRetain <= 0) {
+         if (primme->maxBlockSize == 1 && primme->numEvals > 1) {
+            primme->restartingParams.maxPrevRetain = 2;
+         }
+         else {
+            primme->restartingParams.maxPrevRetain = primme->maxBlockSize;
+         }
+      }
+      primme->correctionParams.maxInnerIterations = 0;
+      primme->correctionParams.projectors.RightX  = 0;
+      primme->correctionParams.projectors.SkewX   = 0;
+      primme->projectionParams.pipeline           = 1;
+   }
    else if (method == PRIMME_GD_Olsen_plusK) {
       if (primme->restartingParams.maxPrevRetain <= 0) {
          if (primme->maxBlockSize == 1 && primme->numEvals > 1) {
@@ -624,6 +660,8 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    PRINTParamsIF(projection, projection, primme_proj_RR);
    PRINTParamsIF(projection, projection, primme_proj_harmonic);
    PRINTParamsIF(projection, projection, primme_proj_refined);
+   PRINTParams(projection, pipeline, %d);
+   PRINTParams(projection, redundantSolve, %d);
 
    PRINTIF(initBasisMode, primme_init_default);
    PRINTIF(initBasisMode, primme_init_krylov);
@@ -640,6 +678,7 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    }
 
    PRINT(dynamicMethodSwitch, %d);
+   PRINT(dynamicSizes, %d);
    PRINT(locking, %d);
    PRINT(initSize, %d);
    PRINT(numOrthoConst, %d);
@@ -668,6 +707,11 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    PRINTParamsIF(correction, convTest, primme_adaptive_ETolerance);
    PRINTParamsIF(correction, convTest, primme_adaptive);
 
+   PRINTParamsIF(correction, storagePrecision, primme_storage_full);
+   PRINTParamsIF(correction, storagePrecision, primme_storage_bf16);
+   PRINTParamsIF(correction, storagePrecision, primme_storage_fp16);
+   PRINTParams(correction, pipeline, %d);
+
    fprintf(outputFile, "\n// projectors for JD cor.eq.\n");
    PRINTParams(correction, projectors.LeftQ , %d);
    PRINTParams(correction, projectors.LeftX , %d);
@@ -675,6 +719,45 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    PRINTParams(correction, projectors.SkewQ , %d);
    PRINTParams(correction, projectors.RightX, %d);
    PRINTParams(correction, projectors.SkewX , %d);
+
+   if (primme.printLevel >= 3) {
+      static const char *phases[PRIMME_NUM_PHASES] = {"matvec", "precond",
+         "ortho", "globalSum", "solveH", "restart", "locking"};
+      double times[PRIMME_NUM_PHASES];
+
+      times[primme_phase_matvec] = primme.stats.timeMatvec;
+      times[primme_phase_precond] = primme.stats.timePrecond;
+      times[primme_phase_ortho] = primme.stats.timeOrtho;
+      times[primme_phase_globalSum] = primme.stats.timeGlobalSum;
+      times[primme_phase_solveH] = primme.stats.timeSolveH;
+      times[primme_phase_restart] = primme.stats.timeRestart;
+      times[primme_phase_locking] = primme.stats.timeLocking;
+
+      fprintf(outputFile, "\n// Statistics\n");
+      PRINT_PRIMME_INT(stats.numGlobalSum);
+      PRINT_PRIMME_INT(stats.numInnerIterations);
+      PRINT_PRIMME_INT(stats.numInnerGlobalSum);
+      PRINT_PRIMME_INT(stats.volumeRestart);
+      fprintf(outputFile, "%s.stats.hwCounters = %d\n", prefix,
+            primme.stats.hwCounters);
+      for (i=0; i<PRIMME_NUM_PHASES; i++) {
+         fprintf(outputFile, "%s.stats.%-9s time %e", prefix, phases[i],
+               times[i]);
+         if (primme.stats.hwCounters) {
+            /* Bandwidth assumes that every miss moves a 64 bytes line */
+            fprintf(outputFile, " cycles %e instr %e IPC %.2f misses %e"
+                  " GB/s %.2f", primme.stats.hwCycles[i],
+                  primme.stats.hwInstructions[i],
+                  primme.stats.hwCycles[i] > 0.0 ?
+                     primme.stats.hwInstructions[i]/primme.stats.hwCycles[i]
+                     : 0.0,
+                  primme.stats.hwCacheMisses[i],
+                  times[i] > 0.0 ?
+                     primme.stats.hwCacheMisses[i]*64.0/times[i]/1e9 : 0.0);
+         }
+         fprintf(outputFile, "\n");
+      }
+   }
    fprintf(outputFile, "// ---------------------------------------------------\n");
 
 #undef PRINT
@@ -711,6 +794,7 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       void *ptr_v;
       void (*globalSumRealFunc_v) (void *,void *,int *,struct primme_params *,int*);
       void (*convTestFun_v)(double *,void*,double*,int*,struct primme_params*,int*);
+      void (*convTestBlockFun_v)(double *,void*,PRIMME_INT*,double*,int*,int*,struct primme_params*,int*);
       primme_target target_v;
       double double_v;
       FILE *file_v;
@@ -718,6 +802,7 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       primme_projection projection_v;
       primme_restartscheme restartscheme_v;
       primme_convergencetest convergencetest_v;
+      primme_storage_precision storageprecision_v;
       void (*monitorFun_v)(void *basisEvals, int *basisSize, int *basisFlags,
             int *iblock, int *blockSize, void *basisNorms, int *numConverged,
             void *lockedEvals, int *numLocked, int *lockedFlags, void *lockedNorms,
@@ -779,6 +864,9 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_dynamicMethodSwitch:
               v->int_v = primme->dynamicMethodSwitch;
       break;
+      case PRIMME_dynamicSizes:
+              v->int_v = primme->dynamicSizes;
+      break;
       case PRIMME_maxBasisSize:
               v->int_v = primme->maxBasisSize;
       break;
@@ -829,6 +917,12 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_preconditioner:
               v->ptr_v = primme->preconditioner;
       break;
+      case PRIMME_projectionParams_pipeline:
+              v->int_v = primme->projectionParams.pipeline;
+      break;
+      case PRIMME_projectionParams_redundantSolve:
+              v->int_v = primme->projectionParams.redundantSolve;
+      break;
       case PRIMME_restartingParams_scheme:
               v->restartscheme_v = primme->restartingParams.scheme;
       break;
@@ -868,6 +962,12 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_correctionParams_relTolBase:
               v->double_v = primme->correctionParams.relTolBase;
       break;
+      case PRIMME_correctionParams_storagePrecision:
+              v->storageprecision_v = primme->correctionParams.storagePrecision;
+      break;
+      case PRIMME_correctionParams_pipeline:
+              v->int_v = primme->correctionParams.pipeline;
+      break;
       case PRIMME_stats_numOuterIterations:
               v->int_v = primme->stats.numOuterIterations;
       break;
@@ -889,6 +989,15 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_stats_numOrthoInnerProds:
               v->double_v = primme->stats.numOrthoInnerProds;
       break;
+      case PRIMME_stats_numInnerIterations:
+              v->int_v = primme->stats.numInnerIterations;
+      break;
+      case PRIMME_stats_numInnerGlobalSum:
+              v->int_v = primme->stats.numInnerGlobalSum;
+      break;
+      case PRIMME_stats_volumeRestart:
+              v->int_v = primme->stats.volumeRestart;
+      break;
       case PRIMME_stats_elapsedTime:
               v->double_v = primme->stats.elapsedTime;
       break;
@@ -904,6 +1013,33 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_stats_timeGlobalSum:
               v->double_v = primme->stats.timeGlobalSum;
       break;
+      case PRIMME_stats_timeSolveH:
+              v->double_v = primme->stats.timeSolveH;
+      break;
+      case PRIMME_stats_timeRestart:
+              v->double_v = primme->stats.timeRestart;
+      break;
+      case PRIMME_stats_timeLocking:
+              v->double_v = primme->stats.timeLocking;
+      break;
+      case PRIMME_stats_hwCounters:
+              v->int_v = primme->stats.hwCounters;
+      break;
+      case PRIMME_stats_hwCycles:
+         for (i=0; i< PRIMME_NUM_PHASES; i++) {
+            (&v->double_v)[i] = primme->stats.hwCycles[i];
+         }
+      break;
+      case PRIMME_stats_hwInstructions:
+         for (i=0; i< PRIMME_NUM_PHASES; i++) {
+            (&v->double_v)[i] = primme->stats.hwInstructions[i];
+         }
+      break;
+      case PRIMME_stats_hwCacheMisses:
+         for (i=0; i< PRIMME_NUM_PHASES; i++) {
+            (&v->double_v)[i] = primme->stats.hwCacheMisses[i];
+         }
+      break;
       case PRIMME_stats_estimateMinEVal:
               v->double_v = primme->stats.estimateMinEVal;
       break;
@@ -925,6 +1061,12 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_monitor:
               v->ptr_v = primme->monitor;
       break;
+      case PRIMME_monitorStream:
+              v->ptr_v = primme->monitorStream;
+      break;
+      case PRIMME_convTestBlockFun:
+              v->convTestBlockFun_v = primme->convTestBlockFun;
+      break;
       default :
       return 1;
    }
@@ -959,6 +1101,7 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       void *ptr_v;
       void (*globalSumRealFunc_v) (void *,void *,int *,struct primme_params *,int*);
       void (*convTestFun_v)(double *,void*,double*,int*,struct primme_params*,int*);
+      void (*convTestBlockFun_v)(double *,void*,PRIMME_INT*,double*,int*,int*,struct primme_params*,int*);
       primme_target *target_v;
       double *double_v;
       FILE *file_v;
@@ -966,6 +1109,7 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       primme_projection *projection_v;
       primme_restartscheme *restartscheme_v;
       primme_convergencetest *convergencetest_v;
+      primme_storage_precision *storageprecision_v;
       void (*monitorFun_v)(void *basisEvals, int *basisSize, int *basisFlags,
             int *iblock, int *blockSize, void *basisNorms, int *numConverged,
             void *lockedEvals, int *numLocked, int *lockedFlags, void *lockedNorms,
@@ -1033,6 +1177,10 @@ int primme_set_member(primme_params *primme, primme_params_label label,
               if (*v.int_v > INT_MAX) return 1; else 
               primme->dynamicMethodSwitch = (int)*v.int_v;
       break;
+      case PRIMME_dynamicSizes:
+              if (*v.int_v > INT_MAX) return 1; else 
+              primme->dynamicSizes = (int)*v.int_v;
+      break;
       case PRIMME_maxBasisSize:
               if (*v.int_v > INT_MAX) return 1; else 
               primme->maxBasisSize = (int)*v.int_v;
@@ -1094,6 +1242,14 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_projectionParams_projection:
               primme->projectionParams.projection = *v.projection_v;
       break;
+      case PRIMME_projectionParams_pipeline:
+              if (*v.int_v > INT_MAX) return 1; else 
+              primme->projectionParams.pipeline = (int)*v.int_v;
+      break;
+      case PRIMME_projectionParams_redundantSolve:
+              if (*v.int_v > INT_MAX) return 1; else 
+              primme->projectionParams.redundantSolve = (int)*v.int_v;
+      break;
       case PRIMME_restartingParams_scheme:
               primme->restartingParams.scheme = *v.restartscheme_v;
       break;
@@ -1143,6 +1299,14 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_correctionParams_relTolBase:
               primme->correctionParams.relTolBase = *v.double_v;
       break;
+      case PRIMME_correctionParams_storagePrecision:
+              primme->correctionParams.storagePrecision =
+                 *v.storageprecision_v;
+      break;
+      case PRIMME_correctionParams_pipeline:
+              if (*v.int_v > INT_MAX) return 1; else 
+              primme->correctionParams.pipeline = (int)*v.int_v;
+      break;
       case PRIMME_stats_numOuterIterations:
               primme->stats.numOuterIterations = *v.int_v;
       break;
@@ -1161,6 +1325,15 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_stats_numOrthoInnerProds:
               primme->stats.numOrthoInnerProds = *v.double_v;
       break;
+      case PRIMME_stats_numInnerIterations:
+              primme->stats.numInnerIterations = *v.int_v;
+      break;
+      case PRIMME_stats_numInnerGlobalSum:
+              primme->stats.numInnerGlobalSum = *v.int_v;
+      break;
+      case PRIMME_stats_volumeRestart:
+              primme->stats.volumeRestart = *v.int_v;
+      break;
       case PRIMME_stats_elapsedTime:
               primme->stats.elapsedTime = *v.double_v;
       break;
@@ -1176,6 +1349,34 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_stats_timeGlobalSum:
               primme->stats.timeGlobalSum = *v.double_v;
       break;
+      case PRIMME_stats_timeSolveH:
+              primme->stats.timeSolveH = *v.double_v;
+      break;
+      case PRIMME_stats_timeRestart:
+              primme->stats.timeRestart = *v.double_v;
+      break;
+      case PRIMME_stats_timeLocking:
+              primme->stats.timeLocking = *v.double_v;
+      break;
+      case PRIMME_stats_hwCounters:
+              if (*v.int_v > INT_MAX) return 1; else 
+              primme->stats.hwCounters = (int)*v.int_v;
+      break;
+      case PRIMME_stats_hwCycles:
+         for (i=0; i< PRIMME_NUM_PHASES; i++) {
+            primme->stats.hwCycles[i] = v.double_v[i];
+         }
+      break;
+      case PRIMME_stats_hwInstructions:
+         for (i=0; i< PRIMME_NUM_PHASES; i++) {
+            primme->stats.hwInstructions[i] = v.double_v[i];
+         }
+      break;
+      case PRIMME_stats_hwCacheMisses:
+         for (i=0; i< PRIMME_NUM_PHASES; i++) {
+            primme->stats.hwCacheMisses[i] = v.double_v[i];
+         }
+      break;
       case PRIMME_stats_estimateMinEVal:
               primme->stats.estimateMinEVal = *v.double_v;
       break;
@@ -1203,6 +1404,12 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_monitor:
               primme->monitor = v.ptr_v;
       break;
+      case PRIMME_monitorStream:
+              primme->monitorStream = (primme_monitor_stream*)v.ptr_v;
+      break;
+      case PRIMME_convTestBlockFun:
+              primme->convTestBlockFun = v.convTestBlockFun_v;
+      break;
       default : 
       return 1;
    }
@@ -1266,6 +1473,7 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
    IF_IS(initSize                     , initSize);
    IF_IS(numOrthoConst                , numOrthoConst);
    IF_IS(dynamicMethodSwitch          , dynamicMethodSwitch);
+   IF_IS(dynamicSizes                 , dynamicSizes);
    IF_IS(maxBasisSize                 , maxBasisSize);
    IF_IS(minRestartSize               , minRestartSize);
    IF_IS(maxBlockSize                 , maxBlockSize);
@@ -1284,6 +1492,8 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
    IF_IS(preconditioner               , preconditioner);
    IF_IS(initBasisMode                , initBasisMode);
    IF_IS(projection_projection        , projectionParams_projection);
+   IF_IS(projection_pipeline          , projectionParams_pipeline);
+   IF_IS(projection_redundantSolve    , projectionParams_redundantSolve);
    IF_IS(restarting_scheme            , restartingParams_scheme);
    IF_IS(restarting_maxPrevRetain     , restartingParams_maxPrevRetain);
    IF_IS(correction_precondition      , correctionParams_precondition);
@@ -1297,6 +1507,8 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
    IF_IS(correction_projectors_SkewX  , correctionParams_projectors_SkewX);
    IF_IS(correction_convTest          , correctionParams_convTest);
    IF_IS(correction_relTolBase        , correctionParams_relTolBase);
+   IF_IS(correction_storagePrecision  , correctionParams_storagePrecision);
+   IF_IS(correction_pipeline          , correctionParams_pipeline);
    IF_IS(stats_numOuterIterations     , stats_numOuterIterations);
    IF_IS(stats_numRestarts            , stats_numRestarts);
    IF_IS(stats_numMatvecs             , stats_numMatvecs);
@@ -1304,11 +1516,21 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
    IF_IS(stats_numGlobalSum           , stats_numGlobalSum);
    IF_IS(stats_volumeGlobalSum        , stats_volumeGlobalSum);
    IF_IS(stats_numOrthoInnerProds     , stats_numOrthoInnerProds);
+   IF_IS(stats_numInnerIterations     , stats_numInnerIterations);
+   IF_IS(stats_numInnerGlobalSum      , stats_numInnerGlobalSum);
+   IF_IS(stats_volumeRestart          , stats_volumeRestart);
    IF_IS(stats_elapsedTime            , stats_elapsedTime);
    IF_IS(stats_timeMatvec             , stats_timeMatvec);
    IF_IS(stats_timePrecond            , stats_timePrecond);
    IF_IS(stats_timeOrtho              , stats_timeOrtho);
    IF_IS(stats_timeGlobalSum          , stats_timeGlobalSum);
+   IF_IS(stats_timeSolveH             , stats_timeSolveH);
+   IF_IS(stats_timeRestart            , stats_timeRestart);
+   IF_IS(stats_timeLocking            , stats_timeLocking);
+   IF_IS(stats_hwCounters             , stats_hwCounters);
+   IF_IS(stats_hwCycles               , stats_hwCycles);
+   IF_IS(stats_hwInstructions         , stats_hwInstructions);
+   IF_IS(stats_hwCacheMisses          , stats_hwCacheMisses);
    IF_IS(stats_estimateMinEVal        , stats_estimateMinEVal);
    IF_IS(stats_estimateMaxEVal        , stats_estimateMaxEVal);
    IF_IS(stats_estimateLargestSVal    , stats_estimateLargestSVal);
@@ -1318,6 +1540,8 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
    IF_IS(ldOPs                        , ldOPs);
    IF_IS(monitorFun                   , monitorFun);
    IF_IS(monitor                      , monitor);
+   IF_IS(monitorStream                , monitorStream);
+   IF_IS(convTestBlockFun             , convTestBlockFun);
 #undef IF_IS
 
    /* Return label/label_name */
@@ -1337,6 +1561,7 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
       case PRIMME_initSize:
       case PRIMME_numOrthoConst:
       case PRIMME_dynamicMethodSwitch:
+      case PRIMME_dynamicSizes:
       case PRIMME_maxBasisSize:
       case PRIMME_minRestartSize:
       case PRIMME_maxBlockSize:
@@ -1344,6 +1569,8 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
       case PRIMME_maxOuterIterations:
       case PRIMME_initBasisMode:
       case PRIMME_projectionParams_projection:
+      case PRIMME_projectionParams_pipeline:
+      case PRIMME_projectionParams_redundantSolve:
       case PRIMME_restartingParams_scheme:
       case PRIMME_restartingParams_maxPrevRetain:
       case PRIMME_correctionParams_precondition:
@@ -1356,12 +1583,18 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
       case PRIMME_correctionParams_projectors_SkewQ:
       case PRIMME_correctionParams_projectors_SkewX:
       case PRIMME_correctionParams_convTest:
+      case PRIMME_correctionParams_storagePrecision:
+      case PRIMME_correctionParams_pipeline:
       case PRIMME_stats_numOuterIterations:
       case PRIMME_stats_numRestarts:
       case PRIMME_stats_numMatvecs:
       case PRIMME_stats_numPreconds:
       case PRIMME_stats_numGlobalSum:
       case PRIMME_stats_volumeGlobalSum:
+      case PRIMME_stats_numInnerIterations:
+      case PRIMME_stats_numInnerGlobalSum:
+      case PRIMME_stats_volumeRestart:
+      case PRIMME_stats_hwCounters:
       case PRIMME_numProcs:
       case PRIMME_procID:
       case PRIMME_nLocal:
@@ -1380,6 +1613,13 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
       if (arity) *arity = 4;
       break;
 
+      case PRIMME_stats_hwCycles:
+      case PRIMME_stats_hwInstructions:
+      case PRIMME_stats_hwCacheMisses:
+      if (type) *type = primme_double;
+      if (arity) *arity = PRIMME_NUM_PHASES;
+      break;
+
       /* members with type double */
 
       case PRIMME_aNorm:
@@ -1390,6 +1630,9 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
       case PRIMME_stats_timePrecond:
       case PRIMME_stats_timeOrtho:
       case PRIMME_stats_timeGlobalSum:
+      case PRIMME_stats_timeSolveH:
+      case PRIMME_stats_timeRestart:
+      case PRIMME_stats_timeLocking:
       case PRIMME_stats_elapsedTime:
       case PRIMME_stats_estimateMinEVal:
       case PRIMME_stats_estimateMaxEVal:
@@ -1419,6 +1662,8 @@ int primme_member_info(primme_params_label *label_, const char** label_name_,
       case PRIMME_convTestFun:
       case PRIMME_monitorFun:
       case PRIMME_monitor:
+      case PRIMME_monitorStream:
+      case PRIMME_convTestBlockFun:
       if (type) *type = primme_pointer;
       if (arity) *arity = 1;
       break;
@@ -1469,6 +1714,7 @@ int primme_constant_info(const char* label_name, int *value) {
    IF_IS(PRIMME_STEEPEST_DESCENT);
    IF_IS(PRIMME_LOBPCG_OrthoBasis);
    IF_IS(PRIMME_LOBPCG_OrthoBasis_Window);
+   IF_IS(PRIMME_GD_plusK_Pipelined);
    
    /* enum members for targeting; restarting and innertest */
    
@@ -1492,6 +1738,9 @@ int primme_constant_info(const char* label_name, int *value) {
    IF_IS(primme_decreasing_LTolerance);
    IF_IS(primme_adaptive_ETolerance);
    IF_IS(primme_adaptive);
+   IF_IS(primme_storage_full);
+   IF_IS(primme_storage_bf16);
+   IF_IS(primme_storage_fp16);
 
    /* enum member for event */
 
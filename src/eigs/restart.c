@@ -48,6 +48,7 @@
 #include "update_W.h"
 #include "convergence.h"
 #include "globalsum.h"
+#include "wtime.h"
 
 static int restart_soft_locking_Sprimme(int *restartSize, SCALAR *V,
        SCALAR *W, PRIMME_INT nLocal, int basisSize, PRIMME_INT ldV, SCALAR **X,
@@ -269,6 +270,7 @@ int restart_Sprimme(SCALAR *V, SCALAR *W, PRIMME_INT nLocal, int basisSize,
    int *hVecsPerm;          /* Permutation of hVecs to sort as primme.target */
    int indexOfPreviousVecsBeforeRestart=0;/* descriptive enough name, isn't? */
    double aNorm = primme?max(primme->aNorm, primme->stats.estimateLargestSVal):0.0;
+   double t0[1+PRIMME_PERF_NUM];
 
    /* Return memory requirement */
 
@@ -306,6 +308,8 @@ int restart_Sprimme(SCALAR *V, SCALAR *W, PRIMME_INT nLocal, int basisSize,
       return 0;
    }
 
+   phaseBegin_Sprimme(t0, primme);
+
    /* ----------------------------------------------------------- */
    /* Remove the SKIP_UNTIL_RESTART flags.                        */
    /* ----------------------------------------------------------- */
@@ -512,6 +516,8 @@ int restart_Sprimme(SCALAR *V, SCALAR *W, PRIMME_INT nLocal, int basisSize,
 
    *restartSizeOutput = restartSize; 
 
+   phaseEnd_Sprimme(t0, primme_phase_restart, primme);
+
    return 0;
 }
 
@@ -880,6 +886,8 @@ static int restart_soft_locking_Sprimme(int *restartSize, SCALAR *V,
  *    rnorms = norms(Wo(nrb+1-nWob:nre-nWob) - X0(nrb+1-nX0b:nre-nX0b)*diag(hVals(nrb+1:nre))),
  *
  * NOTE: if Rnorms and rnorms are requested, nRb-nRe+nrb-nre < mV
+ * NOTE: X0 and Wo may be V and W; the update is done in place a block of rows
+ *       at a time, so rwork only needs the rows of the block
  *
  * INPUT ARRAYS AND PARAMETERS
  * ---------------------------
@@ -944,6 +952,14 @@ int Num_reset_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, PRIMME_INT mV,
       return 0;
    }
 
+   /* Count the bytes of V and W read and the bytes of the outputs written */
+
+   primme->stats.volumeRestart += (PRIMME_INT)sizeof(SCALAR)*mV*(
+         (W && reset == 0 ? 2 : 1)*nV
+         + (X0 ? nX0e-nX0b : 0) + (X1 ? nX1e-nX1b : 0)
+         + (evecs ? nX2e-nX2b : 0) + (Wo ? nWoe-nWob : 0)
+         + (R ? nRe-nRb : 0));
+
    /* Quick exit */
    if (reset == 0) {
       CHKERR(Num_update_VWXR_Sprimme(
@@ -1762,6 +1778,8 @@ static int restart_refined(SCALAR *V, PRIMME_INT ldV, SCALAR *W, PRIMME_INT ldW,
    /* Restart Q by replacing it with Q*hU */
    /* ----------------------------------- */
 
+   primme->stats.volumeRestart += (PRIMME_INT)sizeof(SCALAR)*nLocal*(
+         basisSize + restartSize);
    CHKERR(Num_update_VWXR_Sprimme(Q, NULL, nLocal, basisSize, ldQ, hU,
             restartSize,
             basisSize, NULL,
@@ -2205,6 +2223,9 @@ static int ortho_coefficient_vectors_Sprimme(SCALAR *hVecs, int basisSize,
    int i;
    SCALAR *rwork0;
    int newNumPrevRetained=0;
+   /* If the user asserts that LAPACK/BLAS give bitwise the same results in */
+   /* every process, all of them orthogonalize hVecs, and skip the broadcast */
+   int redundant = primme->projectionParams.redundantSolve == 1;
 
    /* Return memory requirement */
 
@@ -2232,7 +2253,7 @@ static int ortho_coefficient_vectors_Sprimme(SCALAR *hVecs, int basisSize,
 
    }
 
-   if (primme->procID == 0) {
+   if (primme->procID == 0 || redundant) {
       /* Avoid that ortho replaces linear dependent vectors by random vectors.*/
       /* The random vectors make the restarting W with large singular value.  */
       /* This change has shown benefit finding the smallest singular values.  */
@@ -2256,6 +2277,11 @@ static int ortho_coefficient_vectors_Sprimme(SCALAR *hVecs, int basisSize,
       newNumPrevRetained = i;
    }
 
+   if (redundant) {
+      *numPrevRetained = newNumPrevRetained;
+      return 0;
+   }
+
    /* Broadcast hVecs(indexOfPreviousVecs:indexOfPreviousVecs+numPrevRetained) */
 
    if (primme->procID == 0) {
@@ -40,6 +40,8 @@
 #include "solve_projection.h"
 #include "ortho.h"
 #include "globalsum.h"
+#include "auxiliary_eigs.h"
+#include "wtime.h"
 
 static int solve_H_RR_Sprimme(SCALAR *H, int ldH, SCALAR *hVecs,
    int ldhVecs, REAL *hVals, int basisSize, int numConverged, size_t *lrwork,
@@ -60,6 +62,9 @@ static int solve_H_brcast_Sprimme(int basisSize, SCALAR *hU, int ldhU,
       SCALAR *hVecs, int ldhVecs, REAL *hVals, REAL *hSVals, size_t *lrwork,
       SCALAR *rwork, primme_params *primme);
 
+static int heev_jacobi_Sprimme(int n, SCALAR *A, int ldA, SCALAR *V, int ldV,
+      REAL *w);
+
 
 /*******************************************************************************
  * Subroutine solve_H - This procedure solves the project problem and return
@@ -103,12 +108,23 @@ int solve_H_Sprimme(SCALAR *H, int basisSize, int ldH, SCALAR *R, int ldR,
    SCALAR *rwork, int liwork, int *iwork, primme_params *primme) {
 
    int i;
+   int redundant;    /* if nonzero, every process solves the problem */
+   double t0[1+PRIMME_PERF_NUM];
+
+   phaseBegin_Sprimme(t0, primme);
 
    /* In parallel (especially with heterogeneous processors/libraries) ensure */
    /* that every process has the same hVecs and hU. Only processor 0 solves   */
-   /* the projected problem and broadcasts the resulting matrices to the rest */
+   /* the projected problem and broadcasts the resulting matrices to the rest,*/
+   /* unless the user asks every process to solve it and get bitwise the same */
+   /* result, either from LAPACK (redundantSolve == 1) or from the Jacobi     */
+   /* solver in heev_jacobi (redundantSolve == 2, only for RR).               */
 
-   if (primme->procID == 0) {
+   redundant = primme->projectionParams.redundantSolve == 1
+      || (primme->projectionParams.redundantSolve == 2
+            && primme->projectionParams.projection == primme_proj_RR);
+
+   if (primme->procID == 0 || redundant) {
       switch (primme->projectionParams.projection) {
          case primme_proj_RR:
             CHKERR(solve_H_RR_Sprimme(H, ldH, hVecs, ldhVecs, hVals, basisSize,
@@ -134,8 +150,10 @@ int solve_H_Sprimme(SCALAR *H, int basisSize, int ldH, SCALAR *R, int ldR,
 
    /* Broadcast hVecs, hU, hVals, hSVals */
 
-   CHKERR(solve_H_brcast_Sprimme(basisSize, hU, ldhU, hVecs, ldhVecs, hVals,
-            hSVals, lrwork, rwork, primme), -1);
+   if (!redundant) {
+      CHKERR(solve_H_brcast_Sprimme(basisSize, hU, ldhU, hVecs, ldhVecs, hVals,
+               hSVals, lrwork, rwork, primme), -1);
+   }
  
    /* Return memory requirements */
 
@@ -143,6 +161,8 @@ int solve_H_Sprimme(SCALAR *H, int basisSize, int ldH, SCALAR *R, int ldR,
       return 0;
    }
 
+   phaseEnd_Sprimme(t0, primme_phase_solveH, primme);
+
    /* -------------------------------------------------------- */
    /* Update the leftmost and rightmost Ritz values ever seen  */
    /* -------------------------------------------------------- */
@@ -196,6 +216,8 @@ static int solve_H_RR_Sprimme(SCALAR *H, int ldH, SCALAR *hVecs,
    int index;
    int *permu, *permw;
    double targetShift;
+   int jacobi = primme->projectionParams.redundantSolve == 2
+      && primme->projectionParams.projection == primme_proj_RR;
 
    /* Some LAPACK implementations don't like zero-size matrices */
    if (basisSize == 0) return 0;
@@ -203,6 +225,10 @@ static int solve_H_RR_Sprimme(SCALAR *H, int ldH, SCALAR *hVecs,
    /* Return memory requirements */
    if (H == NULL) {
       SCALAR rwork0;
+      if (jacobi) {
+         *lrwork = max(*lrwork, (size_t)basisSize*basisSize);
+         return 0;
+      }
       CHKERR((Num_heev_Sprimme("V", "U", basisSize, hVecs, basisSize, hVals,
                &rwork0, -1, &info), info), -1);
       *lrwork = max(*lrwork, (size_t)REAL_PART(rwork0));
@@ -239,8 +265,25 @@ static int solve_H_RR_Sprimme(SCALAR *H, int ldH, SCALAR *hVecs,
       }
    }
 
-   CHKERR((Num_heev_Sprimme("V", "U", basisSize, hVecs, ldhVecs, hVals, rwork, 
-                TO_INT(*lrwork), &info), info), -1);
+   if (jacobi) {
+      /* Expand the Hermitian matrix in hVecs into rwork and overwrite hVecs */
+      /* with the eigenvectors                                               */
+
+      assert(*lrwork >= (size_t)basisSize*basisSize);
+      for (j=0; j < basisSize; j++) {
+         for (i=0; i < j; i++) {
+            rwork[basisSize*j+i] = hVecs[ldhVecs*j+i];
+            rwork[basisSize*i+j] = CONJ(hVecs[ldhVecs*j+i]);
+         }
+         rwork[basisSize*j+j] = REAL_PART(hVecs[ldhVecs*j+j]);
+      }
+      CHKERR(heev_jacobi_Sprimme(basisSize, rwork, basisSize, hVecs, ldhVecs,
+               hVals), -1);
+   }
+   else {
+      CHKERR((Num_heev_Sprimme("V", "U", basisSize, hVecs, ldhVecs, hVals,
+                  rwork, TO_INT(*lrwork), &info), info), -1);
+   }
 
    /* ---------------------------------------------------------------------- */
    /* ORDER the eigenvalues and their eigenvectors according to the desired  */
@@ -969,3 +1012,109 @@ int prepare_vecs_Sprimme(int basisSize, int i0, int blockSize,
 
    return 0;
 }
+
+
+/*******************************************************************************
+ * Subroutine heev_jacobi - Computes all eigenpairs of a Hermitian matrix with
+ *    the cyclic Jacobi method. It uses plain loops in a fixed order and no
+ *    BLAS or LAPACK, so the result is bitwise the same in every process that
+ *    runs the same binary.
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * n              The dimension of A
+ * A              The full Hermitian matrix; it is overwritten
+ * ldA            The leading dimension of A
+ * V              The eigenvectors
+ * ldV            The leading dimension of V
+ * w              The eigenvalues in ascending order
+ *
+ * Return Value
+ * ------------
+ * int -  0 upon successful return
+ *     - -1 the method did not converge
+ ******************************************************************************/
+
+static int heev_jacobi_Sprimme(int n, SCALAR *A, int ldA, SCALAR *V, int ldV,
+      REAL *w) {
+
+   int i, j, k, p, q, sweep;
+   REAL off, nrm, g, app, aqq, theta, t, c, s;
+   SCALAR e, xp, xq;
+
+   Num_zero_matrix_Sprimme(V, n, n, ldV);
+   for (i=0; i<n; i++) V[ldV*i+i] = 1.0;
+
+   for (sweep=0; ; sweep++) {
+
+      /* Stop when the off-diagonal part is negligible */
+
+      for (j=0, off=0.0, nrm=0.0; j<n; j++) {
+         for (i=0; i<j; i++) {
+            g = ABS(A[ldA*j+i]);
+            off += g*g;
+         }
+         nrm += REAL_PART(A[ldA*j+j])*REAL_PART(A[ldA*j+j]);
+      }
+      nrm += 2.0*off;
+      if (off <= MACHINE_EPSILON*MACHINE_EPSILON*nrm) break;
+      if (sweep >= 100) return -1;
+
+      for (p=0; p<n-1; p++) {
+         for (q=p+1; q<n; q++) {
+            g = ABS(A[ldA*q+p]);
+            if (g == 0.0) continue;
+
+            /* Compute the rotation [c s*e; -s*conj(e) c], with e = A(p,q)/g, */
+            /* that annihilates A(p,q)                                        */
+
+            app = REAL_PART(A[ldA*p+p]);
+            aqq = REAL_PART(A[ldA*q+q]);
+            theta = (aqq - app)/(2.0*g);
+            t = (theta >= 0.0 ? 1.0 : -1.0)/(fabs(theta) + sqrt(theta*theta+1.0));
+            c = 1.0/sqrt(t*t + 1.0);
+            s = t*c;
+            e = A[ldA*q+p]/g;
+
+            /* A = A*J and V = V*J */
+
+            for (k=0; k<n; k++) {
+               xp = A[ldA*p+k], xq = CONJ(e)*A[ldA*q+k];
+               A[ldA*p+k] = c*xp - s*xq;
+               A[ldA*q+k] = s*xp + c*xq;
+               xp = V[ldV*p+k], xq = CONJ(e)*V[ldV*q+k];
+               V[ldV*p+k] = c*xp - s*xq;
+               V[ldV*q+k] = s*xp + c*xq;
+            }
+
+            /* A = J'*A */
+
+            for (k=0; k<n; k++) {
+               xp = A[ldA*k+p], xq = e*A[ldA*k+q];
+               A[ldA*k+p] = c*xp - s*xq;
+               A[ldA*k+q] = s*xp + c*xq;
+            }
+            A[ldA*q+p] = A[ldA*p+q] = 0.0;
+            A[ldA*p+p] = REAL_PART(A[ldA*p+p]);
+            A[ldA*q+q] = REAL_PART(A[ldA*q+q]);
+         }
+      }
+   }
+
+   /* Sort the eigenpairs in ascending order */
+
+   for (i=0; i<n; i++) w[i] = REAL_PART(A[ldA*i+i]);
+   for (i=0; i<n-1; i++) {
+      for (j=i, k=i+1; k<n; k++) {
+         if (w[k] < w[j]) j = k;
+      }
+      if (j != i) {
+         t = w[i]; w[i] = w[j]; w[j] = t;
+         for (k=0; k<n; k++) {
+            xp = V[ldV*i+k]; V[ldV*i+k] = V[ldV*j+k]; V[ldV*j+k] = xp;
+         }
+      }
+   }
+
+   return 0;
+}
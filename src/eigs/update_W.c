@@ -38,8 +38,8 @@
 #include "numerical.h"
 #include "update_W.h"
 #include "auxiliary_eigs.h"
-#include "ortho.h"
 #include "wtime.h"
+#include "ortho.h"
 
 
 /*******************************************************************************
@@ -66,14 +66,14 @@ int matrixMatvec_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       primme_params *primme) {
 
    int i, ONE=1, ierr=0;
-   double t0;
+   double t0[1+PRIMME_PERF_NUM];
 
    if (blockSize <= 0) return 0;
 
    assert(ldV >= nLocal && ldW >= nLocal);
    assert(primme->ldOPs == 0 || primme->ldOPs >= nLocal);
 
-   t0 = primme_wTimer(0);
+   phaseBegin_Sprimme(t0, primme);
 
    /* W(:,c) = A*V(:,c) for c = basisSize:basisSize+blockSize-1 */
    if (primme->ldOPs == 0 || (ldV == primme->ldOPs && ldW == primme->ldOPs)) {
@@ -90,7 +90,7 @@ int matrixMatvec_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       }
    }
 
-   primme->stats.timeMatvec += primme_wTimer(0) - t0;
+   phaseEnd_Sprimme(t0, primme_phase_matvec, primme);
    primme->stats.numMatvecs += blockSize;
 
    return ierr;
@@ -157,3 +157,172 @@ int update_projection_Sprimme(SCALAR *X, PRIMME_INT ldX, SCALAR *Y,
 
    return 0;
 }
+
+/*******************************************************************************
+ * Subroutine update_projection_pipelined - Orthogonalize the last blockSize
+ *    columns of V against the first numCols and among themselves, update the
+ *    same columns of W = A*V, and add blockSize columns and rows to H = V'*W,
+ *    all with a single global reduction.
+ *
+ *    On input V(:,numCols:m) holds the corrections T and W(:,numCols:m) holds
+ *    A*T, where m = numCols+blockSize. With C = V(:,0:numCols)'*T and the
+ *    Cholesky factor R'*R = T'*T - C'*C, the new columns are
+ *
+ *       V(:,numCols:m) = (T - V*C)*R^{-1},   W(:,numCols:m) = (A*T - W*C)*R^{-1},
+ *
+ *    and the new blocks of H follow from V'*A*T and T'*A*T without touching
+ *    the long vectors again:
+ *
+ *       H(0:numCols,numCols:m) = X*R^{-1},  X = V'*A*T - H*C,
+ *       H(numCols:m,numCols:m) = R^{-H}*(T'*A*T - C'*V'*A*T - X'*C)*R^{-1}.
+ *
+ *    One pass of this scheme loses orthogonality as machEps/rho, where rho is
+ *    the smallest ratio between the squared norm of a column of T - V*C and
+ *    the one of T. The caller can run it again on the output to recover it.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * ldV         The leading dimension of V
+ * ldW         The leading dimension of W
+ * ldH         The leading dimension of H
+ * nLocal      Number of rows of V and W in this process
+ * numCols     The number of columns that haven't changed
+ * blockSize   The number of columns that have changed
+ * rwork       Workspace
+ * lrwork      Size of rwork
+ * 
+ * INPUT/OUTPUT ARRAYS
+ * -------------------
+ * V, W        The bases; only V(:,numCols:m) and W(:,numCols:m) are updated
+ * H           The projected matrix; only its upper triangular part is read
+ * rho         The smallest ratio described above; if zero, the Cholesky
+ *             factorization broke down and V, W and H are not modified
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int update_projection_pipelined_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
+      PRIMME_INT ldW, SCALAR *H, PRIMME_INT ldH, PRIMME_INT nLocal, int numCols,
+      int blockSize, REAL *rho, SCALAR *rwork, size_t *lrwork,
+      primme_params *primme) {
+
+   int i, j, k, m;
+   SCALAR *G, *C, *TT, *VAT, *TAT, *X;
+   REAL *tNorms, d;
+
+   m = numCols+blockSize;
+
+   /* -------------------------- */
+   /* Return memory requirements */
+   /* -------------------------- */
+
+   if (V == NULL) {
+      *lrwork = max(*lrwork, (size_t)m*blockSize*4 + (size_t)numCols*blockSize
+            + blockSize);
+      return 0;
+   }
+
+   assert(ldV >= nLocal && ldW >= nLocal && ldH >= m);
+   assert((size_t)m*blockSize*4 + (size_t)numCols*blockSize + blockSize
+         <= *lrwork);
+
+   *rho = 1.0;
+   if (blockSize <= 0) return 0;
+
+   /* ---------------------------------------------------------------- */
+   /* G = V(:,0:m)'*[T A*T] in a single reduction                      */
+   /* ---------------------------------------------------------------- */
+
+   G = rwork;
+   X = G + (size_t)m*blockSize*2;
+   Num_gemm_Sprimme("C", "N", m, blockSize, nLocal, 1.0, V, ldV,
+         &V[ldV*numCols], ldV, 0.0, G, m);
+   Num_gemm_Sprimme("C", "N", m, blockSize, nLocal, 1.0, V, ldV,
+         &W[ldW*numCols], ldW, 0.0, &G[m*blockSize], m);
+   if (primme->numProcs > 1) {
+      CHKERR(globalSum_Sprimme(G, X, m*blockSize*2, primme), -1);
+      G = X;
+      X = G + (size_t)m*blockSize*2;
+   }
+   C = G;
+   TT = &G[numCols];
+   VAT = &G[m*blockSize];
+   TAT = &VAT[numCols];
+   tNorms = (REAL*)&X[numCols*blockSize];
+
+   /* ---------------------------------------------------------------- */
+   /* R = chol(T'*T - C'*C), stored in the upper part of TT            */
+   /* ---------------------------------------------------------------- */
+
+   for (j=0; j<blockSize; j++) {
+      tNorms[j] = REAL_PART(TT[m*j+j]);
+   }
+   Num_gemm_Sprimme("C", "N", blockSize, blockSize, numCols, -1.0, C, m, C, m,
+         1.0, TT, m);
+   for (j=0; j<blockSize; j++) {
+      for (i=0; i<j; i++) {
+         for (k=0; k<i; k++) {
+            TT[m*j+i] -= CONJ(TT[m*i+k])*TT[m*j+k];
+         }
+         TT[m*j+i] /= TT[m*i+i];
+      }
+      d = REAL_PART(TT[m*j+j]);
+      for (k=0; k<j; k++) {
+         d -= REAL_PART(CONJ(TT[m*j+k])*TT[m*j+k]);
+      }
+      if (!(d > 0.0) || !(tNorms[j] > 0.0)) {
+         *rho = 0.0;
+         return 0;
+      }
+      *rho = min(*rho, d/tNorms[j]);
+      TT[m*j+j] = sqrt(d);
+   }
+
+   /* ---------------------------------------------------------------- */
+   /* X = V'*A*T - H*C and TAT = T'*A*T - C'*V'*A*T - X'*C             */
+   /* ---------------------------------------------------------------- */
+
+   Num_copy_matrix_Sprimme(VAT, numCols, blockSize, m, X, numCols);
+   Num_hemm_Sprimme("L", "U", numCols, blockSize, -1.0, H, ldH, C, m, 1.0, X,
+         numCols);
+   Num_gemm_Sprimme("C", "N", blockSize, blockSize, numCols, -1.0, C, m, VAT,
+         m, 1.0, TAT, m);
+   Num_gemm_Sprimme("C", "N", blockSize, blockSize, numCols, -1.0, X, numCols,
+         C, m, 1.0, TAT, m);
+
+   /* ---------------------------------------------------------------- */
+   /* Update the new columns of V, W and H                             */
+   /* ---------------------------------------------------------------- */
+
+   Num_gemm_Sprimme("N", "N", nLocal, blockSize, numCols, -1.0, V, ldV, C, m,
+         1.0, &V[ldV*numCols], ldV);
+   Num_trsm_Sprimme("R", "U", "N", "N", nLocal, blockSize, 1.0, TT, m,
+         &V[ldV*numCols], ldV);
+   Num_gemm_Sprimme("N", "N", nLocal, blockSize, numCols, -1.0, W, ldW, C, m,
+         1.0, &W[ldW*numCols], ldW);
+   Num_trsm_Sprimme("R", "U", "N", "N", nLocal, blockSize, 1.0, TT, m,
+         &W[ldW*numCols], ldW);
+
+   Num_copy_matrix_Sprimme(X, numCols, blockSize, numCols, &H[ldH*numCols],
+         ldH);
+   Num_trsm_Sprimme("R", "U", "N", "N", numCols, blockSize, 1.0, TT, m,
+         &H[ldH*numCols], ldH);
+   Num_copy_matrix_Sprimme(TAT, blockSize, blockSize, m,
+         &H[ldH*numCols+numCols], ldH);
+   Num_trsm_Sprimme("R", "U", "N", "N", blockSize, blockSize, 1.0, TT, m,
+         &H[ldH*numCols+numCols], ldH);
+   Num_trsm_Sprimme("L", "U", "C", "N", blockSize, blockSize, 1.0, TT, m,
+         &H[ldH*numCols+numCols], ldH);
+
+   /* Make the new diagonal block exactly Hermitian */
+
+   for (j=numCols; j<m; j++) {
+      H[ldH*j+j] = REAL_PART(H[ldH*j+j]);
+      for (i=numCols; i<j; i++) {
+         H[ldH*j+i] = (H[ldH*j+i] + CONJ(H[ldH*i+j]))/(REAL)2.0;
+         H[ldH*i+j] = CONJ(H[ldH*j+i]);
+      }
+   }
+
+   return 0;
+}
@@ -55,4 +55,26 @@ int update_projection_cprimme(PRIMME_COMPLEX_FLOAT *X, PRIMME_INT ldX, PRIMME_CO
       PRIMME_INT ldY, PRIMME_COMPLEX_FLOAT *Z, PRIMME_INT ldZ, PRIMME_INT nLocal, int numCols,
       int blockSize, PRIMME_COMPLEX_FLOAT *rwork, size_t *lrwork, int isSymmetric,
       primme_params *primme);
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_pipelined_Sprimme)
+#  define update_projection_pipelined_Sprimme CONCAT(update_projection_pipelined_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_pipelined_Rprimme)
+#  define update_projection_pipelined_Rprimme CONCAT(update_projection_pipelined_,REAL_SUF)
+#endif
+int update_projection_pipelined_dprimme(double *V, PRIMME_INT ldV, double *W,
+      PRIMME_INT ldW, double *H, PRIMME_INT ldH, PRIMME_INT nLocal, int numCols,
+      int blockSize, double *rho, double *rwork, size_t *lrwork,
+      primme_params *primme);
+int update_projection_pipelined_zprimme(PRIMME_COMPLEX_DOUBLE *V, PRIMME_INT ldV, PRIMME_COMPLEX_DOUBLE *W,
+      PRIMME_INT ldW, PRIMME_COMPLEX_DOUBLE *H, PRIMME_INT ldH, PRIMME_INT nLocal, int numCols,
+      int blockSize, double *rho, PRIMME_COMPLEX_DOUBLE *rwork, size_t *lrwork,
+      primme_params *primme);
+int update_projection_pipelined_sprimme(float *V, PRIMME_INT ldV, float *W,
+      PRIMME_INT ldW, float *H, PRIMME_INT ldH, PRIMME_INT nLocal, int numCols,
+      int blockSize, float *rho, float *rwork, size_t *lrwork,
+      primme_params *primme);
+int update_projection_pipelined_cprimme(PRIMME_COMPLEX_FLOAT *V, PRIMME_INT ldV, PRIMME_COMPLEX_FLOAT *W,
+      PRIMME_INT ldW, PRIMME_COMPLEX_FLOAT *H, PRIMME_INT ldH, PRIMME_INT nLocal, int numCols,
+      int blockSize, float *rho, PRIMME_COMPLEX_FLOAT *rwork, size_t *lrwork,
+      primme_params *primme);
 #endif
@@ -46,6 +46,13 @@ extern double primme_get_wtime(void);
 double primme_get_time(double *, double *);
 #endif
 
+/* Hardware counters read by primme_perf_read: CPU cycles, instructions and */
+/* last level cache misses                                                  */
+#define PRIMME_PERF_NUM 3
+int primme_perf_open(void);
+void primme_perf_close(void);
+int primme_perf_read(double *counters);
+
 #ifdef __cplusplus
 }
 #endif
@@ -485,15 +485,19 @@ SCALAR* Num_compact_vecs_Sprimme(SCALAR *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, SCALAR *work, PRIMME_INT ldwork,
       int avoidCopy) {
 
-   int i;
+   int i, j;
 
    if (avoidCopy) {
       for (i=0; i<n-1 && perm[i]+1 == perm[i+1]; i++);
       if (i >= n-1) return &vecs[ld*perm[0]];
    }
 
-   for (i=0; i < n; i++) {
-      Num_copy_matrix_Sprimme(&vecs[perm[i]*ld], m, 1, ld, &work[i*ldwork], ld);
+   /* Copy every run of consecutive columns with a single call */
+
+   for (i=0; i < n; i=j) {
+      for (j=i+1; j < n && perm[j] == perm[j-1]+1; j++);
+      Num_copy_matrix_Sprimme(&vecs[perm[i]*ld], m, j-i, ld, &work[i*ldwork],
+            ldwork);
    }
    return work;
 }
@@ -0,0 +1,301 @@
+/*******************************************************************************
+ * Copyright (c) 2017, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ * File: monitor_stream.c
+ *
+ * Purpose - Bounded ring buffer of monitor records (primme_monitor_record)
+ *           drained by a background thread.
+ *
+ * The solver is the only producer of a stream and the background thread is
+ * the only consumer, so pushing a record is a copy and a few atomic
+ * operations. If the consumer falls behind and the buffer is full, the record
+ * is dropped and counted instead of blocking the solver. The consumer passes
+ * runs of contiguous records to the sink, and waits on a condition variable
+ * when the buffer is empty; the solver takes the mutex only to wake it up.
+ *
+ * Without POSIX threads or GCC atomics, or if PRIMME_WITHOUT_PTHREADS is
+ * defined, the records are buffered and the sink is called by the solver
+ * every time the buffer fills up.
+ *
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "primme.h"
+
+#if (defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))) \
+      && (defined(__GNUC__) || defined(__clang__)) \
+      && !defined(PRIMME_WITHOUT_PTHREADS)
+#  define USE_PTHREADS
+#  include <pthread.h>
+#endif
+
+/* Only define these functions once */
+#ifdef USE_DOUBLE
+
+#ifdef USE_PTHREADS
+#  define LOAD_ACQUIRE(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#  define STORE_RELEASE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#  define LOAD_SEQ(x) __atomic_load_n(&(x), __ATOMIC_SEQ_CST)
+#  define STORE_SEQ(x, v) __atomic_store_n(&(x), (v), __ATOMIC_SEQ_CST)
+#else
+#  define LOAD_ACQUIRE(x) (x)
+#  define STORE_RELEASE(x, v) ((x) = (v))
+#  define LOAD_SEQ(x) (x)
+#  define STORE_SEQ(x, v) ((x) = (v))
+#endif
+
+struct primme_monitor_stream {
+   primme_monitor_record *records;
+   size_t mask;               /* capacity - 1, capacity is a power of two */
+   size_t head;               /* next record to write, owned by the solver */
+   size_t tail;               /* next record to read, owned by the consumer */
+   int stop;                  /* set by close to finish the consumer */
+   PRIMME_INT dropped;        /* records discarded because of a full buffer */
+   primme_monitor_sink sink;
+   void *ctx;
+#ifdef USE_PTHREADS
+   pthread_t thread;
+   pthread_mutex_t mutex;     /* protects the wait of the consumer */
+   pthread_cond_t cond;       /* signaled when there are records or on stop */
+   int sleeping;              /* 1 if the consumer may be waiting on cond */
+#endif
+};
+
+/*******************************************************************************
+ * Subroutine drain - pass the records in the buffer to the sink.
+ *
+ * Return 1 if there were records to drain, 0 otherwise.
+ ******************************************************************************/
+
+static int drain(primme_monitor_stream *stream) {
+   size_t tail = stream->tail, head = LOAD_ACQUIRE(stream->head);
+   int ret = head != tail;
+
+   while (head != tail) {
+      size_t i = tail & stream->mask, n = head - tail;
+
+      /* Stop at the end of the buffer, the rest is at the beginning */
+      if (n > stream->mask + 1 - i) n = stream->mask + 1 - i;
+      stream->sink(&stream->records[i], (int)n, stream->ctx);
+      tail += n;
+      STORE_RELEASE(stream->tail, tail);
+   }
+   return ret;
+}
+
+#ifdef USE_PTHREADS
+
+/*******************************************************************************
+ * Subroutine wake - wake up the consumer if it may be waiting on cond.
+ *
+ * The consumer sets sleeping before checking head for the last time, and the
+ * solver updates head before checking sleeping; with sequentially consistent
+ * operations either the consumer sees the new record or the solver sees
+ * sleeping and signals under the mutex, so no record is left waiting.
+ ******************************************************************************/
+
+static void wake(primme_monitor_stream *stream) {
+   if (LOAD_SEQ(stream->sleeping)) {
+      pthread_mutex_lock(&stream->mutex);
+      pthread_cond_signal(&stream->cond);
+      pthread_mutex_unlock(&stream->mutex);
+   }
+}
+
+static void *consumer(void *arg) {
+   primme_monitor_stream *stream = (primme_monitor_stream*)arg;
+
+   while (1) {
+      int stop = LOAD_ACQUIRE(stream->stop);
+      if (drain(stream)) continue;
+      if (stop) break;
+
+      pthread_mutex_lock(&stream->mutex);
+      STORE_SEQ(stream->sleeping, 1);
+      while (LOAD_SEQ(stream->head) == stream->tail
+            && !LOAD_SEQ(stream->stop)) {
+         pthread_cond_wait(&stream->cond, &stream->mutex);
+      }
+      STORE_SEQ(stream->sleeping, 0);
+      pthread_mutex_unlock(&stream->mutex);
+   }
+   return NULL;
+}
+#endif
+
+/*******************************************************************************
+ * Subroutine primme_monitor_stream_open - create a stream and start the
+ *    thread that passes the records to the sink.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * capacity   Number of records in the buffer; it is rounded up to a power
+ *            of two. If it is not positive, a buffer of 4096 is used.
+ * sink       Function that receives the records
+ * ctx        Argument passed to sink
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * stream     The new stream
+ *
+ * Return value
+ * ------------
+ *  0 - Success
+ * -1 - Invalid sink or stream
+ * -2 - Failed to allocate the buffer
+ * -3 - Failed to start the consumer thread
+ ******************************************************************************/
+
+int primme_monitor_stream_open(int capacity, primme_monitor_sink sink,
+      void *ctx, primme_monitor_stream **stream) {
+
+   primme_monitor_stream *s;
+   size_t n;
+
+   if (sink == NULL || stream == NULL) return -1;
+   if (capacity <= 0) capacity = 4096;
+   for (n=1; n < (size_t)capacity; n*=2);
+
+   s = (primme_monitor_stream*)calloc(1, sizeof(primme_monitor_stream));
+   if (s) s->records =
+      (primme_monitor_record*)malloc(sizeof(primme_monitor_record)*n);
+   if (s == NULL || s->records == NULL) {
+      free(s);
+      return -2;
+   }
+   s->mask = n - 1;
+   s->sink = sink;
+   s->ctx = ctx;
+
+#ifdef USE_PTHREADS
+   if (pthread_mutex_init(&s->mutex, NULL) != 0) {
+      free(s->records);
+      free(s);
+      return -3;
+   }
+   if (pthread_cond_init(&s->cond, NULL) != 0) {
+      pthread_mutex_destroy(&s->mutex);
+      free(s->records);
+      free(s);
+      return -3;
+   }
+   if (pthread_create(&s->thread, NULL, consumer, s) != 0) {
+      pthread_cond_destroy(&s->cond);
+      pthread_mutex_destroy(&s->mutex);
+      free(s->records);
+      free(s);
+      return -3;
+   }
+#endif
+
+   *stream = s;
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine primme_monitor_stream_push - append a record to the stream.
+ *
+ * Only one thread may push records into a stream at a time.
+ *
+ * Return value
+ * ------------
+ *  0 - Success
+ *  1 - The buffer was full and the record was dropped
+ ******************************************************************************/
+
+int primme_monitor_stream_push(primme_monitor_stream *stream,
+      const primme_monitor_record *record) {
+
+   size_t head = stream->head;
+
+   if (head - LOAD_ACQUIRE(stream->tail) > stream->mask) {
+#ifdef USE_PTHREADS
+      stream->dropped++;
+      return 1;
+#else
+      drain(stream);
+#endif
+   }
+   stream->records[head & stream->mask] = *record;
+#ifdef USE_PTHREADS
+   STORE_SEQ(stream->head, head + 1);
+   wake(stream);
+#else
+   STORE_RELEASE(stream->head, head + 1);
+#endif
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine primme_monitor_stream_close - pass the pending records to the
+ *    sink, stop the consumer thread and free the stream.
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * dropped    If not NULL, number of records dropped because the buffer was full
+ *
+ ******************************************************************************/
+
+int primme_monitor_stream_close(primme_monitor_stream *stream,
+      PRIMME_INT *dropped) {
+
+   if (stream == NULL) return -1;
+
+#ifdef USE_PTHREADS
+   STORE_SEQ(stream->stop, 1);
+   pthread_mutex_lock(&stream->mutex);
+   pthread_cond_signal(&stream->cond);
+   pthread_mutex_unlock(&stream->mutex);
+   pthread_join(stream->thread, NULL);
+   pthread_cond_destroy(&stream->cond);
+   pthread_mutex_destroy(&stream->mutex);
+#endif
+   drain(stream);
+
+   if (dropped) *dropped = stream->dropped;
+   free(stream->records);
+   free(stream);
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine primme_monitor_sink_file - sink that writes the records in
+ *    binary to the FILE* in ctx, for instance a file or a socket opened with
+ *    fdopen.
+ ******************************************************************************/
+
+void primme_monitor_sink_file(const primme_monitor_record *records, int n,
+      void *ctx) {
+
+   fwrite(records, sizeof(primme_monitor_record), (size_t)n, (FILE*)ctx);
+   fflush((FILE*)ctx);
+}
+
+#endif /* USE_DOUBLE */
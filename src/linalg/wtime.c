@@ -38,6 +38,15 @@
 #  include <sys/time.h>
 #  include <sys/resource.h>
 #endif
+#if defined(__linux__) && (defined(__GNUC__) || defined(__clang__)) \
+      && !defined(PRIMME_WITHOUT_PERF_EVENT)
+#  define USE_PERF_EVENT
+#  include <string.h>
+#  include <unistd.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <linux/perf_event.h>
+#endif
 #include "wtime.h"
 
 #ifdef RUSAGE_SELF
@@ -114,7 +123,105 @@ double primme_get_time(double *utime, double *stime) {
 
    return *utime + *stime;
 }
+#endif
+
+/*
+ * Hardware counters -----------------------------------------------------------
+ *
+ * On Linux the counters are read with perf_event_open. They count the
+ * calling thread in user space only, and they are grouped so that a single
+ * read returns all of them. Nested calls to primme_perf_open (for instance
+ * from primme_svds) share the counters of the outermost call.
+ *
+ * If the kernel or the hardware doesn't provide the counters (virtual
+ * machines, perf_event_paranoid > 2, other systems) primme_perf_open returns
+ * 0 and PRIMME reports only times.
+ */
+
+#ifdef USE_PERF_EVENT
+
+static __thread int perf_fd[PRIMME_PERF_NUM] = {-1, -1, -1};
+static __thread int perf_refs = 0;
+
+static int perf_event_open_counter(unsigned long long config, int group_fd) {
+   struct perf_event_attr attr;
+
+   memset(&attr, 0, sizeof(attr));
+   attr.type = PERF_TYPE_HARDWARE;
+   attr.size = sizeof(attr);
+   attr.config = config;
+   attr.disabled = (group_fd == -1) ? 1 : 0;
+   attr.exclude_kernel = 1;
+   attr.exclude_hv = 1;
+   attr.read_format = PERF_FORMAT_GROUP;
+   return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+int primme_perf_open(void) {
+   static const unsigned long long config[PRIMME_PERF_NUM] = {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES};
+   int i;
+
+   if (perf_refs > 0) {
+      perf_refs++;
+      return perf_fd[0] >= 0;
+   }
+
+   for (i=0; i<PRIMME_PERF_NUM; i++) {
+      perf_fd[i] = perf_event_open_counter(config[i], i == 0 ? -1 : perf_fd[0]);
+      if (perf_fd[i] < 0) break;
+   }
+   if (i < PRIMME_PERF_NUM) {
+      while (--i >= 0) close(perf_fd[i]);
+      perf_fd[0] = -1;
+   }
+   else {
+      ioctl(perf_fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(perf_fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+   }
+   perf_refs = 1;
+   return perf_fd[0] >= 0;
+}
+
+void primme_perf_close(void) {
+   int i;
+
+   if (perf_refs <= 0 || --perf_refs > 0) return;
+   if (perf_fd[0] >= 0) {
+      for (i=PRIMME_PERF_NUM-1; i>=0; i--) close(perf_fd[i]);
+      perf_fd[0] = -1;
+   }
+}
+
+int primme_perf_read(double *counters) {
+   unsigned long long buf[1+PRIMME_PERF_NUM];
+   int i;
+
+   if (perf_fd[0] < 0 || read(perf_fd[0], buf, sizeof(buf)) != sizeof(buf)) {
+      return 0;
+   }
+   for (i=0; i<PRIMME_PERF_NUM; i++) counters[i] = (double)buf[i+1];
+   return 1;
+}
+
 #else
+
+int primme_perf_open(void) {
+   return 0;
+}
+
+void primme_perf_close(void) {
+}
+
+int primme_perf_read(double *counters) {
+   (void)counters;
+   return 0;
+}
+
+#endif /* USE_PERF_EVENT */
+
+#if !(defined (__unix__) || (defined (__APPLE__) && defined (__MACH__)))
 #include <Windows.h>
 double primme_wTimer(int zeroTimer) {
    static DWORD StartingTime;
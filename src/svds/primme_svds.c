@@ -72,6 +72,11 @@ static void default_monitor(void *basisSvals_, int *basisSize, int *basisFlags,
       void *lockedSvals_, int *numLocked, int *lockedFlags, void *lockedNorms_,
       int *inner_its, void *LSRes_, primme_event *event, int *stage,
       primme_svds_params *primme_svds, int *err);
+static void stream_monitor(void *basisSvals_, int *basisSize, int *basisFlags,
+      int *iblock, int *blockSize, void *basisNorms_, int *numConverged,
+      void *lockedSvals_, int *numLocked, int *lockedFlags, void *lockedNorms_,
+      int *inner_its, void *LSRes_, primme_event *event, int *stage,
+      primme_svds_params *primme_svds, int *err);
 static void monitor_single_stage(void *basisEvals_, int *basisSize, int *basisFlags,
       int *iblock, int *blockSize, void *basisNorms_, int *numConverged,
       void *lockedEvals_, int *numLocked, int *lockedFlags, void *lockedNorms_,
@@ -186,7 +191,8 @@ int Sprimme_svds(REAL *svals, SCALAR *svecs, REAL *resNorms,
    /* ----------------------- */
 
    if (!primme_svds->monitorFun) {
-      primme_svds->monitorFun = default_monitor;
+      primme_svds->monitorFun =
+         primme_svds->monitorStream ? stream_monitor : default_monitor;
    }
 
    /* ----------------------- */
@@ -1194,6 +1200,86 @@ static void default_monitor(void *basisSvals_, int *basisSize, int *basisFlags,
 }
 
 
+/*******************************************************************************
+ * Subroutine stream_monitor - push a primme_monitor_record into
+ *    primme_svds->monitorStream for every event, and for every triplet in the
+ *    block at outer iterations. It is the default monitor if monitorStream is
+ *    set.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * See default_monitor
+ *
+ * OUTPUT
+ * ------
+ * err          Error code
+ * 
+ ******************************************************************************/
+
+static void stream_monitor(void *basisSvals_, int *basisSize, int *basisFlags,
+      int *iblock, int *blockSize, void *basisNorms_, int *numConverged,
+      void *lockedSvals_, int *numLocked, int *lockedFlags, void *lockedNorms_,
+      int *inner_its, void *LSRes_, primme_event *event, int *stage,
+      primme_svds_params *primme_svds, int *err)
+{
+   REAL *basisSvals = (REAL*)basisSvals_, *basisNorms = (REAL*)basisNorms_,
+        *lockedSvals = (REAL*)lockedSvals_, *lockedNorms = (REAL*)lockedNorms_,
+        *LSRes = (REAL*)LSRes_;
+   primme_monitor_record r;
+   int i;
+   assert(event != NULL && primme_svds != NULL && stage != NULL);
+   (void)basisSize; (void)basisFlags; (void)lockedFlags;
+
+   *err = 0;
+
+   /* Only report if this is proc zero */
+   if (primme_svds->procID != 0) return;
+
+   r.time = primme_svds->stats.elapsedTime;
+   r.value = r.resNorm = r.LSRes = 0.0;
+   r.numMatvecs = primme_svds->stats.numMatvecs;
+   r.numOuterIterations = primme_svds->stats.numOuterIterations;
+   r.event = (int)*event;
+   r.index = 0;
+   r.numConverged = numConverged ? *numConverged : 0;
+   r.stage = *stage+1;
+
+   switch(*event) {
+   case primme_event_outer_iteration:
+      assert(basisSvals && iblock && blockSize && basisNorms);
+      for (i=0; i < *blockSize; i++) {
+         r.index = i;
+         r.value = basisSvals[iblock[i]];
+         r.resNorm = basisNorms[iblock[i]];
+         primme_monitor_stream_push(primme_svds->monitorStream, &r);
+      }
+      return;
+   case primme_event_inner_iteration:
+      assert(basisSvals && iblock && basisNorms && inner_its && LSRes);
+      r.index = *inner_its;
+      r.value = basisSvals[iblock[0]];
+      r.resNorm = basisNorms[iblock[0]];
+      r.LSRes = *LSRes;
+      break;
+   case primme_event_converged:
+      assert(iblock && basisSvals && basisNorms);
+      r.index = iblock[0];
+      r.value = basisSvals[iblock[0]];
+      r.resNorm = basisNorms[iblock[0]];
+      break;
+   case primme_event_locked:
+      assert(numLocked && lockedSvals && lockedNorms);
+      r.index = *numLocked-1;
+      r.value = lockedSvals[*numLocked-1];
+      r.resNorm = lockedNorms[*numLocked-1];
+      break;
+   default:
+      break;
+   }
+   primme_monitor_stream_push(primme_svds->monitorStream, &r);
+}
+
+
 /*******************************************************************************
  * Subroutine monitor_single_stage - report iterations, #MV, residual norm,
  *    eigenvalues, etc. at every inner/outer iteration and when some pair
@@ -128,6 +128,7 @@ void primme_svds_initialize(primme_svds_params *primme_svds) {
    primme_svds->realWork                = NULL;
    primme_svds->monitorFun              = NULL;
    primme_svds->monitor                 = NULL;
+   primme_svds->monitorStream           = NULL;
 
    primme_initialize(&primme_svds->primme);
    primme_initialize(&primme_svds->primmeStage2);
@@ -676,6 +677,9 @@ int primme_svds_get_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_monitor:
          v->ptr_v = primme_svds->monitor;
          break;
+      case PRIMME_SVDS_monitorStream:
+         v->ptr_v = primme_svds->monitorStream;
+         break;
       default:
          return 1;
    }
@@ -883,6 +887,9 @@ int primme_svds_set_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_monitor:
          primme_svds->monitor = v.ptr_v;
       break;
+      case PRIMME_SVDS_monitorStream:
+         primme_svds->monitorStream = (primme_monitor_stream*)v.ptr_v;
+      break;
       default:
          return 1;
    }
@@ -979,6 +986,7 @@ int primme_svds_member_info(primme_svds_params_label *label_,
    IF_IS(stats_timeGlobalSum);
    IF_IS(monitorFun);
    IF_IS(monitor);
+   IF_IS(monitorStream);
 #undef IF_IS
 
    /* Return label/label_name */
@@ -1057,6 +1065,7 @@ int primme_svds_member_info(primme_svds_params_label *label_,
       case PRIMME_SVDS_outputFile:
       case PRIMME_SVDS_monitorFun:
       case PRIMME_SVDS_monitor:
+      case PRIMME_SVDS_monitorStream:
       if (type) *type = primme_pointer;
       if (arity) *arity = 1;
       break;
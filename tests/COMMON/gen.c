@@ -0,0 +1,655 @@
+/*******************************************************************************
+ *   PRIMME PReconditioned Iterative MultiMethod Eigensolver
+ *   Copyright (C) 2017 College of William & Mary,
+ *   James R. McCombs, Eloy Romero Alcalde, Andreas Stathopoulos, Lingfei Wu
+ *
+ *   This file is part of PRIMME.
+ *
+ *   PRIMME is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2.1 of the License, or (at your option) any later version.
+ *
+ *   PRIMME is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *******************************************************************************
+ * File: gen.c
+ *
+ * Purpose - Matrix-free synthetic operators for benchmarking at any size
+ *           without reading a matrix file. The operator is selected with
+ *           driver.matrixFile = <kind>:<p1>[,<p2>[,<p3>[,<p4>]]], where
+ *
+ *    lap2d:nx[,ny]              2D Laplacian, 5-point stencil, n = nx*ny
+ *    lap3d:nx[,ny[,nz]]         3D Laplacian, 7-point stencil, n = nx*ny*nz
+ *    randspd:n[,k[,cond[,seed]]]  symmetric with 2k random off-diagonals
+ *                               and spectrum in [1/2, cond+1/2]
+ *    lowrank:n[,k[,cond[,seed]]]  D + U*U', D spread in [1,cond] and U n x k
+ *    grad2d:nx[,ny]             rectangular forward-difference gradient on a
+ *    grad3d:nx[,ny[,nz]]        2D/3D grid (only for SVDS), A'*A is the
+ *                               Laplacian with Neumann boundary conditions
+ *
+ *           The entries are computed on the fly, so the memory is O(n) only
+ *           for the vectors. Random entries are generated by hashing the
+ *           seed and the position, so the operator does not depend on the
+ *           number of threads or the block size.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "gen.h"
+
+/* Number of rows processed together for all vectors in a block */
+#define GEN_TILE 256
+
+#ifndef M_PI
+#  define M_PI 3.14159265358979323846
+#endif
+
+/******************************************************************************
+ * Hash functions used to generate the random entries
+ *
+******************************************************************************/
+
+static unsigned long long splitmix64(unsigned long long z) {
+   z += 0x9E3779B97F4A7C15ULL;
+   z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+   return z ^ (z >> 31);
+}
+
+/* Return a value in [-1,1) that only depends on seed, i and j */
+
+static double hashUniform(unsigned long long seed, PRIMME_INT i, int j) {
+   unsigned long long h = splitmix64(splitmix64(seed ^ (unsigned long long)i)
+         + (unsigned long long)j);
+   return (double)(h >> 11) * (2.0/9007199254740992.0) - 1.0;
+}
+
+/* Diagonal of randspd and lowrank, linearly spread in [1,cond] */
+
+static double diagSpread(const GenMatrix *matrix, PRIMME_INT i) {
+   if (matrix->n <= 1) return 1.0;
+   return 1.0 + (matrix->cond - 1.0)*(double)i/(double)(matrix->n - 1);
+}
+
+/* Number of neighbours of the grid point p */
+
+static int gridDegree(const GenMatrix *matrix, PRIMME_INT p) {
+   PRIMME_INT nx = matrix->nx, ny = matrix->ny, nz = matrix->nz;
+   PRIMME_INT ix = p % nx, iy = (p / nx) % ny, iz = p / (nx*ny);
+   return (ix > 0) + (ix < nx-1) + (iy > 0) + (iy < ny-1)
+      + (iz > 0) + (iz < nz-1);
+}
+
+/******************************************************************************
+ * Parses the operator description and sets up the generator. Returns in
+ * aNorm an estimation of ||A||_2.
+ *
+******************************************************************************/
+
+int createGenMatrix(const char *spec, GenMatrix **matrix_, double *aNorm) {
+   char name[32];
+   double p[4] = {0.0, 0.0, 0.0, 0.0};
+   int np = 0, i, j;
+   const char *s;
+   char *end;
+   GenMatrix *matrix;
+
+   s = strchr(spec, ':');
+   if (!s || s - spec >= (int)sizeof(name)) {
+      fprintf(stderr, "ERROR: invalid generator '%s'\n", spec);
+      return -1;
+   }
+   strncpy(name, spec, s - spec);
+   name[s - spec] = '\0';
+   for (s++; np < 4; s = end+1) {
+      p[np] = strtod(s, &end);
+      if (end == s) break;
+      np++;
+      if (*end != ',') break;
+   }
+   if (np == 0 || p[0] < 1) {
+      fprintf(stderr, "ERROR: invalid generator parameters in '%s'\n", spec);
+      return -1;
+   }
+
+   matrix = (GenMatrix *)primme_calloc(1, sizeof(GenMatrix), "GenMatrix");
+   memset(matrix, 0, sizeof(GenMatrix));
+
+   if (strcmp(name, "lap2d") == 0 || strcmp(name, "lap3d") == 0
+         || strcmp(name, "grad2d") == 0 || strcmp(name, "grad3d") == 0) {
+      double norm2 = 0.0;
+      matrix->kind = name[0] == 'l' ? gen_lap : gen_grad;
+      matrix->ndims = name[strlen(name)-2] == '3' ? 3 : 2;
+      matrix->nx = (PRIMME_INT)p[0];
+      matrix->ny = np > 1 ? (PRIMME_INT)p[1] : matrix->nx;
+      matrix->nz = matrix->ndims < 3 ? 1 : (np > 2 ? (PRIMME_INT)p[2] : matrix->nx);
+      if (matrix->ny < 1 || matrix->nz < 1) {
+         fprintf(stderr, "ERROR: invalid grid size in '%s'\n", spec);
+         free(matrix);
+         return -1;
+      }
+      matrix->n = matrix->nx*matrix->ny*matrix->nz;
+      if (matrix->kind == gen_lap) {
+         /* Largest eigenvalue of the Dirichlet Laplacian */
+         norm2 += 4.0*pow(sin(matrix->nx*M_PI/(2.0*(matrix->nx+1))), 2);
+         norm2 += 4.0*pow(sin(matrix->ny*M_PI/(2.0*(matrix->ny+1))), 2);
+         if (matrix->ndims == 3)
+            norm2 += 4.0*pow(sin(matrix->nz*M_PI/(2.0*(matrix->nz+1))), 2);
+         matrix->m = matrix->n;
+         *aNorm = norm2;
+      }
+      else {
+         /* Largest singular value is the square root of the largest     */
+         /* eigenvalue of the Neumann Laplacian                          */
+         norm2 += 4.0*pow(sin((matrix->nx-1)*M_PI/(2.0*matrix->nx)), 2);
+         norm2 += 4.0*pow(sin((matrix->ny-1)*M_PI/(2.0*matrix->ny)), 2);
+         norm2 += 4.0*pow(sin((matrix->nz-1)*M_PI/(2.0*matrix->nz)), 2);
+         matrix->m = (matrix->nx-1)*matrix->ny*matrix->nz
+            + matrix->nx*(matrix->ny-1)*matrix->nz
+            + matrix->nx*matrix->ny*(matrix->nz-1);
+         if (matrix->m < 1) {
+            fprintf(stderr, "ERROR: empty gradient in '%s'\n", spec);
+            free(matrix);
+            return -1;
+         }
+         *aNorm = sqrt(norm2);
+      }
+   }
+   else if (strcmp(name, "randspd") == 0 || strcmp(name, "lowrank") == 0) {
+      matrix->kind = name[0] == 'r' ? gen_randspd : gen_lowrank;
+      matrix->m = matrix->n = (PRIMME_INT)p[0];
+      matrix->k = np > 1 ? (int)p[1] : 4;
+      matrix->cond = np > 2 ? p[2] : 1e3;
+      matrix->seed = np > 3 ? (unsigned long long)p[3] : 1;
+      if (matrix->k < 1 || matrix->cond < 1.0) {
+         fprintf(stderr, "ERROR: invalid generator parameters in '%s'\n", spec);
+         free(matrix);
+         return -1;
+      }
+      if (matrix->kind == gen_randspd) {
+         /* Choose k distinct offsets in [1,n-1]; the off-diagonal entries */
+         /* are scaled by 1/(4k), so every Gershgorin disc has radius 1/2  */
+         if (matrix->k > matrix->n-1) matrix->k = (int)(matrix->n-1);
+         matrix->offsets = (PRIMME_INT *)primme_calloc(matrix->k+1,
+               sizeof(PRIMME_INT), "offsets");
+         for (i=0, j=0; i<matrix->k; j++) {
+            int l;
+            PRIMME_INT o = 1 + (PRIMME_INT)(splitmix64(matrix->seed + j)
+                  % (unsigned long long)(matrix->n-1));
+            for (l=0; l<i && matrix->offsets[l] != o; l++);
+            if (l == i) matrix->offsets[i++] = o;
+         }
+         *aNorm = matrix->cond + 0.5;
+      }
+      else {
+         /* With U(i,j) uniform in [-scale,scale), E||U(:,j)||^2 = cond */
+         double fnorm2 = 0.0;
+         PRIMME_INT r;
+         matrix->scale = sqrt(3.0*matrix->cond/matrix->n);
+         for (r=0; r<matrix->n; r++) {
+            for (j=0; j<matrix->k; j++) {
+               double u = matrix->scale*hashUniform(matrix->seed, r, j);
+               fnorm2 += u*u;
+            }
+         }
+         *aNorm = matrix->cond + fnorm2;
+      }
+   }
+   else {
+      fprintf(stderr, "ERROR: unknown generator '%s'\n", name);
+      free(matrix);
+      return -1;
+   }
+
+   *matrix_ = matrix;
+   return 0;
+}
+
+void freeGenMatrix(GenMatrix *matrix) {
+   if (matrix->offsets) free(matrix->offsets);
+   free(matrix);
+}
+
+/******************************************************************************
+ * Stencil products. Each grid line of nx points is computed for all vectors
+ * in the block before moving to the next line, so the neighbouring lines
+ * stay in cache.
+ *
+******************************************************************************/
+
+static void lapMatvec(const GenMatrix *matrix, SCALAR *x, PRIMME_INT ldx,
+      SCALAR *y, PRIMME_INT ldy, int bs) {
+
+   const PRIMME_INT nx = matrix->nx, ny = matrix->ny, nz = matrix->nz;
+   const PRIMME_INT nxy = nx*ny;
+   const double d = 2.0*matrix->ndims;
+   PRIMME_INT line;
+
+   #ifdef _OPENMP
+   #pragma omp parallel for
+   #endif
+   for (line=0; line<ny*nz; line++) {
+      const PRIMME_INT iy = line % ny, iz = line / ny, p0 = line*nx;
+      PRIMME_INT ix;
+      int c;
+      for (c=0; c<bs; c++) {
+         SCALAR *xc = &x[ldx*c+p0], *yc = &y[ldy*c+p0];
+         for (ix=0; ix<nx; ix++) yc[ix] = d*xc[ix];
+         for (ix=1; ix<nx; ix++) yc[ix] -= xc[ix-1];
+         for (ix=0; ix<nx-1; ix++) yc[ix] -= xc[ix+1];
+         if (iy > 0) for (ix=0; ix<nx; ix++) yc[ix] -= xc[ix-nx];
+         if (iy < ny-1) for (ix=0; ix<nx; ix++) yc[ix] -= xc[ix+nx];
+         if (iz > 0) for (ix=0; ix<nx; ix++) yc[ix] -= xc[ix-nxy];
+         if (iz < nz-1) for (ix=0; ix<nx; ix++) yc[ix] -= xc[ix+nxy];
+      }
+   }
+}
+
+/* The rows of the gradient are ordered as the x-edges, then the y-edges and  */
+/* then the z-edges. The edge between points p and q=p+stride has -1 in the   */
+/* column p and +1 in the column q.                                           */
+
+static void gradMatvec(const GenMatrix *matrix, SCALAR *x, PRIMME_INT ldx,
+      SCALAR *y, PRIMME_INT ldy, int bs) {
+
+   const PRIMME_INT nx = matrix->nx, ny = matrix->ny, nz = matrix->nz;
+   const PRIMME_INT nxy = nx*ny;
+   const PRIMME_INT mx = (nx-1)*ny*nz, mxy = mx + nx*(ny-1)*nz;
+   PRIMME_INT line;
+
+   #ifdef _OPENMP
+   #pragma omp parallel for
+   #endif
+   for (line=0; line<ny*nz; line++) {
+      const PRIMME_INT iy = line % ny, iz = line / ny, p0 = line*nx;
+      PRIMME_INT ix;
+      int c;
+      for (c=0; c<bs; c++) {
+         SCALAR *xc = &x[ldx*c+p0], *yc = &y[ldy*c];
+         SCALAR *ye = &yc[(nx-1)*line];
+         for (ix=0; ix<nx-1; ix++) ye[ix] = xc[ix+1] - xc[ix];
+         if (iy < ny-1) {
+            ye = &yc[mx + nx*(iy + (ny-1)*iz)];
+            for (ix=0; ix<nx; ix++) ye[ix] = xc[ix+nx] - xc[ix];
+         }
+         if (iz < nz-1) {
+            ye = &yc[mxy + p0];
+            for (ix=0; ix<nx; ix++) ye[ix] = xc[ix+nxy] - xc[ix];
+         }
+      }
+   }
+}
+
+static void gradtMatvec(const GenMatrix *matrix, SCALAR *x, PRIMME_INT ldx,
+      SCALAR *y, PRIMME_INT ldy, int bs) {
+
+   const PRIMME_INT nx = matrix->nx, ny = matrix->ny, nz = matrix->nz;
+   const PRIMME_INT nxy = nx*ny;
+   const PRIMME_INT mx = (nx-1)*ny*nz, mxy = mx + nx*(ny-1)*nz;
+   PRIMME_INT line;
+
+   #ifdef _OPENMP
+   #pragma omp parallel for
+   #endif
+   for (line=0; line<ny*nz; line++) {
+      const PRIMME_INT iy = line % ny, iz = line / ny, p0 = line*nx;
+      PRIMME_INT ix;
+      int c;
+      for (c=0; c<bs; c++) {
+         SCALAR *xc = &x[ldx*c], *yc = &y[ldy*c+p0];
+         SCALAR *xe = &xc[(nx-1)*line];
+         for (ix=0; ix<nx; ix++) yc[ix] = 0.0;
+         for (ix=1; ix<nx; ix++) yc[ix] += xe[ix-1];
+         for (ix=0; ix<nx-1; ix++) yc[ix] -= xe[ix];
+         if (iy > 0) {
+            xe = &xc[mx + nx*(iy-1 + (ny-1)*iz)];
+            for (ix=0; ix<nx; ix++) yc[ix] += xe[ix];
+         }
+         if (iy < ny-1) {
+            xe = &xc[mx + nx*(iy + (ny-1)*iz)];
+            for (ix=0; ix<nx; ix++) yc[ix] -= xe[ix];
+         }
+         if (iz > 0) {
+            xe = &xc[mxy + p0 - nxy];
+            for (ix=0; ix<nx; ix++) yc[ix] += xe[ix];
+         }
+         if (iz < nz-1) {
+            xe = &xc[mxy + p0];
+            for (ix=0; ix<nx; ix++) yc[ix] -= xe[ix];
+         }
+      }
+   }
+}
+
+/******************************************************************************
+ * Random banded SPD product. The hashed entries of a tile of GEN_TILE rows
+ * are generated once and applied to all vectors in the block.
+ *
+******************************************************************************/
+
+static void randspdMatvec(const GenMatrix *matrix, SCALAR *x, PRIMME_INT ldx,
+      SCALAR *y, PRIMME_INT ldy, int bs) {
+
+   const PRIMME_INT n = matrix->n;
+   const int k = matrix->k;
+   const double s = 1.0/(4.0*k);
+   const PRIMME_INT ntiles = (n + GEN_TILE - 1)/GEN_TILE;
+
+   #ifdef _OPENMP
+   #pragma omp parallel
+   #endif
+   {
+      double *up = (double*)primme_calloc(2*GEN_TILE*k+GEN_TILE, sizeof(double), "coef");
+      double *lo = &up[GEN_TILE*k], *d = &lo[GEN_TILE*k];
+      PRIMME_INT t;
+
+      #ifdef _OPENMP
+      #pragma omp for
+      #endif
+      for (t=0; t<ntiles; t++) {
+         const PRIMME_INT i0 = t*GEN_TILE;
+         const PRIMME_INT i1 = i0 + GEN_TILE < n ? i0 + GEN_TILE : n;
+         PRIMME_INT i;
+         int c, l;
+
+         /* Out of range entries get a zero coefficient and point to the */
+         /* diagonal, so the inner loop has no branches                  */
+         for (i=i0; i<i1; i++) {
+            d[i-i0] = diagSpread(matrix, i);
+            for (l=0; l<k; l++) {
+               PRIMME_INT o = matrix->offsets[l];
+               up[(i-i0)*k+l] = i+o < n ? s*hashUniform(matrix->seed, i, l) : 0.0;
+               lo[(i-i0)*k+l] = i-o >= 0 ? s*hashUniform(matrix->seed, i-o, l) : 0.0;
+            }
+         }
+
+         for (c=0; c<bs; c++) {
+            SCALAR *xc = &x[ldx*c], *yc = &y[ldy*c];
+            for (i=i0; i<i1; i++) {
+               SCALAR yi = d[i-i0]*xc[i];
+               for (l=0; l<k; l++) {
+                  PRIMME_INT o = matrix->offsets[l];
+                  yi += up[(i-i0)*k+l]*xc[i+o < n ? i+o : i];
+                  yi += lo[(i-i0)*k+l]*xc[i-o >= 0 ? i-o : i];
+               }
+               yc[i] = yi;
+            }
+         }
+      }
+      free(up);
+   }
+}
+
+/******************************************************************************
+ * Diagonal plus low rank product, Y = D*X + U*(U'*X). The entries of U for a
+ * tile of rows are generated once per pass and used for all vectors.
+ *
+******************************************************************************/
+
+static void genTileU(const GenMatrix *matrix, PRIMME_INT i0, PRIMME_INT i1,
+      double *U) {
+   PRIMME_INT i;
+   int j;
+   for (i=i0; i<i1; i++)
+      for (j=0; j<matrix->k; j++)
+         U[(i-i0)*matrix->k+j] = matrix->scale*hashUniform(matrix->seed, i, j);
+}
+
+static void lowrankMatvec(const GenMatrix *matrix, SCALAR *x, PRIMME_INT ldx,
+      SCALAR *y, PRIMME_INT ldy, int bs) {
+
+   const PRIMME_INT n = matrix->n;
+   const int k = matrix->k;
+   const PRIMME_INT ntiles = (n + GEN_TILE - 1)/GEN_TILE;
+   SCALAR *T;
+   int j;
+
+   T = (SCALAR*)primme_calloc(k*bs, sizeof(SCALAR), "T");
+   for (j=0; j<k*bs; j++) T[j] = 0.0;
+
+   /* T = U'*X */
+
+   #ifdef _OPENMP
+   #pragma omp parallel
+   #endif
+   {
+      double *U = (double*)primme_calloc(GEN_TILE*k, sizeof(double), "U");
+      SCALAR *Tl = (SCALAR*)primme_calloc(k*bs, sizeof(SCALAR), "T");
+      PRIMME_INT t;
+      int c, l;
+
+      for (l=0; l<k*bs; l++) Tl[l] = 0.0;
+      #ifdef _OPENMP
+      #pragma omp for
+      #endif
+      for (t=0; t<ntiles; t++) {
+         const PRIMME_INT i0 = t*GEN_TILE;
+         const PRIMME_INT i1 = i0 + GEN_TILE < n ? i0 + GEN_TILE : n;
+         PRIMME_INT i;
+         genTileU(matrix, i0, i1, U);
+         for (c=0; c<bs; c++) {
+            SCALAR *xc = &x[ldx*c];
+            for (i=i0; i<i1; i++)
+               for (l=0; l<k; l++)
+                  Tl[k*c+l] += U[(i-i0)*k+l]*xc[i];
+         }
+      }
+      #ifdef _OPENMP
+      #pragma omp critical
+      #endif
+      for (l=0; l<k*bs; l++) T[l] += Tl[l];
+      free(Tl);
+
+      /* Y = D*X + U*T */
+
+      #ifdef _OPENMP
+      #pragma omp barrier
+      #pragma omp for
+      #endif
+      for (t=0; t<ntiles; t++) {
+         const PRIMME_INT i0 = t*GEN_TILE;
+         const PRIMME_INT i1 = i0 + GEN_TILE < n ? i0 + GEN_TILE : n;
+         PRIMME_INT i;
+         genTileU(matrix, i0, i1, U);
+         for (c=0; c<bs; c++) {
+            SCALAR *xc = &x[ldx*c], *yc = &y[ldy*c];
+            for (i=i0; i<i1; i++) {
+               SCALAR yi = diagSpread(matrix, i)*xc[i];
+               for (l=0; l<k; l++)
+                  yi += U[(i-i0)*k+l]*T[k*c+l];
+               yc[i] = yi;
+            }
+         }
+      }
+      free(U);
+   }
+   free(T);
+}
+
+static void GenMatrixMatvecGen(const GenMatrix *matrix, SCALAR *x,
+      PRIMME_INT ldx, SCALAR *y, PRIMME_INT ldy, int bs, int trans) {
+
+   switch(matrix->kind) {
+   case gen_lap:
+      lapMatvec(matrix, x, ldx, y, ldy, bs);
+      break;
+   case gen_randspd:
+      randspdMatvec(matrix, x, ldx, y, ldy, bs);
+      break;
+   case gen_lowrank:
+      lowrankMatvec(matrix, x, ldx, y, ldy, bs);
+      break;
+   case gen_grad:
+      if (trans == 0)
+         gradMatvec(matrix, x, ldx, y, ldy, bs);
+      else
+         gradtMatvec(matrix, x, ldx, y, ldy, bs);
+      break;
+   }
+}
+
+void GenMatrixMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr) {
+
+   GenMatrixMatvecGen((GenMatrix *)primme->matrix, (SCALAR *)x, *ldx,
+         (SCALAR *)y, *ldy, *blockSize, 0);
+   *ierr = 0;
+}
+
+void GenMatrixMatvecSVD(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, int *trans, primme_svds_params *primme_svds, int *ierr) {
+
+   /* All operators but the gradient are symmetric */
+   GenMatrixMatvecGen((GenMatrix *)primme_svds->matrix, (SCALAR *)x, *ldx,
+         (SCALAR *)y, *ldy, *blockSize, *trans);
+   *ierr = 0;
+}
+
+/******************************************************************************
+ * Generates the exact diagonal of A minus shift, to be used with
+ * ApplyInvDiagPrecNative and ApplyInvDavidsonDiagPrecNative.
+ *
+******************************************************************************/
+
+int createInvDiagPrecGen(const GenMatrix *matrix, double shift, double **prec) {
+   PRIMME_INT i;
+   int j;
+   double *diag;
+
+   if (matrix->m != matrix->n) {
+      fprintf(stderr, "ERROR: diagonal of a rectangular generator\n");
+      return -1;
+   }
+   diag = (double*)primme_calloc(matrix->n, sizeof(double), "diag");
+
+   #ifdef _OPENMP
+   #pragma omp parallel for private(j)
+   #endif
+   for (i=0; i<matrix->n; i++) {
+      switch(matrix->kind) {
+      case gen_lap:
+         diag[i] = 2.0*matrix->ndims;
+         break;
+      case gen_randspd:
+         diag[i] = diagSpread(matrix, i);
+         break;
+      case gen_lowrank:
+         diag[i] = diagSpread(matrix, i);
+         for (j=0; j<matrix->k; j++) {
+            double u = matrix->scale*hashUniform(matrix->seed, i, j);
+            diag[i] += u*u;
+         }
+         break;
+      case gen_grad:
+         break;
+      }
+      diag[i] -= shift;
+   }
+   *prec = diag;
+   return 1;
+}
+
+/******************************************************************************
+ * Generates the sum of square values per rows and then per columns minus
+ * shift^2, to be used with ApplyInvNormalPrecNative and
+ * ApplyInvDavidsonNormalPrecNative.
+ *
+******************************************************************************/
+
+int createInvNormalPrecGen(const GenMatrix *matrix, double shift, double **prec) {
+   PRIMME_INT i;
+   int j, l;
+   double *diag, *sumr, *sumc, *G=NULL, minDenominator=1e-14;
+
+   diag = (double*)primme_calloc(matrix->m+matrix->n, sizeof(double), "diag");
+   sumr = diag;
+   sumc = &diag[matrix->m];
+
+   /* For lowrank the row i is d_i*e_i + U*u_i, with u_i the row i of U, */
+   /* and its squared norm is d_i^2 + 2*d_i*u_i'*u_i + u_i'*(U'*U)*u_i    */
+
+   if (matrix->kind == gen_lowrank) {
+      double *U = (double*)primme_calloc(matrix->k, sizeof(double), "U");
+      G = (double*)primme_calloc(matrix->k*matrix->k, sizeof(double), "G");
+      for (j=0; j<matrix->k*matrix->k; j++) G[j] = 0.0;
+      for (i=0; i<matrix->n; i++) {
+         genTileU(matrix, i, i+1, U);
+         for (j=0; j<matrix->k; j++)
+            for (l=0; l<matrix->k; l++)
+               G[matrix->k*j+l] += U[j]*U[l];
+      }
+      free(U);
+   }
+
+   #ifdef _OPENMP
+   #pragma omp parallel for private(j,l)
+   #endif
+   for (i=0; i<matrix->m; i++) {
+      double d, v;
+      switch(matrix->kind) {
+      case gen_lap:
+         d = 2.0*matrix->ndims;
+         sumr[i] = d*d + gridDegree(matrix, i);
+         break;
+      case gen_randspd:
+         d = diagSpread(matrix, i);
+         sumr[i] = d*d;
+         for (l=0; l<matrix->k; l++) {
+            PRIMME_INT o = matrix->offsets[l];
+            if (i+o < matrix->n) {
+               v = hashUniform(matrix->seed, i, l)/(4.0*matrix->k);
+               sumr[i] += v*v;
+            }
+            if (i-o >= 0) {
+               v = hashUniform(matrix->seed, i-o, l)/(4.0*matrix->k);
+               sumr[i] += v*v;
+            }
+         }
+         break;
+      case gen_lowrank:
+         {
+            double U[64], *u = matrix->k <= 64 ? U :
+               (double*)primme_calloc(matrix->k, sizeof(double), "U");
+            genTileU(matrix, i, i+1, u);
+            d = diagSpread(matrix, i);
+            sumr[i] = d*d;
+            for (j=0; j<matrix->k; j++) {
+               sumr[i] += 2.0*d*u[j]*u[j];
+               for (l=0; l<matrix->k; l++)
+                  sumr[i] += u[j]*G[matrix->k*j+l]*u[l];
+            }
+            if (u != U) free(u);
+         }
+         break;
+      case gen_grad:
+         sumr[i] = 2.0;
+         break;
+      }
+   }
+
+   /* Except for the gradient, A is symmetric */
+
+   for (i=0; i<matrix->n; i++) {
+      sumc[i] = matrix->kind == gen_grad ? gridDegree(matrix, i) : sumr[i];
+   }
+   if (G) free(G);
+
+   for (i=0; i<matrix->m+matrix->n; i++) {
+      diag[i] -= shift*shift;
+      if (fabs(diag[i]) < minDenominator)
+         diag[i] = copysign(minDenominator, diag[i]);
+   }
+   *prec = diag;
+   return 1;
+}
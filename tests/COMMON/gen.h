@@ -0,0 +1,65 @@
+/*******************************************************************************
+ *   PRIMME PReconditioned Iterative MultiMethod Eigensolver
+ *   Copyright (C) 2017 College of William & Mary,
+ *   James R. McCombs, Eloy Romero Alcalde, Andreas Stathopoulos, Lingfei Wu
+ *
+ *   This file is part of PRIMME.
+ *
+ *   PRIMME is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2.1 of the License, or (at your option) any later version.
+ *
+ *   PRIMME is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *******************************************************************************
+ * File: gen.h
+ *
+ * Purpose - Definitions of the matrix-free synthetic operators used by the
+ *           driver when driver.matrixChoice = generator.
+ *
+ ******************************************************************************/
+
+#ifndef GEN_H
+#define GEN_H
+
+#include "num.h"
+#include "primme_svds.h"
+
+typedef enum {
+   gen_lap,         /* 2D/3D Laplacian, 5/7-point stencil, Dirichlet     */
+   gen_randspd,     /* banded random SPD with spectrum in [1/2,cond+1/2] */
+   gen_lowrank,     /* diagonal plus rank-k, D + U*U'                    */
+   gen_grad         /* rectangular 2D/3D forward-difference gradient     */
+} gen_kind;
+
+typedef struct {
+   gen_kind kind;
+   PRIMME_INT m;           /* number of rows */
+   PRIMME_INT n;           /* number of columns */
+   PRIMME_INT nx, ny, nz;  /* grid sizes (lap and grad) */
+   int ndims;              /* 2 or 3 (lap and grad) */
+   int k;                  /* off-diagonals (randspd) or rank (lowrank) */
+   PRIMME_INT *offsets;    /* off-diagonal offsets (randspd) */
+   double cond;            /* spread of the diagonal (randspd and lowrank) */
+   double scale;           /* scale of the entries of U (lowrank) */
+   unsigned long long seed;
+} GenMatrix;
+
+int createGenMatrix(const char *spec, GenMatrix **matrix, double *aNorm);
+void freeGenMatrix(GenMatrix *matrix);
+void GenMatrixMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr);
+void GenMatrixMatvecSVD(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, int *trans, primme_svds_params *primme_svds, int *ierr);
+int createInvDiagPrecGen(const GenMatrix *matrix, double shift, double **prec);
+int createInvNormalPrecGen(const GenMatrix *matrix, double shift, double **prec);
+
+#endif
@@ -28,12 +28,67 @@
  ******************************************************************************/
 
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <assert.h>
 #include "primme.h"
 #include "num.h"
 #include "ioandtest.h"
 
+/* Members of primme_params and primme_svds_params stored after the vectors  */
+/* and compared by check_solution and check_solution_svds. They are stored   */
+/* as (label, value) records so that the files do not depend on the layout   */
+/* of the structs; files with a different list of records are rejected.      */
+
+#define PRIMME_STORED_PARAMS(X) \
+   X(n, PRIMME_n) \
+   X(numEvals, PRIMME_numEvals) \
+   X(target, PRIMME_target) \
+   X(numTargetShifts, PRIMME_numTargetShifts) \
+   X(dynamicMethodSwitch, PRIMME_dynamicMethodSwitch) \
+   X(locking, PRIMME_locking) \
+   X(numOrthoConst, PRIMME_numOrthoConst) \
+   X(maxBasisSize, PRIMME_maxBasisSize) \
+   X(minRestartSize, PRIMME_minRestartSize) \
+   X(restartingParams.scheme, PRIMME_restartingParams_scheme) \
+   X(restartingParams.maxPrevRetain, PRIMME_restartingParams_maxPrevRetain) \
+   X(correctionParams.precondition, PRIMME_correctionParams_precondition) \
+   X(correctionParams.robustShifts, PRIMME_correctionParams_robustShifts) \
+   X(correctionParams.maxInnerIterations, PRIMME_correctionParams_maxInnerIterations) \
+   X(correctionParams.projectors.LeftQ, PRIMME_correctionParams_projectors_LeftQ) \
+   X(correctionParams.projectors.LeftX, PRIMME_correctionParams_projectors_LeftX) \
+   X(correctionParams.projectors.RightQ, PRIMME_correctionParams_projectors_RightQ) \
+   X(correctionParams.projectors.RightX, PRIMME_correctionParams_projectors_RightX) \
+   X(correctionParams.projectors.SkewQ, PRIMME_correctionParams_projectors_SkewQ) \
+   X(correctionParams.projectors.SkewX, PRIMME_correctionParams_projectors_SkewX) \
+   X(correctionParams.convTest, PRIMME_correctionParams_convTest) \
+   X(aNorm, PRIMME_aNorm) \
+   X(eps, PRIMME_eps) \
+   X(correctionParams.relTolBase, PRIMME_correctionParams_relTolBase) \
+   X(initSize, PRIMME_initSize) \
+   X(stats.numMatvecs, PRIMME_stats_numMatvecs)
+
+#define PRIMME_SVDS_STORED_PARAMS(X) \
+   X(m, PRIMME_SVDS_m) \
+   X(n, PRIMME_SVDS_n) \
+   X(numSvals, PRIMME_SVDS_numSvals) \
+   X(target, PRIMME_SVDS_target) \
+   X(numTargetShifts, PRIMME_SVDS_numTargetShifts) \
+   X(locking, PRIMME_SVDS_locking) \
+   X(numOrthoConst, PRIMME_SVDS_numOrthoConst) \
+   X(maxBasisSize, PRIMME_SVDS_maxBasisSize) \
+   X(maxBlockSize, PRIMME_SVDS_maxBlockSize) \
+   X(aNorm, PRIMME_SVDS_aNorm) \
+   X(eps, PRIMME_SVDS_eps) \
+   X(initSize, PRIMME_SVDS_initSize) \
+   X(stats.numMatvecs, PRIMME_SVDS_stats_numMatvecs) \
+   X(method, PRIMME_SVDS_method) \
+   X(methodStage2, PRIMME_SVDS_methodStage2)
+
+#define COUNT_PARAM(F, L) +1
+#define NUM_STORED_PARAMS (0 PRIMME_STORED_PARAMS(COUNT_PARAM))
+#define NUM_SVDS_STORED_PARAMS (0 PRIMME_SVDS_STORED_PARAMS(COUNT_PARAM))
+
 static REAL primme_dot_real(SCALAR *x, SCALAR *y, primme_params *primme) {
    REAL aux, aux0;
    int n = 1;
@@ -88,7 +143,7 @@ int check_solution(const char *checkXFileName, primme_params *primme, double *ev
            retX = 1; \
         }
 
-   if (primme0.n && checkInterface) {
+   if (checkInterface) {
       CHECK_PRIMME_PARAM(n);
       CHECK_PRIMME_PARAM(numEvals);
       CHECK_PRIMME_PARAM(target);
@@ -240,12 +295,18 @@ int readBinaryEvecsAndPrimmeParams(const char *fileName, SCALAR *X, SCALAR **Xou
 
    /* Read primme_params */
    if (primme_out) {
+      memset(primme_out, 0, sizeof(*primme_out));
       FREAD(&d, sizeof(d), 1, f);
-      if ((int)REAL_PART(d) == (int)sizeof(*primme_out)) {
-         FREAD(primme_out, sizeof(*primme_out), 1, f);
-      }
-      else
-         primme_out->n = 0;
+      ASSERT_MSG((int)REAL_PART(d) == -NUM_STORED_PARAMS, -1,
+            "Stale primme_params in file %s; regenerate it with driver.saveXFile\n", fileName);
+#     define READ_PARAM(F, L) \
+         FREAD(&d, sizeof(d), 1, f); \
+         ASSERT_MSG((int)REAL_PART(d) == (int)L, -1, \
+               "Stale primme_params in file %s; regenerate it with driver.saveXFile\n", fileName); \
+         FREAD(&d, sizeof(d), 1, f); \
+         primme_out-> F = REAL_PART(d);
+      PRIMME_STORED_PARAMS(READ_PARAM)
+#     undef READ_PARAM
    }
 
    fclose(f);
@@ -300,9 +361,13 @@ int writeBinaryEvecsAndPrimmeParams(const char *fileName, SCALAR *X, int *perm,
    /* Write primme_params */
    if (primme->procID == 0) {
       fseek(f, sizeof(d)*(primme->n*primme->initSize + 3), SEEK_SET);
-      d = sizeof(*primme);
+      d = -NUM_STORED_PARAMS;
       FWRITE(&d, sizeof(d), 1, f);
-      FWRITE(primme, sizeof(*primme), 1, f);
+#     define WRITE_PARAM(F, L) \
+         d = L; FWRITE(&d, sizeof(d), 1, f); \
+         d = primme-> F; FWRITE(&d, sizeof(d), 1, f);
+      PRIMME_STORED_PARAMS(WRITE_PARAM)
+#     undef WRITE_PARAM
    }
 
    fclose(f);
@@ -343,23 +408,21 @@ int check_solution_svds(const char *checkXFileName, primme_svds_params *primme_s
            retX = 1; \
         }
 
-   if (primme_svds0.n) {
-      CHECK_PRIMME_PARAM(m);
-      CHECK_PRIMME_PARAM(n);
-      CHECK_PRIMME_PARAM(numSvals);
-      CHECK_PRIMME_PARAM(target);
-      CHECK_PRIMME_PARAM(numTargetShifts);
-      CHECK_PRIMME_PARAM(locking);
-      CHECK_PRIMME_PARAM(numOrthoConst);
-      CHECK_PRIMME_PARAM(maxBasisSize);
-      CHECK_PRIMME_PARAM(maxBlockSize);
-      CHECK_PRIMME_PARAM_DOUBLE(aNorm);
-      CHECK_PRIMME_PARAM_DOUBLE(eps);
-      CHECK_PRIMME_PARAM(initSize);
-      CHECK_PRIMME_PARAM_TOL(stats.numMatvecs, 60);
-      CHECK_PRIMME_PARAM(method);
-      CHECK_PRIMME_PARAM(methodStage2);
-   }
+   CHECK_PRIMME_PARAM(m);
+   CHECK_PRIMME_PARAM(n);
+   CHECK_PRIMME_PARAM(numSvals);
+   CHECK_PRIMME_PARAM(target);
+   CHECK_PRIMME_PARAM(numTargetShifts);
+   CHECK_PRIMME_PARAM(locking);
+   CHECK_PRIMME_PARAM(numOrthoConst);
+   CHECK_PRIMME_PARAM(maxBasisSize);
+   CHECK_PRIMME_PARAM(maxBlockSize);
+   CHECK_PRIMME_PARAM_DOUBLE(aNorm);
+   CHECK_PRIMME_PARAM_DOUBLE(eps);
+   CHECK_PRIMME_PARAM(initSize);
+   CHECK_PRIMME_PARAM_TOL(stats.numMatvecs, 60);
+   CHECK_PRIMME_PARAM(method);
+   CHECK_PRIMME_PARAM(methodStage2);
 
 #  undef CHECK_PRIMME_PARAM
 #  undef CHECK_PRIMME_PARAM_DOUBLE
@@ -489,14 +552,20 @@ int readBinaryEvecsAndPrimmeSvdsParams(const char *fileName, SCALAR *X, SCALAR *
    }
    fseek(f, (cols*(m+n) + 4)*sizeof(d), SEEK_SET);
 
-   /* Read primme_params */
+   /* Read primme_svds_params */
    if (primme_svds_out) {
+      memset(primme_svds_out, 0, sizeof(*primme_svds_out));
       FREAD(&d, sizeof(d), 1, f);
-      if ((int)REAL_PART(d) == (int)sizeof(*primme_svds_out)) {
-         FREAD(primme_svds_out, sizeof(*primme_svds_out), 1, f);
-      }
-      else
-         primme_svds_out->m = primme_svds_out-> n = 0;
+      ASSERT_MSG((int)REAL_PART(d) == -NUM_SVDS_STORED_PARAMS, -1,
+            "Stale primme_svds_params in file %s; regenerate it with driver.saveXFile\n", fileName);
+#     define READ_PARAM(F, L) \
+         FREAD(&d, sizeof(d), 1, f); \
+         ASSERT_MSG((int)REAL_PART(d) == (int)L, -1, \
+               "Stale primme_svds_params in file %s; regenerate it with driver.saveXFile\n", fileName); \
+         FREAD(&d, sizeof(d), 1, f); \
+         primme_svds_out-> F = REAL_PART(d);
+      PRIMME_SVDS_STORED_PARAMS(READ_PARAM)
+#     undef READ_PARAM
    }
 
    fclose(f);
@@ -558,9 +627,13 @@ int writeBinaryEvecsAndPrimmeSvdsParams(const char *fileName, SCALAR *X, int *pe
    /* Write primme_svds_params */
    if (primme_svds->procID == 0) {
       fseek(f, sizeof(d)*((primme_svds->m+primme_svds->n)*primme_svds->initSize + 4), SEEK_SET);
-      d = sizeof(*primme_svds);
+      d = -NUM_SVDS_STORED_PARAMS;
       FWRITE(&d, sizeof(d), 1, f);
-      FWRITE(primme_svds, sizeof(*primme_svds), 1, f);
+#     define WRITE_PARAM(F, L) \
+         d = L; FWRITE(&d, sizeof(d), 1, f); \
+         d = primme_svds-> F; FWRITE(&d, sizeof(d), 1, f);
+      PRIMME_SVDS_STORED_PARAMS(WRITE_PARAM)
+#     undef WRITE_PARAM
    }
 
    fclose(f);
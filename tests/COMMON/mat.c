@@ -33,6 +33,7 @@
 #include <string.h>
 #include <math.h>
 #include "native.h"
+#include "../../src/include/wtime.h"
 
 static void getDiagonal(const CSRMatrix *matrix, double *diag);
 
@@ -146,20 +147,58 @@ int createInvDiagPrecNative(const CSRMatrix *matrix, double shift, double **prec
    return 1;
 }
 
-static void ApplyInvDiagPrecNativeGen(SCALAR *xvec, int ldx, SCALAR *yvec,
-      int ldy, int nLocal, int bs, double *diag, double *shifts, double aNorm) {
-   int i, j;
-   const double minDenominator = 1e-14*(aNorm >= 0.0L ? aNorm : 1.);
+/* Number of rows processed together for all vectors in a block */
+#define DIAG_TILE 512
 
-   for (i=0; i<bs; i++) {
-      double shift = shifts ? shifts[i] : 0.0;
-      #ifdef _OPENMP
-      #pragma omp parallel for
-      #endif
-      for (j=0; j<nLocal; j++) {
-         double d = diag[j] - shift;
-         d = (fabs(d) > minDenominator) ? d : copysign(minDenominator, d);
-         yvec[ldy*i+j] = xvec[ldx*i+j]/d;
+/* Computes y(:,i) = x(:,i)./(d - shifts(i)) for the rows of the vectors    */
+/* split in two segments: the first n0 rows use diag0 and the next n1 rows  */
+/* use diag1. The rows are processed in tiles, and each tile is applied to  */
+/* all vectors in the block with the shift of every vector loaded once.     */
+/* Without shifts, the inverse of the tile is computed once for all vectors.*/
+
+static void ApplyInvDiagPrecNativeGen(SCALAR *xvec, PRIMME_INT ldx,
+      SCALAR *yvec, PRIMME_INT ldy, PRIMME_INT n0, double *diag0,
+      PRIMME_INT n1, double *diag1, int bs, double *shifts, double aNorm) {
+
+   const double minDenominator = 1e-14*(aNorm >= 0.0L ? aNorm : 1.);
+   const PRIMME_INT ntiles0 = (n0 + DIAG_TILE - 1)/DIAG_TILE;
+   const PRIMME_INT ntiles = ntiles0 + (n1 + DIAG_TILE - 1)/DIAG_TILE;
+   PRIMME_INT t;
+
+   #ifdef _OPENMP
+   #pragma omp parallel for if (ntiles > 1)
+   #endif
+   for (t=0; t<ntiles; t++) {
+      /* Row j0 of the vectors is the row s0 of the segment */
+      const PRIMME_INT s0 = (t < ntiles0 ? t : t - ntiles0)*DIAG_TILE;
+      const PRIMME_INT j0 = (t < ntiles0 ? 0 : n0) + s0;
+      const PRIMME_INT ns = t < ntiles0 ? n0 : n1;
+      const PRIMME_INT nt = (ns - s0 < DIAG_TILE) ? ns - s0 : DIAG_TILE;
+      const double *d = (t < ntiles0 ? diag0 : diag1) + s0;
+      PRIMME_INT j;
+      int i;
+
+      if (!shifts && bs > 1) {
+         double r[DIAG_TILE];
+         for (j=0; j<nt; j++) {
+            r[j] = 1.0/((fabs(d[j]) > minDenominator) ? d[j]
+                  : copysign(minDenominator, d[j]));
+         }
+         for (i=0; i<bs; i++) {
+            SCALAR *x = &xvec[ldx*i+j0], *y = &yvec[ldy*i+j0];
+            for (j=0; j<nt; j++) y[j] = x[j]*r[j];
+         }
+      }
+      else {
+         for (i=0; i<bs; i++) {
+            const double shift = shifts ? shifts[i] : 0.0;
+            SCALAR *x = &xvec[ldx*i+j0], *y = &yvec[ldy*i+j0];
+            for (j=0; j<nt; j++) {
+               double dj = d[j] - shift;
+               dj = (fabs(dj) > minDenominator) ? dj : copysign(minDenominator, dj);
+               y[j] = x[j]/dj;
+            }
+         }
       }
    }
 }
@@ -167,7 +206,8 @@ static void ApplyInvDiagPrecNativeGen(SCALAR *xvec, int ldx, SCALAR *yvec,
 
 void ApplyInvDiagPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
    ApplyInvDiagPrecNativeGen((SCALAR*)x, *ldx, (SCALAR*)y, *ldy,
-      primme->nLocal, *blockSize, (double*)primme->preconditioner, NULL, primme->aNorm);
+      primme->nLocal, (double*)primme->preconditioner, 0, NULL, *blockSize,
+      NULL, primme->aNorm);
    *ierr = 0;
 }
 
@@ -187,7 +227,7 @@ void ApplyInvDiagPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
 void ApplyInvDavidsonDiagPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, 
                                         primme_params *primme, int *ierr) {
    ApplyInvDiagPrecNativeGen((SCALAR*)x, *ldx, (SCALAR*)y, *ldy,
-      primme->nLocal, *blockSize, (double*)primme->preconditioner,
+      primme->nLocal, (double*)primme->preconditioner, 0, NULL, *blockSize,
       primme->ShiftsForPreconditioner, primme->aNorm);
    *ierr = 0;
 }
@@ -321,6 +361,328 @@ void ApplyILUTPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int
    *ierr = 0;
 }
 
+/******************************************************************************
+ * Level-scheduled ILU(k) preconditioner
+ *
+ *    y(i) = U^(-1)*( L^(-1)*x(i)), i=1:blockSize,
+ *    with L,U = iluk(A-shift, level)
+ *
+ * The pattern is computed serially with the usual level-of-fill rule,
+ * lev(i,j) = min(lev(i,j), lev(i,k) + lev(k,j) + 1). Rows are grouped in
+ * levels so that a row only depends on rows of previous levels; the rows of
+ * a level are factorized and solved in parallel with OpenMP. The triangular
+ * solves process all vectors of the block together for every row, so the
+ * factors are read once per block.
+ *
+******************************************************************************/
+
+/* Number of vectors updated together in the triangular solves */
+#define ILUK_BLOCK 16
+
+/* Groups the rows in levels given the level of each row */
+
+static void levelsToLists(int n, const int *lev, int numLevels, int **ptr_,
+      int **rows_) {
+   int i, l;
+   int *ptr = (int *)primme_calloc(numLevels+1, sizeof(int), "levelPtr");
+   int *rows = (int *)primme_calloc(n > 0 ? n : 1, sizeof(int), "levelRows");
+
+   for (l=0; l<=numLevels; l++) ptr[l] = 0;
+   for (i=0; i<n; i++) ptr[lev[i]+1]++;
+   for (l=0; l<numLevels; l++) ptr[l+1] += ptr[l];
+   for (i=0; i<n; i++) rows[ptr[lev[i]]++] = i;
+   for (l=numLevels; l>0; l--) ptr[l] = ptr[l-1];
+   ptr[0] = 0;
+   *ptr_ = ptr;
+   *rows_ = rows;
+}
+
+static int symbolicILUK(const CSRMatrix *matrix, int level, ILUKPrec *prec) {
+   int i, j, k, p, n = matrix->n, nnz = 0, maxnnz;
+   int *next, *lev, *levF, *IA, *JA, *diag;
+
+   /* Sorted linked list with the columns of the current row; n is the end */
+
+   next = (int *)primme_calloc(n+1, sizeof(int), "next");
+   lev = (int *)primme_calloc(n, sizeof(int), "lev");
+   maxnnz = matrix->IA[n] - 1 + n;
+   IA = (int *)primme_calloc(n+1, sizeof(int), "IA");
+   JA = (int *)primme_calloc(maxnnz, sizeof(int), "JA");
+   levF = (int *)primme_calloc(maxnnz, sizeof(int), "levF");
+   diag = (int *)primme_calloc(n > 0 ? n : 1, sizeof(int), "diag");
+   for (i=0; i<n; i++) lev[i] = -1;
+
+   IA[0] = 0;
+   for (i=0; i<n; i++) {
+      int head = n, prev;
+
+      /* Insert the entries of A and the diagonal with level 0 */
+
+      for (p=matrix->IA[i]-1; p<=matrix->IA[i+1]-1; p++) {
+         j = p < matrix->IA[i+1]-1 ? matrix->JA[p]-1 : i;
+         if (lev[j] >= 0) continue;
+         lev[j] = 0;
+         if (j < head) {
+            next[j] = head;
+            head = j;
+         }
+         else {
+            for (k=head; next[k] < j; k=next[k]);
+            next[j] = next[k];
+            next[k] = j;
+         }
+      }
+
+      /* Add the fill from the rows k < i in the list, in ascending order */
+
+      for (k=head; k < i; k=next[k]) {
+         prev = k;
+         for (p=diag[k]+1; p<IA[k+1]; p++) {
+            int l = lev[k] + levF[p] + 1;
+            j = JA[p];
+            if (l > level) continue;
+            if (lev[j] < 0) {
+               while (next[prev] < j) prev = next[prev];
+               next[j] = next[prev];
+               next[prev] = j;
+               lev[j] = l;
+            }
+            else if (l < lev[j]) {
+               lev[j] = l;
+            }
+            if (next[prev] == j) prev = j;
+         }
+      }
+
+      /* Store the row and reset the list */
+
+      for (k=head; k < n; k=next[k]) {
+         if (nnz >= maxnnz) {
+            maxnnz = maxnnz*2;
+            JA = (int *)realloc(JA, maxnnz*sizeof(int));
+            levF = (int *)realloc(levF, maxnnz*sizeof(int));
+            if (!JA || !levF) {
+               fprintf(stderr, "ILU(k) symbolic factorization ran out of memory\n");
+               return -1;
+            }
+         }
+         if (k == i) diag[i] = nnz;
+         JA[nnz] = k;
+         levF[nnz++] = lev[k];
+         lev[k] = -1;
+      }
+      IA[i+1] = nnz;
+   }
+
+   free(next);
+   free(lev);
+   free(levF);
+   prec->n = n;
+   prec->IA = IA;
+   prec->JA = JA;
+   prec->diag = diag;
+   return 0;
+}
+
+static void levelScheduleILUK(ILUKPrec *prec) {
+   int i, p, n = prec->n;
+   int *lev = (int *)primme_calloc(n > 0 ? n : 1, sizeof(int), "lev");
+
+   /* Forward solve and factorization: row i waits for the rows in L(i,:) */
+
+   prec->numLevelsL = 0;
+   for (i=0; i<n; i++) {
+      lev[i] = 0;
+      for (p=prec->IA[i]; p<prec->diag[i]; p++)
+         if (lev[prec->JA[p]] + 1 > lev[i]) lev[i] = lev[prec->JA[p]] + 1;
+      if (lev[i] + 1 > prec->numLevelsL) prec->numLevelsL = lev[i] + 1;
+   }
+   levelsToLists(n, lev, prec->numLevelsL, &prec->levelPtrL, &prec->levelRowsL);
+
+   /* Backward solve: row i waits for the rows in U(i,:) */
+
+   prec->numLevelsU = 0;
+   for (i=n-1; i>=0; i--) {
+      lev[i] = 0;
+      for (p=prec->diag[i]+1; p<prec->IA[i+1]; p++)
+         if (lev[prec->JA[p]] + 1 > lev[i]) lev[i] = lev[prec->JA[p]] + 1;
+      if (lev[i] + 1 > prec->numLevelsU) prec->numLevelsU = lev[i] + 1;
+   }
+   levelsToLists(n, lev, prec->numLevelsU, &prec->levelPtrU, &prec->levelRowsU);
+
+   free(lev);
+}
+
+static void numericILUK(const CSRMatrix *matrix, double shift, ILUKPrec *prec) {
+   const int n = prec->n;
+   int l;
+
+   prec->AElts = (SCALAR *)primme_calloc(prec->IA[n] > 0 ? prec->IA[n] : 1,
+         sizeof(SCALAR), "iluElts");
+   prec->invDiag = (SCALAR *)primme_calloc(n > 0 ? n : 1, sizeof(SCALAR), "invDiag");
+
+   #ifdef _OPENMP
+   #pragma omp parallel private(l)
+   #endif
+   {
+      int i, j, k, p, q, r;
+      int *pos = (int *)primme_calloc(n > 0 ? n : 1, sizeof(int), "pos");
+      for (i=0; i<n; i++) pos[i] = -1;
+
+      for (l=0; l<prec->numLevelsL; l++) {
+         #ifdef _OPENMP
+         #pragma omp for
+         #endif
+         for (r=prec->levelPtrL[l]; r<prec->levelPtrL[l+1]; r++) {
+            double tnorm = 0.0;
+            SCALAR *a = prec->AElts;
+            i = prec->levelRowsL[r];
+
+            /* Scatter A(i,:) - shift*e_i into the pattern of the row */
+
+            for (p=prec->IA[i]; p<prec->IA[i+1]; p++) {
+               pos[prec->JA[p]] = p;
+               a[p] = 0.0;
+            }
+            for (p=matrix->IA[i]-1; p<matrix->IA[i+1]-1; p++) {
+               a[pos[matrix->JA[p]-1]] += matrix->AElts[p];
+               tnorm += ABS(matrix->AElts[p]);
+            }
+            a[prec->diag[i]] -= shift;
+
+            /* Eliminate with the previous rows, which are already final */
+
+            for (p=prec->IA[i]; p<prec->diag[i]; p++) {
+               SCALAR lik;
+               k = prec->JA[p];
+               lik = a[p] *= prec->invDiag[k];
+               for (q=prec->diag[k]+1; q<prec->IA[k+1]; q++) {
+                  j = pos[prec->JA[q]];
+                  if (j >= 0) a[j] -= lik*a[q];
+               }
+            }
+
+            /* Replace zero pivots as SPARSKIT ilut does */
+
+            if (ABS(a[prec->diag[i]]) == 0.0) {
+               a[prec->diag[i]] = 0.0001*(tnorm > 0.0 ?
+                     tnorm/(matrix->IA[i+1]-matrix->IA[i]) : 1.0);
+            }
+            prec->invDiag[i] = 1.0/a[prec->diag[i]];
+
+            for (p=prec->IA[i]; p<prec->IA[i+1]; p++) pos[prec->JA[p]] = -1;
+         }
+      }
+      free(pos);
+   }
+}
+
+int createILUKPrecNative(const CSRMatrix *matrix, double shift, int level,
+                         ILUKPrec **prec_) {
+   ILUKPrec *prec;
+   double t0 = primme_get_wtime();
+
+   prec = (ILUKPrec *)primme_calloc(1, sizeof(ILUKPrec), "ILUKPrec");
+   if (symbolicILUK(matrix, level < 0 ? 0 : level, prec) != 0) {
+      free(prec);
+      return -1;
+   }
+   levelScheduleILUK(prec);
+   numericILUK(matrix, shift, prec);
+   prec->nnzA = matrix->IA[matrix->n] - 1;
+   prec->timeBuild = primme_get_wtime() - t0;
+   prec->timeApply = 0.0;
+   prec->numApply = 0;
+
+   *prec_ = prec;
+   return 0;
+}
+
+void ApplyILUKPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
+   ILUKPrec *prec = (ILUKPrec *)primme->preconditioner;
+   SCALAR *xvec = (SCALAR *)x, *yvec = (SCALAR *)y;
+   const PRIMME_INT lx = *ldx, ly = *ldy;
+   const int bs = *blockSize;
+   double t0 = primme_get_wtime();
+   int l, c0;
+
+   for (c0=0; c0<bs; c0+=ILUK_BLOCK) {
+      const int nc = bs-c0 < ILUK_BLOCK ? bs-c0 : ILUK_BLOCK;
+      SCALAR *xb = &xvec[lx*c0], *yb = &yvec[ly*c0];
+
+      #ifdef _OPENMP
+      #pragma omp parallel private(l)
+      #endif
+      {
+         SCALAR t[ILUK_BLOCK];
+         int i, p, r, c;
+
+         /* y = L^(-1)*x, with unit diagonal */
+
+         for (l=0; l<prec->numLevelsL; l++) {
+            #ifdef _OPENMP
+            #pragma omp for
+            #endif
+            for (r=prec->levelPtrL[l]; r<prec->levelPtrL[l+1]; r++) {
+               i = prec->levelRowsL[r];
+               for (c=0; c<nc; c++) t[c] = xb[lx*c+i];
+               for (p=prec->IA[i]; p<prec->diag[i]; p++) {
+                  const SCALAR a = prec->AElts[p];
+                  const SCALAR *yj = &yb[prec->JA[p]];
+                  for (c=0; c<nc; c++) t[c] -= a*yj[ly*c];
+               }
+               for (c=0; c<nc; c++) yb[ly*c+i] = t[c];
+            }
+         }
+
+         /* y = U^(-1)*y */
+
+         for (l=0; l<prec->numLevelsU; l++) {
+            #ifdef _OPENMP
+            #pragma omp for
+            #endif
+            for (r=prec->levelPtrU[l]; r<prec->levelPtrU[l+1]; r++) {
+               i = prec->levelRowsU[r];
+               for (c=0; c<nc; c++) t[c] = yb[ly*c+i];
+               for (p=prec->diag[i]+1; p<prec->IA[i+1]; p++) {
+                  const SCALAR a = prec->AElts[p];
+                  const SCALAR *yj = &yb[prec->JA[p]];
+                  for (c=0; c<nc; c++) t[c] -= a*yj[ly*c];
+               }
+               for (c=0; c<nc; c++) yb[ly*c+i] = t[c]*prec->invDiag[i];
+            }
+         }
+      }
+   }
+
+   prec->timeApply += primme_get_wtime() - t0;
+   prec->numApply += bs;
+   *ierr = 0;
+}
+
+void reportILUKPrecNative(const ILUKPrec *prec, FILE *outputFile) {
+   fprintf(outputFile, "ILU(k) fill        : %d nonzeros, %.2f times nnz(A)\n",
+         prec->IA[prec->n], prec->nnzA > 0 ? (double)prec->IA[prec->n]/prec->nnzA : 0.0);
+   fprintf(outputFile, "ILU(k) levels      : %d forward, %d backward\n",
+         prec->numLevelsL, prec->numLevelsU);
+   fprintf(outputFile, "ILU(k) build time  : %f\n", prec->timeBuild);
+   fprintf(outputFile, "ILU(k) apply time  : %f (%d vectors)\n", prec->timeApply,
+         prec->numApply);
+}
+
+void freeILUKPrecNative(ILUKPrec *prec) {
+   free(prec->IA);
+   free(prec->JA);
+   free(prec->diag);
+   free(prec->AElts);
+   free(prec->invDiag);
+   free(prec->levelPtrL);
+   free(prec->levelRowsL);
+   free(prec->levelPtrU);
+   free(prec->levelRowsU);
+   free(prec);
+}
+
 
 /******************************************************************************
  * Generates the diagonal of A.
@@ -401,20 +763,20 @@ static void ApplyInvNormalPrecNativeSvdsGen(void *x, PRIMME_INT *ldx, void *y,
    const int bs = *blockSize;
    double *sumr = diag, *sumc = &diag[primme_svds->mLocal];
    
+   /* In augmented mode the vectors are [v; u], with v of size nLocal and */
+   /* u of size mLocal, and both parts are done in a single pass          */
+
    if (*mode == primme_svds_op_AtA) {
-      ApplyInvDiagPrecNativeGen(xvec, *ldx, yvec, *ldy, primme_svds->nLocal, bs,
-         sumc, shifts, primme_svds->aNorm);
+      ApplyInvDiagPrecNativeGen(xvec, *ldx, yvec, *ldy, primme_svds->nLocal,
+         sumc, 0, NULL, bs, shifts, primme_svds->aNorm);
    }
    else if (*mode == primme_svds_op_AAt) {
-      ApplyInvDiagPrecNativeGen(xvec, *ldx, yvec, *ldy, primme_svds->mLocal, bs,
-         sumr, shifts, primme_svds->aNorm);
+      ApplyInvDiagPrecNativeGen(xvec, *ldx, yvec, *ldy, primme_svds->mLocal,
+         sumr, 0, NULL, bs, shifts, primme_svds->aNorm);
    }
    else if (*mode == primme_svds_op_augmented) {
-      ApplyInvDiagPrecNativeGen(xvec, *ldx, yvec, *ldy, primme_svds->nLocal, bs,
-         sumc, shifts, primme_svds->aNorm);
-      ApplyInvDiagPrecNativeGen(xvec+primme_svds->nLocal, *ldx,
-         yvec+primme_svds->nLocal, *ldy, primme_svds->mLocal, bs,
-         sumr, shifts, primme_svds->aNorm);
+      ApplyInvDiagPrecNativeGen(xvec, *ldx, yvec, *ldy, primme_svds->nLocal,
+         sumc, primme_svds->mLocal, sumr, bs, shifts, primme_svds->aNorm);
    } 
 }
 
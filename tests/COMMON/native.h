@@ -29,6 +29,7 @@
 #ifndef NATIVE_H
 #define NATIVE_H
 
+#include <stdio.h>
 #include "csr.h"
 #include "primme_svds.h"
 
@@ -41,6 +42,30 @@ void ApplyInvDavidsonDiagPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_IN
 int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
                          double threshold, double filter, CSRMatrix **prec);
 void ApplyILUTPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr);
+
+/* Level-scheduled ILU(k). The factors are stored in C indexing in a single */
+/* CSR with the unit L strictly below the diagonal and U on and above it.   */
+
+typedef struct {
+   int n;
+   int *IA, *JA;           /* pattern of L+U with sorted columns */
+   int *diag;              /* position of the diagonal in each row */
+   SCALAR *AElts;
+   SCALAR *invDiag;        /* inverse of the diagonal of U */
+   int numLevelsL, numLevelsU;
+   int *levelPtrL, *levelRowsL; /* rows in level l of the forward solve */
+   int *levelPtrU, *levelRowsU; /* rows in level l of the backward solve */
+   int nnzA;               /* nonzeros of A, to report the fill */
+   double timeBuild;       /* time to compute the factors */
+   double timeApply;       /* accumulated time applying the preconditioner */
+   int numApply;           /* number of vectors the preconditioner was applied to */
+} ILUKPrec;
+
+int createILUKPrecNative(const CSRMatrix *matrix, double shift, int level,
+                         ILUKPrec **prec);
+void ApplyILUKPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr);
+void reportILUKPrecNative(const ILUKPrec *prec, FILE *outputFile);
+void freeILUKPrecNative(ILUKPrec *prec);
 void CSRMatrixMatvecSVD(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
       int *blockSize, int *trans, primme_svds_params *primme_svds, int *ierr);
 int createInvNormalPrecNative(const CSRMatrix *matrix, double shift, double **prec);
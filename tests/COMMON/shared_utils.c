@@ -97,6 +97,7 @@ int read_solver_params(char *configFileName, char *outputFileName,
                READ_METHOD(PRIMME_STEEPEST_DESCENT);
                READ_METHOD(PRIMME_LOBPCG_OrthoBasis);
                READ_METHOD(PRIMME_LOBPCG_OrthoBasis_Window);
+               READ_METHOD(PRIMME_GD_plusK_Pipelined);
                #undef READ_METHOD
             }
             if (ret == 0) {
@@ -154,6 +155,8 @@ int read_solver_params(char *configFileName, char *outputFileName,
             OPTIONParams(projection, projection, primme_proj_refined)
             OPTIONParams(projection, projection, primme_proj_harmonic)
          );
+         READ_FIELDParams(projection, pipeline, "%d");
+         READ_FIELDParams(projection, redundantSolve, "%d");
 
          READ_FIELD_OP(initBasisMode,
             OPTION(initBasisMode, primme_init_default)
@@ -181,6 +184,7 @@ int read_solver_params(char *configFileName, char *outputFileName,
          }
  
          READ_FIELD(dynamicMethodSwitch, "%d");
+         READ_FIELD(dynamicSizes, "%d");
          READ_FIELD(locking, "%d");
          READ_FIELD(initSize, "%d");
          READ_FIELD(numOrthoConst, "%d");
@@ -217,6 +221,13 @@ int read_solver_params(char *configFileName, char *outputFileName,
             OPTIONParams(correction, convTest, primme_adaptive)
          );
 
+         READ_FIELD_OPParams(correction, storagePrecision,
+            OPTIONParams(correction, storagePrecision, primme_storage_full)
+            OPTIONParams(correction, storagePrecision, primme_storage_bf16)
+            OPTIONParams(correction, storagePrecision, primme_storage_fp16)
+         );
+         READ_FIELDParams(correction, pipeline, "%d");
+
          READ_FIELDParams(correction, projectors.LeftQ , "%d");
          READ_FIELDParams(correction, projectors.LeftX , "%d");
          READ_FIELDParams(correction, projectors.RightQ, "%d");
@@ -341,6 +352,12 @@ int read_driver_params(char *configFileName, driver_params *driver) {
          else if (strcmp(ident, "driver.checkInterface") == 0) {
             ret = fscanf(configFile, "%d", &driver->checkInterface);
          }
+         else if (strcmp(ident, "driver.convTestBlock") == 0) {
+            ret = fscanf(configFile, "%d", &driver->convTestBlock);
+         }
+         else if (strcmp(ident, "driver.numProcs") == 0) {
+            ret = fscanf(configFile, "%d", &driver->numProcs);
+         }
          else if (strcmp(ident, "driver.matrixChoice") == 0) {
             ret = fscanf(configFile, "%s", stringValue);
             if (ret == 1) {
@@ -359,6 +376,9 @@ int read_driver_params(char *configFileName, driver_params *driver) {
                else if (strcmp(stringValue, "rsb") == 0) {
                   driver->matrixChoice = driver_rsb;
                }
+               else if (strcmp(stringValue, "generator") == 0) {
+                  driver->matrixChoice = driver_generator;
+               }
                else {
                   fprintf(stderr, 
                      "ERROR(read_driver_params): Invalid parameter '%s'\n", ident);
@@ -387,6 +407,9 @@ int read_driver_params(char *configFileName, driver_params *driver) {
                else if (strcmp(stringValue, "bjacobi") == 0) {
                   driver->PrecChoice = driver_bjacobi;
                }
+               else if (strcmp(stringValue, "iluk") == 0) {
+                  driver->PrecChoice = driver_iluk;
+               }
                else {
                   fprintf(stderr, 
                      "ERROR(read_driver_params): Invalid parameter '%s'\n", ident);
@@ -439,8 +462,8 @@ int read_driver_params(char *configFileName, driver_params *driver) {
 
 void driver_display_params(driver_params driver, FILE *outputFile) {
 
-const char *strPrecChoice[] = {"noprecond", "jacobi", "davidsonjacobi", "ilut", "normal", "bjacobi"};
-const char *strMatrixChoice[] = {"default", "native", "petsc", "parasails", "rsb"};
+const char *strPrecChoice[] = {"noprecond", "jacobi", "davidsonjacobi", "ilut", "normal", "bjacobi", "iluk"};
+const char *strMatrixChoice[] = {"default", "native", "petsc", "parasails", "rsb", "generator"};
  
 fprintf(outputFile, "// ---------------------------------------------------\n"
                     "//                 driver configuration               \n"
@@ -455,6 +478,8 @@ fprintf(outputFile, "driver.initialGuessesPert = %e\n", driver.initialGuessesPer
 fprintf(outputFile, "driver.saveXFile     = %s\n", driver.saveXFileName);
 fprintf(outputFile, "driver.checkXFile    = %s\n", driver.checkXFileName);
 fprintf(outputFile, "driver.checkInterface = %d\n", driver.checkInterface);
+fprintf(outputFile, "driver.convTestBlock = %d\n", driver.convTestBlock);
+fprintf(outputFile, "driver.numProcs      = %d\n", driver.numProcs);
 fprintf(outputFile, "driver.PrecChoice    = %s\n", strPrecChoice[driver.PrecChoice]);
 fprintf(outputFile, "driver.shift         = %e\n", driver.shift);
 fprintf(outputFile, "driver.isymm         = %d\n", driver.isymm);
@@ -482,7 +507,8 @@ void driver_display_method(primme_preset_method method, const char* methodstr, F
       "PRIMME_JDQMR_ETol",
       "PRIMME_STEEPEST_DESCENT",
       "PRIMME_LOBPCG_OrthoBasis",
-      "PRIMME_LOBPCG_OrthoBasis_Window"};
+      "PRIMME_LOBPCG_OrthoBasis_Window",
+      "PRIMME_GD_plusK_Pipelined"};
 
    fprintf(outputFile, "%s               = %s\n", methodstr, strMethod[method]);
 
@@ -716,6 +742,7 @@ void broadCast(primme_params *primme, primme_preset_method *method,
       MPI_Bcast(&driver->threshold, 1, MPI_DOUBLE, 0, comm);
       MPI_Bcast(&driver->filter, 1, MPI_DOUBLE, 0, comm);
       MPI_Bcast(&driver->shift, 1, MPI_DOUBLE, 0, comm);
+      MPI_Bcast(&driver->convTestBlock, 1, MPI_INT, 0, comm);
    }
 
    MPI_Bcast(&(primme->numEvals), 1, MPI_INT, 0, comm);
@@ -731,6 +758,7 @@ void broadCast(primme_params *primme, primme_preset_method *method,
 
    MPI_Bcast(&(primme->locking), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->dynamicMethodSwitch), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->dynamicSizes), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->initSize), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->numOrthoConst), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->maxBasisSize), 1, MPI_INT, 0, comm);
@@ -744,6 +772,8 @@ void broadCast(primme_params *primme, primme_preset_method *method,
    MPI_Bcast(&(primme->initBasisMode), 1, MPI_INT, 0, comm);
 
    MPI_Bcast(&(primme->projectionParams.projection), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->projectionParams.pipeline), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->projectionParams.redundantSolve), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->restartingParams.scheme), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->restartingParams.maxPrevRetain), 1, MPI_INT, 0, comm);
 
@@ -752,6 +782,9 @@ void broadCast(primme_params *primme, primme_preset_method *method,
    MPI_Bcast(&(primme->correctionParams.maxInnerIterations),1, MPI_INT, 0,comm);
    MPI_Bcast(&(primme->correctionParams.convTest), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->correctionParams.relTolBase), 1, MPI_DOUBLE, 0, comm);
+   MPI_Bcast(&(primme->correctionParams.storagePrecision), 1, MPI_INT, 0,
+         comm);
+   MPI_Bcast(&(primme->correctionParams.pipeline), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->correctionParams.projectors.LeftQ),  1, MPI_INT, 0,comm);
    MPI_Bcast(&(primme->correctionParams.projectors.LeftX),  1, MPI_INT, 0,comm);
    MPI_Bcast(&(primme->correctionParams.projectors.RightQ), 1, MPI_INT, 0,comm);
@@ -786,7 +819,7 @@ void broadCast_svds(primme_svds_params *primme_svds, primme_svds_preset_method *
    MPI_Bcast(&driver->threshold, 1, MPI_DOUBLE, 0, comm);
    MPI_Bcast(&driver->filter, 1, MPI_DOUBLE, 0, comm);
    MPI_Bcast(&driver->shift, 1, MPI_DOUBLE, 0, comm);
-
+   MPI_Bcast(&driver->convTestBlock, 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme_svds->numSvals), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme_svds->target), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme_svds->numTargetShifts), 1, MPI_INT, 0, comm);
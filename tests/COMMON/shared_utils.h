@@ -41,7 +41,8 @@ typedef enum {
    driver_native,
    driver_petsc,
    driver_parasails,
-   driver_rsb
+   driver_rsb,
+   driver_generator
 } driver_mat;
 
 typedef enum {
@@ -50,7 +51,8 @@ typedef enum {
    driver_jacobi_i,     /* Diag(A-shift_i), shifts provided by primme every step */
    driver_ilut,         /* ILUT(A-shift)  , shift provided once by user */
    driver_normal,       /* precond based on A*A, only for SVD */
-   driver_bjacobi       /* block jacobi */
+   driver_bjacobi,      /* block jacobi */
+   driver_iluk          /* level-scheduled ILU(level) of A-shift */
 } driver_prec;
 
 typedef struct driver_params {
@@ -65,10 +67,12 @@ typedef struct driver_params {
    double initialGuessesPert;
    char checkXFileName[1024];
    int checkInterface;
+   int convTestBlock;      /* use a block convergence test (convTestBlockFun) */
 
    driver_mat matrixChoice;
 
    int weightedPart;
+   int numProcs;           /* threads acting as processes (USE_PTHREAD) */
 
    /* Preconditioning paramaters for various preconditioners */
    driver_prec PrecChoice;
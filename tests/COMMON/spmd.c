@@ -0,0 +1,326 @@
+/*******************************************************************************
+ *   PRIMME PReconditioned Iterative MultiMethod Eigensolver
+ *   Copyright (C) 2017 College of William & Mary,
+ *   James R. McCombs, Eloy Romero Alcalde, Andreas Stathopoulos, Lingfei Wu
+ *
+ *   This file is part of PRIMME.
+ *
+ *   PRIMME is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2.1 of the License, or (at your option) any later version.
+ *
+ *   PRIMME is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *******************************************************************************
+ * File: spmd.c
+ *
+ * Purpose - Thread-based SPMD mode of the driver. Every thread acts as a
+ *           process: it owns a contiguous slice of rows (nLocal < n), the
+ *           matrix-vector product exchanges the halo entries through
+ *           buffers published by the owners, and globalSumReal is a tree
+ *           reduction in shared memory. This exercises the distributed code
+ *           paths of PRIMME without MPI.
+ *
+ *           Every collective operation publishes a pointer in comm->slots,
+ *           waits in a barrier, reads the buffers of the other ranks and
+ *           waits in a barrier again before the owners can modify them.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spmd.h"
+
+/******************************************************************************
+ * Threads and synchronization
+ *
+******************************************************************************/
+
+int spmd_run(int numProcs, void *(*fun)(void *), void **args) {
+   pthread_t *threads;
+   int i, ret = 0;
+
+   threads = (pthread_t *)primme_calloc(numProcs, sizeof(pthread_t), "threads");
+   for (i=1; i<numProcs; i++) {
+      if (pthread_create(&threads[i], NULL, fun, args[i]) != 0) {
+         fprintf(stderr, "ERROR: could not create thread %d\n", i);
+         /* The threads already created would wait forever */
+         exit(EXIT_FAILURE);
+      }
+   }
+   fun(args[0]);
+   for (i=1; i<numProcs; i++) {
+      if (pthread_join(threads[i], NULL) != 0) ret = -1;
+   }
+   free(threads);
+   return ret;
+}
+
+int spmd_comm_init(spmd_comm *comm, int numProcs) {
+   comm->numProcs = numProcs;
+   comm->barrier.numProcs = numProcs;
+   comm->barrier.count = 0;
+   comm->barrier.generation = 0;
+   if (pthread_mutex_init(&comm->barrier.mutex, NULL) != 0) return -1;
+   if (pthread_cond_init(&comm->barrier.cond, NULL) != 0) return -1;
+   comm->slots = (void **)primme_calloc(numProcs, sizeof(void*), "slots");
+   comm->ldSlots = (PRIMME_INT *)primme_calloc(numProcs, sizeof(PRIMME_INT), "ldSlots");
+   comm->matrix = NULL;
+   comm->aNorm = 0.0;
+   comm->ret = 0;
+   return 0;
+}
+
+void spmd_comm_free(spmd_comm *comm) {
+   pthread_mutex_destroy(&comm->barrier.mutex);
+   pthread_cond_destroy(&comm->barrier.cond);
+   free(comm->slots);
+   free(comm->ldSlots);
+}
+
+void spmd_barrier_wait(spmd_barrier *barrier) {
+   unsigned long generation;
+
+   pthread_mutex_lock(&barrier->mutex);
+   generation = barrier->generation;
+   if (++barrier->count == barrier->numProcs) {
+      barrier->count = 0;
+      barrier->generation++;
+      pthread_cond_broadcast(&barrier->cond);
+   }
+   else {
+      while (generation == barrier->generation) {
+         pthread_cond_wait(&barrier->cond, &barrier->mutex);
+      }
+   }
+   pthread_mutex_unlock(&barrier->mutex);
+}
+
+/******************************************************************************
+ * Global sum. The partial sums are added in a binary tree, always in the same
+ * order, and all ranks copy the result from rank 0, so every rank gets the
+ * same values bit by bit.
+ *
+******************************************************************************/
+
+void SPMDGlobalSumDouble(void *sendBuf, void *recvBuf, int *count,
+      primme_params *primme, int *ierr) {
+
+   spmd_rank *rank = (spmd_rank *)primme->commInfo;
+   spmd_comm *comm = rank->comm;
+   const int p = rank->procID, np = comm->numProcs;
+   double *r = (double *)recvBuf;
+   int s, i;
+
+   if (sendBuf != recvBuf) memcpy(recvBuf, sendBuf, sizeof(double)*(*count));
+   comm->slots[p] = recvBuf;
+   spmd_barrier_wait(&comm->barrier);
+
+   for (s=1; s<np; s*=2) {
+      if (p % (2*s) == 0 && p + s < np) {
+         double *o = (double *)comm->slots[p+s];
+         for (i=0; i<*count; i++) r[i] += o[i];
+      }
+      spmd_barrier_wait(&comm->barrier);
+   }
+
+   if (p != 0) memcpy(recvBuf, comm->slots[0], sizeof(double)*(*count));
+   spmd_barrier_wait(&comm->barrier);
+   *ierr = 0;
+}
+
+/******************************************************************************
+ * Matrix distribution. Rank 0 reads the matrix, then every rank takes its
+ * rows and builds the list of halo entries, and finally rank 0 frees the
+ * global matrix.
+ *
+******************************************************************************/
+
+static PRIMME_INT rowStartSPMD(PRIMME_INT n, int numProcs, int p) {
+   return n*p/numProcs;
+}
+
+static int compareInt(const void *a, const void *b) {
+   return *(const int *)a - *(const int *)b;
+}
+
+static spmd_matrix *distributeCSRMatrix(spmd_rank *rank, const CSRMatrix *A) {
+   const int np = rank->comm->numProcs, p = rank->procID;
+   const PRIMME_INT r0 = rowStartSPMD(A->n, np, p), r1 = rowStartSPMD(A->n, np, p+1);
+   spmd_matrix *matrix;
+   int i, j, h, nnz, *map;
+
+   matrix = (spmd_matrix *)primme_calloc(1, sizeof(spmd_matrix), "spmd_matrix");
+   matrix->rank = rank;
+   matrix->rowStart = r0;
+   matrix->nLocal = (int)(r1 - r0);
+   nnz = A->IA[r1] - A->IA[r0];
+   matrix->IA = (int *)primme_calloc(matrix->nLocal+1, sizeof(int), "IA");
+   matrix->JA = (int *)primme_calloc(nnz > 0 ? nnz : 1, sizeof(int), "JA");
+   matrix->AElts = (SCALAR *)primme_calloc(nnz > 0 ? nnz : 1, sizeof(SCALAR), "AElts");
+
+   /* Collect the columns out of [r0,r1) without repetitions */
+
+   map = (int *)primme_calloc(A->n, sizeof(int), "map");
+   for (j=0; j<A->n; j++) map[j] = -1;
+   matrix->haloIdx = (int *)primme_calloc(nnz > 0 ? nnz : 1, sizeof(int), "haloIdx");
+   matrix->nHalo = 0;
+   for (j=A->IA[r0]-1; j<A->IA[r1]-1; j++) {
+      int col = A->JA[j]-1;
+      if ((col < r0 || col >= r1) && map[col] < 0) {
+         map[col] = 0;
+         matrix->haloIdx[matrix->nHalo++] = col;
+      }
+   }
+
+   /* Sort the halo by global index, so entries of the same owner are */
+   /* together, and compute the owner and the index in the owner      */
+
+   qsort(matrix->haloIdx, matrix->nHalo, sizeof(int), compareInt);
+   matrix->haloProc = (int *)primme_calloc(matrix->nHalo > 0 ? matrix->nHalo : 1,
+         sizeof(int), "haloProc");
+   for (h=0, i=0; h<matrix->nHalo; h++) {
+      int col = matrix->haloIdx[h];
+      map[col] = matrix->nLocal + h;
+      while (rowStartSPMD(A->n, np, i+1) <= col) i++;
+      matrix->haloProc[h] = i;
+      matrix->haloIdx[h] = (int)(col - rowStartSPMD(A->n, np, i));
+   }
+
+   /* Copy the rows with the local column indices */
+
+   matrix->IA[0] = 0;
+   for (i=0; i<matrix->nLocal; i++) {
+      for (j=A->IA[r0+i]-1; j<A->IA[r0+i+1]-1; j++) {
+         int col = A->JA[j]-1, k = j - (A->IA[r0]-1);
+         matrix->JA[k] = (col >= r0 && col < r1) ? (int)(col - r0) : map[col];
+         matrix->AElts[k] = A->AElts[j];
+      }
+      matrix->IA[i+1] = A->IA[r0+i+1] - A->IA[r0];
+   }
+   free(map);
+
+   matrix->halo = NULL;
+   matrix->haloCols = 0;
+   return matrix;
+}
+
+int readMatrixSPMD(spmd_rank *rank, const char *matrixFileName,
+      spmd_matrix **matrix, PRIMME_INT *n, double *aNorm) {
+
+   spmd_comm *comm = rank->comm;
+   CSRMatrix *A;
+   int ret;
+
+   if (rank->procID == 0) {
+      comm->ret = readMatrixNative(matrixFileName, &comm->matrix, &comm->aNorm);
+   }
+   spmd_barrier_wait(&comm->barrier);
+   ret = comm->ret;
+   A = comm->matrix;
+   if (ret == 0) {
+      *matrix = distributeCSRMatrix(rank, A);
+      *n = A->n;
+      *aNorm = comm->aNorm;
+   }
+   spmd_barrier_wait(&comm->barrier);
+   if (rank->procID == 0 && ret == 0) {
+      freeCSRMatrix(comm->matrix);
+      comm->matrix = NULL;
+   }
+   return ret;
+}
+
+void freeSPMDMatrix(spmd_matrix *matrix) {
+   free(matrix->IA);
+   free(matrix->JA);
+   free(matrix->AElts);
+   free(matrix->haloProc);
+   free(matrix->haloIdx);
+   if (matrix->halo) free(matrix->halo);
+   free(matrix);
+}
+
+/******************************************************************************
+ * Matrix-vector product. The halo entries of all vectors in the block are
+ * gathered from the input buffers of the owners, then the local rows are
+ * multiplied.
+ *
+******************************************************************************/
+
+void SPMDMatrixMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr) {
+
+   spmd_matrix *matrix = (spmd_matrix *)primme->matrix;
+   spmd_comm *comm = matrix->rank->comm;
+   const int p = matrix->rank->procID, bs = *blockSize, nh = matrix->nHalo;
+   SCALAR *xvec = (SCALAR *)x, *yvec = (SCALAR *)y;
+   int i, j, c;
+
+   if (matrix->haloCols < bs) {
+      if (matrix->halo) free(matrix->halo);
+      matrix->halo = (SCALAR *)primme_calloc((size_t)nh*bs + 1, sizeof(SCALAR), "halo");
+      matrix->haloCols = bs;
+   }
+
+   /* Halo exchange */
+
+   comm->slots[p] = x;
+   comm->ldSlots[p] = *ldx;
+   spmd_barrier_wait(&comm->barrier);
+   for (c=0; c<bs; c++) {
+      for (j=0; j<nh; j++) {
+         const int o = matrix->haloProc[j];
+         matrix->halo[nh*c+j] =
+            ((SCALAR *)comm->slots[o])[comm->ldSlots[o]*c + matrix->haloIdx[j]];
+      }
+   }
+   spmd_barrier_wait(&comm->barrier);
+
+   /* Local product */
+
+   for (c=0; c<bs; c++) {
+      SCALAR *xc = &xvec[*ldx*c], *yc = &yvec[*ldy*c], *hc = &matrix->halo[nh*c];
+      for (i=0; i<matrix->nLocal; i++) {
+         SCALAR s = 0.0;
+         for (j=matrix->IA[i]; j<matrix->IA[i+1]; j++) {
+            const int col = matrix->JA[j];
+            s += matrix->AElts[j]*(col < matrix->nLocal ? xc[col] : hc[col-matrix->nLocal]);
+         }
+         yc[i] = s;
+      }
+   }
+   *ierr = 0;
+}
+
+/******************************************************************************
+ * Local part of the diagonal of A minus shift, to be used with
+ * ApplyInvDiagPrecNative and ApplyInvDavidsonDiagPrecNative.
+ *
+******************************************************************************/
+
+int createInvDiagPrecSPMD(const spmd_matrix *matrix, double shift, double **prec) {
+   int i, j;
+   double *diag;
+
+   diag = (double*)primme_calloc(matrix->nLocal > 0 ? matrix->nLocal : 1,
+         sizeof(double), "diag");
+   for (i=0; i<matrix->nLocal; i++) {
+      diag[i] = 0.0;
+      for (j=matrix->IA[i]; j<matrix->IA[i+1]; j++) {
+         if (matrix->JA[j] == i) diag[i] = REAL_PART(matrix->AElts[j]);
+      }
+      diag[i] -= shift;
+   }
+   *prec = diag;
+   return 1;
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *   PRIMME PReconditioned Iterative MultiMethod Eigensolver
+ *   Copyright (C) 2017 College of William & Mary,
+ *   James R. McCombs, Eloy Romero Alcalde, Andreas Stathopoulos, Lingfei Wu
+ *
+ *   This file is part of PRIMME.
+ *
+ *   PRIMME is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2.1 of the License, or (at your option) any later version.
+ *
+ *   PRIMME is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *******************************************************************************
+ * File: spmd.h
+ *
+ * Purpose - Definitions of the thread-based SPMD mode of the driver, where
+ *           every thread acts as a process with its own slice of rows.
+ *
+ ******************************************************************************/
+
+#ifndef SPMD_H
+#define SPMD_H
+
+#include <pthread.h>
+#include "csr.h"
+#include "primme.h"
+
+/* Barrier implemented with a mutex and a condition variable, because */
+/* pthread_barrier_t is not available everywhere                      */
+
+typedef struct {
+   pthread_mutex_t mutex;
+   pthread_cond_t cond;
+   int numProcs;
+   int count;
+   unsigned long generation;
+} spmd_barrier;
+
+/* State shared by all ranks */
+
+typedef struct {
+   int numProcs;
+   spmd_barrier barrier;
+   void **slots;             /* buffer published by every rank */
+   PRIMME_INT *ldSlots;      /* leading dimension of the published buffers */
+   CSRMatrix *matrix;        /* global matrix while the ranks take their rows */
+   double aNorm;             /* norm of the global matrix */
+   int ret;                  /* error code of reading the matrix */
+} spmd_comm;
+
+/* Value of commInfo for every rank */
+
+typedef struct {
+   spmd_comm *comm;
+   int procID;
+} spmd_rank;
+
+/* Rows of the matrix owned by a rank. Columns in [0,nLocal) refer to local */
+/* rows and columns in [nLocal,nLocal+nHalo) refer to the halo entries.     */
+
+typedef struct {
+   spmd_rank *rank;
+   int nLocal;
+   PRIMME_INT rowStart;      /* first global row of the rank */
+   int *IA, *JA;             /* local CSR in C indexing */
+   SCALAR *AElts;
+   int nHalo;
+   int *haloProc;            /* owner of every halo entry */
+   int *haloIdx;             /* local index of every halo entry in its owner */
+   SCALAR *halo;             /* halo values for a block of vectors */
+   int haloCols;             /* number of vectors allocated in halo */
+} spmd_matrix;
+
+int spmd_run(int numProcs, void *(*fun)(void *), void **args);
+int spmd_comm_init(spmd_comm *comm, int numProcs);
+void spmd_comm_free(spmd_comm *comm);
+void spmd_barrier_wait(spmd_barrier *barrier);
+int readMatrixSPMD(spmd_rank *rank, const char *matrixFileName,
+      spmd_matrix **matrix, PRIMME_INT *n, double *aNorm);
+void freeSPMDMatrix(spmd_matrix *matrix);
+void SPMDMatrixMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr);
+int createInvDiagPrecSPMD(const spmd_matrix *matrix, double shift, double **prec);
+void SPMDGlobalSumDouble(void *sendBuf, void *recvBuf, int *count,
+      primme_params *primme, int *ierr);
+
+#endif
@@ -52,6 +52,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <math.h>
+#include <float.h>
 #include <assert.h>
 
 #ifdef USE_MPI
@@ -59,6 +60,7 @@
 #endif
 #ifdef USE_NATIVE
 #  include "native.h"
+#  include "gen.h"
 #endif
 #ifdef USE_PARASAILS
 #  include "parasailsw.h"
@@ -70,6 +72,9 @@ PetscLogEvent PRIMME_GLOBAL_SUM;
 #ifdef USE_RSB
 #  include "rsbw.h"
 #endif
+#ifdef USE_PTHREAD
+#  include "spmd.h"
+#endif
 
 /* primme.h header file is required to run primme */
 #include "primme.h"
@@ -79,8 +84,20 @@ PetscLogEvent PRIMME_GLOBAL_SUM;
 #include "../../src/include/wtime.h"
 
 static int real_main (int argc, char *argv[]);
+static int solve_main(driver_params driver, primme_params primme,
+      primme_preset_method method, int master, int procID);
+#ifdef USE_PTHREAD
+static int spmd_main(driver_params *driver, primme_params *primme,
+      primme_preset_method method);
+#endif
 static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int **permutation);
 static int destroyMatrixAndPrecond(driver_params *driver, primme_params *primme, int *permutation);
+static void convTestBlockAbsolute(double *evals, void *evecs, PRIMME_INT *ldevecs,
+      double *rNorms, int *isconv, int *blockSize, primme_params *primme,
+      int *ierr);
+
+/* Largest blockSize passed to convTestBlockAbsolute */
+static int convTestBlockMaxSize = 0;
 
 
 
@@ -124,26 +141,16 @@ int main (int argc, char *argv[]) {
 #define __FUNCT__ "real_main"
 static int real_main (int argc, char *argv[]) {
 
-   /* Timing vars */
-   double wt1,wt2;
-#if defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))
-   double ut1,ut2,st1,st2;
-#endif
-
    /* Files */
    char *DriverConfigFileName=NULL, *SolverConfigFileName=NULL;
    
-   /* Driver and solver I/O arrays and parameters */
-   double *evals, *rnorms;
-   SCALAR *evecs;
+   /* Driver and solver parameters */
    driver_params driver;
    primme_params primme;
    primme_preset_method method=PRIMME_DEFAULT_METHOD;
-   int *permutation = NULL;
 
    /* Other miscellaneous items */
-   int ret, retX=0;
-   int i;
+   int ret;
    int master = 1;
    int procID = 0;
 
@@ -204,11 +211,114 @@ static int real_main (int argc, char *argv[]) {
    broadCast(&primme, &method, &driver, master, comm);
 #endif
 
+#ifdef USE_PTHREAD
+   /* ------------------------------------------------- */
+   /* Run every process on a thread (see COMMON/spmd.c) */
+   /* ------------------------------------------------- */
+   if (driver.numProcs > 1) {
+      ret = spmd_main(&driver, &primme, method);
+   }
+   else
+#else
+   if (driver.numProcs > 1) {
+      fprintf(stderr, "WARNING: driver.numProcs > 1 needs USE_PTHREAD, running with one process\n");
+   }
+#endif
+   ret = solve_main(driver, primme, method, master, procID);
+
+   fclose(primme.outputFile);
+   return ret;
+}
+
+#ifdef USE_PTHREAD
+typedef struct {
+   driver_params *driver;
+   primme_params *primme;
+   primme_preset_method method;
+   spmd_rank rank;
+   int ret;
+} spmd_args;
+
+static void *spmd_thread(void *args_) {
+   spmd_args *args = (spmd_args *)args_;
+   primme_params primme = *args->primme;
+
+   primme.numProcs = args->rank.comm->numProcs;
+   primme.procID = args->rank.procID;
+   primme.commInfo = &args->rank;
+   primme.globalSumReal = SPMDGlobalSumDouble;
+   args->ret = solve_main(*args->driver, primme, args->method,
+         primme.procID == 0, primme.procID);
+   return NULL;
+}
+
+static int spmd_main(driver_params *driver, primme_params *primme,
+      primme_preset_method method) {
+
+   spmd_comm comm;
+   spmd_args *args;
+   void **pargs;
+   int i, ret = 0, numProcs = driver->numProcs;
+
+   if (spmd_comm_init(&comm, numProcs) != 0) {
+      fprintf(stderr, "ERROR: could not initialize the threads\n");
+      return -1;
+   }
+   args = (spmd_args *)primme_calloc(numProcs, sizeof(spmd_args), "args");
+   pargs = (void **)primme_calloc(numProcs, sizeof(void*), "pargs");
+   for (i=0; i<numProcs; i++) {
+      args[i].driver = driver;
+      args[i].primme = primme;
+      args[i].method = method;
+      args[i].rank.comm = &comm;
+      args[i].rank.procID = i;
+      args[i].ret = 0;
+      pargs[i] = &args[i];
+   }
+   if (spmd_run(numProcs, spmd_thread, pargs) != 0) ret = -1;
+   for (i=0; i<numProcs; i++) {
+      if (args[i].ret != 0) ret = -1;
+   }
+   free(args);
+   free(pargs);
+   spmd_comm_free(&comm);
+   return ret;
+}
+#endif
+
+/******************************************************************************/
+#undef __FUNCT__
+#define __FUNCT__ "solve_main"
+static int solve_main(driver_params driver, primme_params primme,
+      primme_preset_method method, int master, int procID) {
+
+   /* Timing vars */
+   double wt1,wt2;
+#if defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))
+   double ut1,ut2,st1,st2;
+#endif
+
+   /* Driver and solver I/O arrays and parameters */
+   double *evals, *rnorms;
+   SCALAR *evecs;
+   int *permutation = NULL;
+
+   /* Other miscellaneous items */
+   int ret, retX=0;
+   int i;
+
    /* --------------------------------------- */
    /* Set up matrix vector and preconditioner */
    /* --------------------------------------- */
    if (setMatrixAndPrecond(&driver, &primme, &permutation) != 0) return -1;
 
+   /* --------------------------------------- */
+   /* Optional: block convergence test        */
+   /* --------------------------------------- */
+   if (driver.convTestBlock) {
+      primme.convTestBlockFun = convTestBlockAbsolute;
+   }
+
    /* --------------------------------------- */
    /* Pick one of the default methods(if set) */
    /* --------------------------------------- */
@@ -335,9 +445,22 @@ static int real_main (int argc, char *argv[]) {
       fprintf(primme.outputFile, "Restarts   : %-" PRIMME_INT_P "\n", primme.stats.numRestarts);
       fprintf(primme.outputFile, "Matvecs    : %-" PRIMME_INT_P "\n", primme.stats.numMatvecs);
       fprintf(primme.outputFile, "Preconds   : %-" PRIMME_INT_P "\n", primme.stats.numPreconds);
+      fprintf(primme.outputFile, "Reductions : %-" PRIMME_INT_P "\n", primme.stats.numGlobalSum);
+      fprintf(primme.outputFile, "Inner its  : %-" PRIMME_INT_P "\n", primme.stats.numInnerIterations);
+      fprintf(primme.outputFile, "Inner reductions : %-" PRIMME_INT_P "\n", primme.stats.numInnerGlobalSum);
+      fprintf(primme.outputFile, "Restart bytes : %" PRIMME_INT_P "\n", primme.stats.volumeRestart);
       fprintf(primme.outputFile, "Time matvecs  : %f\n",  primme.stats.timeMatvec);
       fprintf(primme.outputFile, "Time precond  : %f\n",  primme.stats.timePrecond);
       fprintf(primme.outputFile, "Time ortho  : %f\n",  primme.stats.timeOrtho);
+      fprintf(primme.outputFile, "Time solve_H  : %f\n",  primme.stats.timeSolveH);
+      fprintf(primme.outputFile, "Time restart  : %f\n",  primme.stats.timeRestart);
+      fprintf(primme.outputFile, "Time locking  : %f\n",  primme.stats.timeLocking);
+      if (primme.printLevel >= 3) primme_display_params(primme);
+#ifdef USE_NATIVE
+      if (driver.matrixChoice == driver_native && driver.PrecChoice == driver_iluk) {
+         reportILUKPrecNative((ILUKPrec*)primme.preconditioner, primme.outputFile);
+      }
+#endif
       if (primme.locking && primme.intWork && primme.intWork[0] == 1) {
          fprintf(primme.outputFile, "\nA locking problem has occurred.\n");
          fprintf(primme.outputFile,
@@ -359,7 +482,6 @@ static int real_main (int argc, char *argv[]) {
       }
    }
 
-   fclose(primme.outputFile);
    destroyMatrixAndPrecond(&driver, &primme, permutation);
    primme_free(&primme);
    free(evals);
@@ -378,6 +500,12 @@ static int real_main (int argc, char *argv[]) {
       return -1;
    }
 
+   if (driver.convTestBlock && convTestBlockMaxSize < 2 && master) {
+      fprintf(primme.outputFile, 
+         "Error: convTestBlockFun was never called with several pairs\n");
+      return -1;
+   }
+
   return(0);
 }
 /******************************************************************************/
@@ -418,6 +546,12 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
 #        endif
       }
    }
+#  if defined(USE_PTHREAD)
+   if (primme->numProcs > 1 && driver->matrixChoice != driver_native) {
+      fprintf(stderr, "ERROR: driver.numProcs > 1 is only supported with NATIVE!\n");
+      return -1;
+   }
+#  endif
    switch(driver->matrixChoice) {
    case driver_default:
       assert(0);
@@ -436,11 +570,51 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
 #  endif
       {
          CSRMatrix *matrix, *prec;
+         ILUKPrec *iluk;
          double *diag;
-         /* Fix to use a single thread */
+         /* Fix to use a single thread, except for the threaded ILU(k) */
          #ifdef _OPENMP
-         omp_set_num_threads(1);
+         if (driver->PrecChoice != driver_iluk) omp_set_num_threads(1);
          #endif
+
+#  if defined(USE_PTHREAD)
+         /* Every thread takes a slice of rows */
+         if (primme->numProcs > 1) {
+            spmd_matrix *smatrix;
+            int i;
+
+            if (readMatrixSPMD((spmd_rank*)primme->commInfo, driver->matrixFileName,
+                     &smatrix, &primme->n, &aNorm) != 0)
+               return -1;
+            primme->matrix = smatrix;
+            primme->matrixMatvec = SPMDMatrixMatvec;
+            primme->nLocal = smatrix->nLocal;
+            *permutation = (int *)primme_calloc(smatrix->nLocal > 0 ? smatrix->nLocal : 1,
+                  sizeof(int), "permutation");
+            for (i=0; i<smatrix->nLocal; i++) (*permutation)[i] = (int)smatrix->rowStart + i;
+            switch(driver->PrecChoice) {
+            case driver_noprecond:
+               primme->preconditioner = NULL;
+               primme->applyPreconditioner = NULL;
+               break;
+            case driver_jacobi:
+               createInvDiagPrecSPMD(smatrix, driver->shift, &diag);
+               primme->preconditioner = diag;
+               primme->applyPreconditioner = ApplyInvDiagPrecNative;
+               break;
+            case driver_jacobi_i:
+               createInvDiagPrecSPMD(smatrix, 0.0, &diag);
+               primme->preconditioner = diag;
+               primme->applyPreconditioner = ApplyInvDavidsonDiagPrecNative;
+               break;
+            default:
+               fprintf(stderr, "ERROR: preconditioner is not supported with driver.numProcs > 1, use other!\n");
+               freeSPMDMatrix(smatrix);
+               return -1;
+            }
+            break;
+         }
+#  endif
           
          if (readMatrixNative(driver->matrixFileName, &matrix, &aNorm) !=0 )
             return -1;
@@ -468,6 +642,12 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
             primme->preconditioner = prec;
             primme->applyPreconditioner = ApplyILUTPrecNative;
             break;
+         case driver_iluk:
+            if (createILUKPrecNative(matrix, driver->shift, driver->level, &iluk) != 0)
+               return -1;
+            primme->preconditioner = iluk;
+            primme->applyPreconditioner = ApplyILUKPrecNative;
+            break;
          default:
             fprintf(stderr, "ERROR: preconditioner is not supported with NATIVE, use other!\n");
             return -1;
@@ -606,6 +786,54 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
 #endif
       break;
 
+   case driver_generator:
+#if !defined(USE_NATIVE)
+      fprintf(stderr, "ERROR: NATIVE is needed!\n");
+      return -1;
+#else
+#  if defined(USE_MPI)
+      if (numProcs != 1) {
+         fprintf(stderr, "ERROR: MPI is not supported with generator, use other!\n");
+         return -1;
+      }
+      *(MPI_Comm*)primme->commInfo = MPI_COMM_WORLD;
+#  endif
+      {
+         GenMatrix *matrix;
+         double *diag;
+
+         if (createGenMatrix(driver->matrixFileName, &matrix, &aNorm) != 0)
+            return -1;
+         if (matrix->m != matrix->n) {
+            fprintf(stderr, "ERROR: rectangular generators are only supported by the SVDS driver!\n");
+            return -1;
+         }
+         primme->matrix = matrix;
+         primme->matrixMatvec = GenMatrixMatvec;
+         primme->n = primme->nLocal = matrix->n;
+         switch(driver->PrecChoice) {
+         case driver_noprecond:
+            primme->preconditioner = NULL;
+            primme->applyPreconditioner = NULL;
+            break;
+         case driver_jacobi:
+            createInvDiagPrecGen(matrix, driver->shift, &diag);
+            primme->preconditioner = diag;
+            primme->applyPreconditioner = ApplyInvDiagPrecNative;
+            break;
+         case driver_jacobi_i:
+            createInvDiagPrecGen(matrix, 0.0, &diag);
+            primme->preconditioner = diag;
+            primme->applyPreconditioner = ApplyInvDavidsonDiagPrecNative;
+            break;
+         default:
+            fprintf(stderr, "ERROR: preconditioner is not supported with generator, use other!\n");
+            return -1;
+         }
+      }
+#endif
+      break;
+
    }
 
    if (primme->aNorm < 0) primme->aNorm = aNorm;
@@ -630,6 +858,10 @@ static int destroyMatrixAndPrecond(driver_params *driver, primme_params *primme,
       fprintf(stderr, "ERROR: NATIVE is needed!\n");
       return -1;
 #else
+#  if defined(USE_PTHREAD)
+      if (primme->numProcs > 1) freeSPMDMatrix((spmd_matrix*)primme->matrix);
+      else
+#  endif
       freeCSRMatrix((CSRMatrix*)primme->matrix);
 
       switch(driver->PrecChoice) {
@@ -644,6 +876,9 @@ static int destroyMatrixAndPrecond(driver_params *driver, primme_params *primme,
             freeCSRMatrix((CSRMatrix*)primme->preconditioner);
          }
          break;
+      case driver_iluk:
+         freeILUKPrecNative((ILUKPrec*)primme->preconditioner);
+         break;
       default:
          break;
       }
@@ -713,6 +948,16 @@ static int destroyMatrixAndPrecond(driver_params *driver, primme_params *primme,
 #endif
       break;
 
+   case driver_generator:
+#if !defined(USE_NATIVE)
+      fprintf(stderr, "ERROR: NATIVE is needed!\n");
+      return -1;
+#else
+      freeGenMatrix((GenMatrix*)primme->matrix);
+      if (primme->preconditioner) free(primme->preconditioner);
+#endif
+      break;
+
    }
 #if defined(USE_MPI)
    free(primme->commInfo);
@@ -720,3 +965,31 @@ static int destroyMatrixAndPrecond(driver_params *driver, primme_params *primme,
    if (permutation) free(permutation);
    return 0;
 }
+
+/******************************************************************************
+ * Block version of the default convergence test in dprimme, set with
+ * driver.convTestBlock. It records the largest block size it receives.
+******************************************************************************/
+
+static void convTestBlockAbsolute(double *evals, void *evecs, PRIMME_INT *ldevecs,
+      double *rNorms, int *isconv, int *blockSize, primme_params *primme,
+      int *ierr) {
+
+   const double machEps = DBL_EPSILON;
+   const double aNorm = (primme->aNorm > 0.0) ?
+      primme->aNorm : primme->stats.estimateLargestSVal;
+   double tol = primme->eps * aNorm;
+   int i;
+
+   (void)evals; /* unused parameter */
+   (void)evecs; /* unused parameter */
+   (void)ldevecs; /* unused parameter */
+   if (tol < machEps * 3.16 * primme->stats.estimateLargestSVal) {
+      tol = machEps * 3.16 * primme->stats.estimateLargestSVal;
+   }
+   for (i=0; i < *blockSize; i++) {
+      isconv[i] = rNorms[i] < tol;
+   }
+   if (*blockSize > convTestBlockMaxSize) convTestBlockMaxSize = *blockSize;
+   *ierr = 0;
+}
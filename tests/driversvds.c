@@ -59,6 +59,7 @@
 #endif
 #ifdef USE_NATIVE
 #  include "native.h"
+#  include "gen.h"
 #endif
 #ifdef USE_PARASAILS
 #  include "parasailsw.h"
@@ -731,6 +732,51 @@ static int setMatrixAndPrecond(driver_params *driver,
 #endif
       break;
 
+   case driver_generator:
+#if !defined(USE_NATIVE)
+      fprintf(stderr, "ERROR: NATIVE is needed!\n");
+      return -1;
+#else
+#  if defined(USE_MPI)
+      if (numProcs != 1) {
+         fprintf(stderr, "ERROR: MPI is not supported with generator, use other!\n");
+         return -1;
+      }
+      *(MPI_Comm*)primme_svds->commInfo = MPI_COMM_WORLD;
+#  endif
+      {
+         GenMatrix *matrix;
+         double *diag;
+
+         if (createGenMatrix(driver->matrixFileName, &matrix, &aNorm) != 0)
+            return -1;
+         primme_svds->matrix = matrix;
+         primme_svds->matrixMatvec = GenMatrixMatvecSVD;
+         primme_svds->m = primme_svds->mLocal = matrix->m;
+         primme_svds->n = primme_svds->nLocal = matrix->n;
+         switch(driver->PrecChoice) {
+         case driver_noprecond:
+            primme_svds->preconditioner = NULL;
+            primme_svds->applyPreconditioner = NULL;
+            break;
+         case driver_jacobi:
+            createInvNormalPrecGen(matrix, driver->shift, &diag);
+            primme_svds->preconditioner = diag;
+            primme_svds->applyPreconditioner = ApplyInvNormalPrecNative;
+            break;
+         case driver_jacobi_i:
+            createInvNormalPrecGen(matrix, 0.0, &diag);
+            primme_svds->preconditioner = diag;
+            primme_svds->applyPreconditioner = ApplyInvDavidsonNormalPrecNative;
+            break;
+         default:
+            fprintf(stderr, "ERROR: preconditioner is not supported with generator, use other!\n");
+            return -1;
+         }
+      }
+#endif
+      break;
+
    }
 
    if (primme_svds->aNorm < 0) primme_svds->aNorm = aNorm;
@@ -836,6 +882,16 @@ static int destroyMatrixAndPrecond(driver_params *driver, primme_svds_params *pr
 #endif
       break;
 
+   case driver_generator:
+#if !defined(USE_NATIVE)
+      fprintf(stderr, "ERROR: NATIVE is needed!\n");
+      return -1;
+#else
+      freeGenMatrix((GenMatrix*)primme_svds->matrix);
+      if (primme_svds->preconditioner) free(primme_svds->preconditioner);
+#endif
+      break;
+
    }
 #if defined(USE_MPI)
    free(primme_svds->commInfo);